@@ -29,14 +29,59 @@ namespace cmspk {};
  */
 namespace cmspk::iopins {};
 
+#include "cmspk/iopins/AnalogFilters.hpp"
+#include "cmspk/iopins/BcmScheduler.hpp"
+#include "cmspk/iopins/BitGatherPlan.hpp"
+#include "cmspk/iopins/BitsetWords.hpp"
+#include "cmspk/iopins/BoardPinMap.hpp"
+#include "cmspk/iopins/CachedIoDirection.hpp"
+#include "cmspk/iopins/CalibratedPins.hpp"
+#include "cmspk/iopins/CalibrationTables.hpp"
+#include "cmspk/iopins/ChangeNotifyingInputPin.hpp"
+#include "cmspk/iopins/DebouncedInputPinGroup.hpp"
+#include "cmspk/iopins/DebouncedLogicInputPin.hpp"
+#include "cmspk/iopins/EdgeDispatcher.hpp"
+#include "cmspk/iopins/EdgeTracker.hpp"
+#include "cmspk/iopins/ExpanderPins.hpp"
+#include "cmspk/iopins/FilteredInputPin.hpp"
 #include "cmspk/iopins/InputPin.hpp"
 #include "cmspk/iopins/InputPinGroup.hpp"
+#include "cmspk/iopins/InputPinGroupSampler.hpp"
+#include "cmspk/iopins/InstrumentedPins.hpp"
 #include "cmspk/iopins/IoDirection.hpp"
 #include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/IoPin.hpp"
+#include "cmspk/iopins/IoPinGroup.hpp"
 #include "cmspk/iopins/LogicInputPin.hpp"
+#include "cmspk/iopins/LogicInputPinGroup.hpp"
 #include "cmspk/iopins/LogicIoPinSetting.hpp"
 #include "cmspk/iopins/LogicOutputPin.hpp"
+#include "cmspk/iopins/LogicOutputPinGroup.hpp"
+#include "cmspk/iopins/MatrixScanner.hpp"
+#include "cmspk/iopins/MultiPortInputPinGroup.hpp"
+#include "cmspk/iopins/MultiPortOutputPinGroup.hpp"
+#include "cmspk/iopins/OpenDrainPin.hpp"
 #include "cmspk/iopins/OutputPin.hpp"
 #include "cmspk/iopins/OutputPinGroup.hpp"
+#include "cmspk/iopins/OutputTransaction.hpp"
+#include "cmspk/iopins/ParallelBusWriter.hpp"
+#include "cmspk/iopins/PinInstrumentation.hpp"
+#include "cmspk/iopins/PortExpander.hpp"
+#include "cmspk/iopins/PortInputPinGroup.hpp"
+#include "cmspk/iopins/PortOutputPins.hpp"
+#include "cmspk/iopins/PortSlice.hpp"
+#include "cmspk/iopins/SetBitRange.hpp"
+#include "cmspk/iopins/ShadowedOutputPinGroup.hpp"
+#include "cmspk/iopins/SoftI2cMaster.hpp"
+#include "cmspk/iopins/SoftSpiMaster.hpp"
+#include "cmspk/iopins/SpscRing.hpp"
+#include "cmspk/iopins/StaticInputPin.hpp"
+#include "cmspk/iopins/StaticInputPinGroup.hpp"
+#include "cmspk/iopins/StaticLogicInputPin.hpp"
+#include "cmspk/iopins/StaticLogicOutputPin.hpp"
+#include "cmspk/iopins/StaticOutputPin.hpp"
+#include "cmspk/iopins/StaticOutputPinGroup.hpp"
+#include "cmspk/iopins/StaticPinHandles.hpp"
+#include "cmspk/iopins/VerticalCounterDebouncer.hpp"
 // ================[ END OF CODE ]================
 #endif
@@ -0,0 +1,375 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__ANALOG_FILTERS__HPP
+#define CMSPK__IOPINS__ANALOG_FILTERS__HPP
+
+// standard includes
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Unsigned integer type wide enough to accumulate analog samples of type `S` : `uint32_t` up to 16 bits samples,
+ * `uint64_t` otherwise.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename S>
+using AnalogAccumulator = std::conditional_t<sizeof(S) <= sizeof(uint16_t), uint32_t, uint64_t>;
+
+/**
+ * Sum a block of analog samples.
+ *
+ * @param samples the samples to sum.
+ * @returns the sum.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename S>
+AnalogAccumulator<S> sumOfSamples(std::span<const S> samples) noexcept {
+    AnalogAccumulator<S> sum = 0;
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        sum += samples[i];
+    }
+    return sum;
+}
+
+/**
+ * Oversample-and-decimate a buffer of analog samples : each output is the sum of `factor` consecutive samples shifted
+ * right by `shift` ; e.g. a factor of 4^n with a shift of n gives n more bits of resolution, a factor of 2^n with a
+ * shift of n gives the mean.
+ *
+ * @param samples the samples to decimate.
+ * @param output the decimated samples, the results MUST fit into `S`.
+ * @param factor the number of samples per output, MUST NOT be 0.
+ * @param shift the right shift applied to the sums.
+ * @returns the number of outputs, i.e. the number of whole blocks of samples, up to the size of `output`.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename S>
+std::size_t decimate(std::span<const S> samples, std::span<S> output, std::size_t factor, uint8_t shift) noexcept {
+    const std::size_t count = std::min(output.size(), samples.size() / factor);
+    for (std::size_t i = 0; i < count; ++i) {
+        output[i] = static_cast<S>(sumOfSamples(samples.subspan(i * factor, factor)) >> shift);
+    }
+    return count;
+}
+
+/**
+ * Moving average over the last `Window` samples.
+ *
+ * The history starts filled with zeros, i.e. the output ramps up during the first `Window` samples. `filter()` gives
+ * the same outputs as calling `push()` for each sample, but reads the history directly from the buffer ; for 16 bits
+ * samples the running sum is computed 4 samples at a time with SSE2 or NEON when available.
+ *
+ * @param S the unsigned integer type of the samples.
+ * @param Window the number of averaged samples, MUST be a power of 2.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename S, std::size_t Window>
+class MovingAverage {
+    static_assert(std::is_unsigned_v<S> && sizeof(S) <= sizeof(uint32_t), "S MUST be an unsigned integer type up to 32 bits");
+    static_assert(std::has_single_bit(Window), "Window MUST be a power of 2");
+    static_assert(Window <= 65536, "Window MUST NOT exceed 65536");
+
+  public:
+    ~MovingAverage() noexcept {}
+
+    /**
+     * Append a sample.
+     *
+     * @returns the average of the last `Window` samples.
+     */
+    S push(S sample) noexcept {
+        sum = sum + sample - history[index];
+        history[index] = sample;
+        index = (index + 1) & (Window - 1);
+        return static_cast<S>(sum >> SHIFT);
+    }
+
+    /**
+     * Filter a buffer of samples.
+     *
+     * @param samples the samples to append.
+     * @param output the averages, MUST be at least as large as `samples`.
+     */
+    void filter(std::span<const S> samples, std::span<S> output) noexcept {
+        const std::size_t n = samples.size();
+        std::size_t i = 0;
+        for (; i < std::min(n, Window); ++i) {
+            output[i] = push(samples[i]);
+        }
+        if (i == n) {
+            return;
+        }
+        // the oldest sample is now samples[i - Window]
+        if constexpr (std::is_same_v<S, uint16_t>) {
+#if defined(__SSE2__)
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i bias = _mm_set1_epi32(32768);
+            const __m128i flip = _mm_set1_epi16(static_cast<short>(0x8000));
+            __m128i carry = _mm_set1_epi32(static_cast<int>(sum));
+            for (; i + 4 <= n; i += 4) {
+                __m128i current = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(samples.data() + i)), zero);
+                __m128i oldest = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(samples.data() + i - Window)), zero);
+                __m128i delta = _mm_sub_epi32(current, oldest);
+                delta = _mm_add_epi32(delta, _mm_slli_si128(delta, 4));
+                delta = _mm_add_epi32(delta, _mm_slli_si128(delta, 8));
+                __m128i sums = _mm_add_epi32(delta, carry);
+                carry = _mm_shuffle_epi32(sums, _MM_SHUFFLE(3, 3, 3, 3));
+                // unsigned 16 bits packing with the signed saturating pack of SSE2
+                __m128i averages = _mm_sub_epi32(_mm_srli_epi32(sums, static_cast<int>(SHIFT)), bias);
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(output.data() + i), _mm_xor_si128(_mm_packs_epi32(averages, averages), flip));
+            }
+            sum = static_cast<uint32_t>(_mm_cvtsi128_si32(carry));
+#elif defined(__ARM_NEON)
+            const int32x4_t zero = vdupq_n_s32(0);
+            int32x4_t carry = vdupq_n_s32(static_cast<int32_t>(sum));
+            for (; i + 4 <= n; i += 4) {
+                int32x4_t current = vreinterpretq_s32_u32(vmovl_u16(vld1_u16(samples.data() + i)));
+                int32x4_t oldest = vreinterpretq_s32_u32(vmovl_u16(vld1_u16(samples.data() + i - Window)));
+                int32x4_t delta = vsubq_s32(current, oldest);
+                delta = vaddq_s32(delta, vextq_s32(zero, delta, 3));
+                delta = vaddq_s32(delta, vextq_s32(zero, delta, 2));
+                int32x4_t sums = vaddq_s32(delta, carry);
+                carry = vdupq_n_s32(vgetq_lane_s32(sums, 3));
+                uint32x4_t averages = vreinterpretq_u32_s32(sums);
+                if constexpr (SHIFT > 0) {
+                    // the shift MUST be an immediate from 1 to 32
+                    averages = vshrq_n_u32(averages, SHIFT);
+                }
+                vst1_u16(output.data() + i, vmovn_u32(averages));
+            }
+            sum = static_cast<uint32_t>(vgetq_lane_s32(carry, 0));
+#endif
+        }
+        for (; i < n; ++i) {
+            sum = sum + samples[i] - samples[i - Window];
+            output[i] = static_cast<S>(sum >> SHIFT);
+        }
+        // the history is now the last samples of the buffer, the oldest one at the current index
+        for (std::size_t j = n - Window; j < n; ++j) {
+            history[index] = samples[j];
+            index = (index + 1) & (Window - 1);
+        }
+    }
+
+  private:
+    static constexpr unsigned SHIFT = std::countr_zero(Window);
+    std::array<S, Window> history{};
+    std::size_t index = 0;
+    AnalogAccumulator<S> sum = 0;
+};
+
+/**
+ * Median of the last `K` samples, that removes isolated spikes.
+ *
+ * The history starts filled with zeros. `filter()` gives the same outputs as calling `push()` for each sample, but
+ * reads the history directly from the buffer ; for 16 bits samples and `K` of 3 or 5, the medians are computed 8 at a
+ * time by a network of minimums and maximums with SSE2 or NEON when available.
+ *
+ * @param S the unsigned integer type of the samples.
+ * @param K the number of samples, MUST be odd.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename S, std::size_t K>
+class MedianFilter {
+    static_assert(std::is_unsigned_v<S> && sizeof(S) <= sizeof(uint32_t), "S MUST be an unsigned integer type up to 32 bits");
+    static_assert(1 == K % 2 && K <= 15, "K MUST be odd, and not exceed 15");
+
+  public:
+    ~MedianFilter() noexcept {}
+
+    /**
+     * Append a sample.
+     *
+     * @returns the median of the last `K` samples.
+     */
+    S push(S sample) noexcept {
+        history[index] = sample;
+        index = (index + 1) % K;
+        return medianOf(history.data());
+    }
+
+    /**
+     * Filter a buffer of samples.
+     *
+     * @param samples the samples to append.
+     * @param output the medians, MUST be at least as large as `samples`.
+     */
+    void filter(std::span<const S> samples, std::span<S> output) noexcept {
+        const std::size_t n = samples.size();
+        std::size_t i = 0;
+        for (; i < std::min(n, K - 1); ++i) {
+            output[i] = push(samples[i]);
+        }
+        if (i == n) {
+            return;
+        }
+        // from now on, the last K samples are inside the buffer
+        if constexpr (std::is_same_v<S, uint16_t> && (3 == K || 5 == K)) {
+#if defined(__SSE2__)
+            const __m128i flip = _mm_set1_epi16(static_cast<short>(0x8000));
+            for (; i + 8 <= n; i += 8) {
+                // unsigned ordering with the signed minimums and maximums of SSE2
+                __m128i w[K];
+                for (std::size_t j = 0; j < K; ++j) {
+                    w[j] = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(samples.data() + i + 1 + j - K)), flip);
+                }
+                __m128i median = medianNetwork(w, [](__m128i a, __m128i b) { return _mm_min_epi16(a, b); }, [](__m128i a, __m128i b) { return _mm_max_epi16(a, b); });
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output.data() + i), _mm_xor_si128(median, flip));
+            }
+#elif defined(__ARM_NEON)
+            for (; i + 8 <= n; i += 8) {
+                uint16x8_t w[K];
+                for (std::size_t j = 0; j < K; ++j) {
+                    w[j] = vld1q_u16(samples.data() + i + 1 + j - K);
+                }
+                vst1q_u16(output.data() + i, medianNetwork(w, [](uint16x8_t a, uint16x8_t b) { return vminq_u16(a, b); }, [](uint16x8_t a, uint16x8_t b) { return vmaxq_u16(a, b); }));
+            }
+#endif
+        }
+        for (; i < n; ++i) {
+            output[i] = medianOf(samples.data() + i + 1 - K);
+        }
+        // the history is now the last samples of the buffer
+        for (std::size_t j = n - K; j < n; ++j) {
+            history[index] = samples[j];
+            index = (index + 1) % K;
+        }
+    }
+
+  private:
+    std::array<S, K> history{};
+    std::size_t index = 0;
+
+    /**
+     * Median of 3 or 5 values by a network of minimums and maximums, the values are clobbered.
+     */
+    template <typename V, typename Min, typename Max>
+    static V medianNetwork(V (&p)[K], Min min, Max max) noexcept {
+        auto sort = [&](V& a, V& b) {
+            V low = min(a, b);
+            b = max(a, b);
+            a = low;
+        };
+        if constexpr (3 == K) {
+            return max(min(p[0], p[1]), min(max(p[0], p[1]), p[2]));
+        } else {
+            sort(p[0], p[1]);
+            sort(p[3], p[4]);
+            sort(p[0], p[3]);
+            sort(p[1], p[4]);
+            sort(p[1], p[2]);
+            sort(p[2], p[3]);
+            sort(p[1], p[2]);
+            return p[2];
+        }
+    }
+
+    static S medianOf(const S* window) noexcept {
+        S values[K];
+        std::copy(window, window + K, values);
+        if constexpr (3 == K || 5 == K) {
+            return medianNetwork(values, [](S a, S b) { return std::min(a, b); }, [](S a, S b) { return std::max(a, b); });
+        } else {
+            std::nth_element(values, values + K / 2, values + K);
+            return values[K / 2];
+        }
+    }
+};
+
+/**
+ * First order low-pass filter (exponential moving average), `y += (x - y) / 2^Shift`, in fixed point.
+ *
+ * Each output depends on the previous one, `filter()` is a plain loop over `push()`.
+ *
+ * @param S the unsigned integer type of the samples.
+ * @param Shift the smoothing, the time constant is about 2^Shift samples.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename S, unsigned Shift>
+class IirFilter {
+    static_assert(std::is_unsigned_v<S> && sizeof(S) <= sizeof(uint32_t), "S MUST be an unsigned integer type up to 32 bits");
+    static_assert(Shift >= 1 && Shift + 8 * sizeof(S) <= 8 * sizeof(AnalogAccumulator<S>), "the filtered value MUST fit into the accumulator");
+
+  public:
+    ~IirFilter() noexcept {}
+
+    /**
+     * Fully define a filter.
+     *
+     * @param initial **optionnal**, the initial output.
+     */
+    IirFilter(S initial = 0) noexcept : state(static_cast<AnalogAccumulator<S>>(initial) << Shift) {}
+
+    /**
+     * Append a sample.
+     *
+     * @returns the filtered value.
+     */
+    S push(S sample) noexcept {
+        state = state - (state >> Shift) + sample;
+        return static_cast<S>(state >> Shift);
+    }
+
+    /**
+     * Filter a buffer of samples.
+     *
+     * @param samples the samples to append.
+     * @param output the filtered values, MUST be at least as large as `samples`.
+     */
+    void filter(std::span<const S> samples, std::span<S> output) noexcept {
+        for (std::size_t i = 0; i < samples.size(); ++i) {
+            output[i] = push(samples[i]);
+        }
+    }
+
+  private:
+    AnalogAccumulator<S> state;
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,193 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__BCM_SCHEDULER__HPP
+#define CMSPK__IOPINS__BCM_SCHEDULER__HPP
+
+// standard includes
+#include <array>
+#include <bit>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <type_traits>
+
+// project includes
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/OutputPin.hpp"
+#include "cmspk/iopins/OutputPinGroup.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Software PWM of a group of digital output pins using binary code modulation : a period is made of `Bits` slots,
+ * the slot `b` lasts `2^b` ticks and outputs the frame `b`, i.e. the bit `b` of the duty cycle of each channel.
+ *
+ * The frames are kept up to date when a duty cycle changes, only the frames of the bits that change are modified ; a
+ * tick costs at most one write of the group, whatever the number of channels. A change of duty cycle during a period
+ * takes effect on the following slots, i.e. the current period may be a mix of the previous and the new duty cycle.
+ *
+ * The scheduler is driven either by calling `tick()` at a fixed rate, or by calling `nextSlot()` then waiting for the
+ * returned duration, e.g. by reprogramming a timer.
+ *
+ * @param N the number of channels, i.e. the size of the group.
+ * @param Bits the resolution of the duty cycles, from 1 to 16 bits.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N, std::size_t Bits = 8>
+class BcmScheduler {
+    static_assert(Bits >= 1 && Bits <= 16, "the resolution is from 1 to 16 bits");
+
+  public:
+    /**
+     * Type of a duty cycle, from 0 (always off) to `MAX_DUTY` (always on).
+     */
+    using Duty = std::conditional_t<(Bits <= 8), uint8_t, uint16_t>;
+
+    /**
+     * Duty cycle of a channel that is always on.
+     */
+    static constexpr Duty MAX_DUTY = static_cast<Duty>((1u << Bits) - 1u);
+
+    /**
+     * Duration of a period, in ticks.
+     */
+    static constexpr uint32_t PERIOD_TICKS = MAX_DUTY;
+
+    ~BcmScheduler() noexcept {}
+
+    /**
+     * Fully define a scheduler, all the duty cycles are 0.
+     *
+     * @param output the group of pins to drive.
+     */
+    BcmScheduler(OutputPinGroup<N>& output) noexcept : output(output) {}
+
+    /**
+     * Change the duty cycle of a channel, only the frames of the changing bits are modified.
+     *
+     * @param channel the channel, less than N.
+     * @param duty the duty cycle, the bits beyond the resolution are ignored.
+     */
+    void setDuty(std::size_t channel, Duty duty) noexcept {
+        duty = static_cast<Duty>(duty & MAX_DUTY);
+        uint32_t changes = static_cast<uint32_t>(duties[channel] ^ duty);
+        duties[channel] = duty;
+        while (0 != changes) {
+            frames[std::countr_zero(changes)].flip(channel);
+            changes &= changes - 1;
+        }
+    }
+
+    /**
+     * Get the duty cycle of a channel.
+     */
+    Duty getDuty(std::size_t channel) const noexcept { return duties[channel]; }
+
+    /**
+     * Get the frame output during a slot.
+     *
+     * @param slot the slot, less than `Bits`.
+     */
+    const std::bitset<N>& getFrame(std::size_t slot) const noexcept { return frames[slot]; }
+
+    /**
+     * Get the current slot.
+     */
+    std::size_t getSlot() const noexcept { return slot; }
+
+    /**
+     * Go to the next slot and output its frame ; when the write fails, the scheduler stays on the current slot, so that
+     * the next call tries the same frame again instead of skipping it.
+     *
+     * @returns the duration of the slot in ticks, or the failure of the write.
+     */
+    std::expected<uint32_t, IoFailureReason> nextSlot() noexcept {
+        const std::size_t next = (slot + 1 < Bits) ? slot + 1 : 0;
+        std::expected<void, IoFailureReason> result = output.write(frames[next]);
+        if (!result.has_value()) {
+            return std::unexpected(result.error());
+        }
+        slot = next;
+        return uint32_t(1) << slot;
+    }
+
+    /**
+     * Advance by one tick, the next frame is output when the current slot is over ; when the write fails, the next tick
+     * tries the same frame again.
+     *
+     * @returns the result of the write of the frame, if any.
+     */
+    std::expected<void, IoFailureReason> tick() noexcept {
+        if (0 == remainingTicks) {
+            std::expected<uint32_t, IoFailureReason> duration = nextSlot();
+            if (!duration.has_value()) {
+                return std::unexpected(duration.error());
+            }
+            remainingTicks = duration.value();
+        }
+        --remainingTicks;
+        return std::expected<void, IoFailureReason>();
+    }
+
+  private:
+    OutputPinGroup<N>& output;
+    std::array<std::bitset<N>, Bits> frames{};
+    std::array<Duty, N> duties{};
+    std::size_t slot = Bits - 1;
+    uint32_t remainingTicks = 0;
+};
+
+/**
+ * Analog output pin driving a channel of a `BcmScheduler`, writing a value changes the duty cycle of the channel ; the
+ * pin id is the channel.
+ *
+ * @param N the number of channels of the scheduler, up to 256.
+ * @param Bits the resolution of the scheduler.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N, std::size_t Bits = 8>
+class BcmOutputPin final : public OutputPin<typename BcmScheduler<N, Bits>::Duty> {
+  public:
+    ~BcmOutputPin() noexcept {}
+
+    /**
+     * Fully define a pin.
+     *
+     * @param scheduler the scheduler.
+     * @param channel the channel of the scheduler, also the pin id.
+     */
+    BcmOutputPin(BcmScheduler<N, Bits>& scheduler, uint8_t channel) noexcept : OutputPin<typename BcmScheduler<N, Bits>::Duty>(channel), scheduler(scheduler) {}
+
+  private:
+    BcmScheduler<N, Bits>& scheduler;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept {
+        if (this->getPinId() >= N) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_DISABLED);
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+    virtual std::expected<void, IoFailureReason> doWrite(const typename BcmScheduler<N, Bits>::Duty value) noexcept {
+        scheduler.setDuty(this->getPinId(), value);
+        return std::expected<void, IoFailureReason>();
+    }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,181 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__BIT_GATHER_PLAN__HPP
+#define CMSPK__IOPINS__BIT_GATHER_PLAN__HPP
+
+// standard includes
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Precomputed plan to gather the bits of a group of pins, scattered inside a port register word, into a compact value
+ * where the bit `i` is the value of the pin `i` of the group ; and to scatter such a value back into a port register
+ * word.
+ *
+ * Pins that keep the same distance between their position in the register and their position in the group (e.g. runs
+ * of adjacent bits) are collapsed into a single shift-and-mask step. When the pin ids are strictly increasing and the
+ * target supports BMI2, the gathering is a single `PEXT` instruction (and the scattering a single `PDEP` instruction).
+ *
+ * The plan can be built at compile time.
+ *
+ * @param N the size of the group, MUST NOT exceed the width of `W`.
+ * @param W the unsigned integer type of the port register word.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N, typename W = uint32_t>
+class BitGatherPlan {
+    static_assert(std::is_unsigned_v<W>, "W MUST be an unsigned integer type");
+    static_assert(N <= sizeof(W) * CHAR_BIT, "The group MUST fit into the port register word");
+
+  public:
+    /**
+     * Build the plan for the given pins.
+     *
+     * @param ids the N positions of the pins inside the port register word, each one SHOULD be lower than the width of
+     * `W` : a plan built at compile time fails to build otherwise, and a plan built at runtime leaves the pin out, its
+     * value being always gathered as 0 and never scattered.
+     */
+    constexpr BitGatherPlan(const std::array<uint8_t, N>& ids) noexcept {
+        for (std::size_t i = 0; i < N; ++i) {
+            if (ids[i] >= sizeof(W) * CHAR_BIT) {
+                if consteval {
+                    pinIdMustBeLowerThanTheWordWidth();
+                }
+                increasing = false;
+                continue;
+            }
+            W source = static_cast<W>(W(1) << ids[i]);
+            W destination = static_cast<W>(W(1) << i);
+            mask |= source;
+            increasing = increasing && (i == 0 || ids[i - 1] < ids[i]);
+            int shift = static_cast<int>(ids[i]) - static_cast<int>(i);
+            std::size_t s = 0;
+            while (s < stepCount && steps[s].shift != shift) {
+                ++s;
+            }
+            if (s == stepCount) {
+                steps[stepCount++] = Step{W(0), shift};
+            }
+            steps[s].mask |= destination;
+        }
+    }
+
+    /**
+     * Gather the bits of the pins from the given port register word.
+     *
+     * @param word the value of the port register.
+     *
+     * @returns the compact value, bit `i` being the value of pin `i`.
+     */
+    constexpr W gather(W word) const noexcept {
+#if defined(__BMI2__)
+        if !consteval {
+            if (increasing) {
+                if constexpr (sizeof(W) <= sizeof(uint32_t)) {
+                    return static_cast<W>(_pext_u32(word, mask));
+                } else {
+                    return static_cast<W>(_pext_u64(word, mask));
+                }
+            }
+        }
+#endif
+        W result = 0;
+        for (std::size_t s = 0; s < stepCount; ++s) {
+            const Step& step = steps[s];
+            result |= static_cast<W>(((step.shift >= 0) ? (word >> step.shift) : (word << -step.shift)) & step.mask);
+        }
+        return result;
+    }
+
+    /**
+     * Scatter the values of the pins to their positions inside a port register word, i.e. the inverse of `gather()`.
+     *
+     * @param value the compact value, bit `i` being the value of pin `i`.
+     *
+     * @returns the port register word, the bits outside of the mask are cleared.
+     */
+    constexpr W scatter(W value) const noexcept {
+#if defined(__BMI2__)
+        if !consteval {
+            if (increasing) {
+                if constexpr (sizeof(W) <= sizeof(uint32_t)) {
+                    return static_cast<W>(_pdep_u32(value, mask));
+                } else {
+                    return static_cast<W>(_pdep_u64(value, mask));
+                }
+            }
+        }
+#endif
+        W result = 0;
+        for (std::size_t s = 0; s < stepCount; ++s) {
+            const Step& step = steps[s];
+            W moved = value & step.mask;
+            result |= static_cast<W>((step.shift >= 0) ? (moved << step.shift) : (moved >> -step.shift));
+        }
+        return result;
+    }
+
+    /**
+     * Get the mask of the pins inside the port register word.
+     */
+    constexpr W getMask() const noexcept { return mask; }
+
+    /**
+     * Get the number of shift-and-mask steps of the plan.
+     */
+    constexpr std::size_t getStepCount() const noexcept { return stepCount; }
+
+    /**
+     * Tells whether the pin ids are strictly increasing, i.e. the gathering is a parallel bit extraction of the mask.
+     */
+    constexpr bool isIncreasing() const noexcept { return increasing; }
+
+  private:
+    /**
+     * Called, only when building a plan at compile time with a pin id beyond the width of `W` ; being not
+     * `constexpr`, it makes the build fail.
+     */
+    static void pinIdMustBeLowerThanTheWordWidth() noexcept {}
+
+    /**
+     * A step moves the pins sharing the same distance between their source and destination positions.
+     */
+    struct Step {
+        /**
+         * Mask of the pins, at their destination positions.
+         */
+        W mask;
+        /**
+         * Distance to shift right (or left when negative) to go from the source to the destination positions.
+         */
+        int shift;
+    };
+
+    std::array<Step, N> steps{};
+    std::size_t stepCount = 0;
+    W mask = 0;
+    bool increasing = true;
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
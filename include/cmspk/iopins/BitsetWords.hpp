@@ -0,0 +1,105 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__BITSET_WORDS__HPP
+#define CMSPK__IOPINS__BITSET_WORDS__HPP
+
+// standard includes
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Number of words of type `W` needed to hold the bits of a `std::bitset<N>`.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename W, std::size_t N>
+inline constexpr std::size_t bitsetWordCount = (N + std::numeric_limits<W>::digits - 1) / std::numeric_limits<W>::digits;
+
+/**
+ * Convert a `std::bitset<N>` into native words, the bit `i` of the bitset is the bit `i % width` of the word
+ * `i / width`.
+ *
+ * Up to 64 bits, the conversion is a single `to_ullong()` ; beyond, it costs one shift and one mask of the bitset per
+ * word, instead of one access per bit.
+ *
+ * @param W the unsigned integer type of the words, up to 64 bits wide.
+ * @param bits the bitset to convert.
+ * @returns the words, the unused bits of the last word are 0.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename W, std::size_t N>
+std::array<W, bitsetWordCount<W, N>> toWords(const std::bitset<N>& bits) noexcept {
+    static_assert(std::is_unsigned_v<W> && std::numeric_limits<W>::digits <= 64, "words are unsigned integers up to 64 bits wide");
+    constexpr std::size_t WIDTH = std::numeric_limits<W>::digits;
+    std::array<W, bitsetWordCount<W, N>> words{};
+    if constexpr (N <= 64) {
+        const uint64_t all = bits.to_ullong();
+        for (std::size_t i = 0; i < words.size(); ++i) {
+            words[i] = static_cast<W>(all >> (i * WIDTH));
+        }
+    } else {
+        const std::bitset<N> lowWordMask(static_cast<unsigned long long>(std::numeric_limits<W>::max()));
+        std::bitset<N> remaining = bits;
+        for (std::size_t i = 0; i < words.size(); ++i) {
+            words[i] = static_cast<W>((remaining & lowWordMask).to_ullong());
+            remaining >>= WIDTH;
+        }
+    }
+    return words;
+}
+
+/**
+ * Convert native words into a `std::bitset<N>`, conversely to `toWords()` ; the bits beyond N are ignored.
+ *
+ * @param W the unsigned integer type of the words, up to 64 bits wide.
+ * @param words the words to convert.
+ * @returns the bitset.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N, typename W, std::size_t K>
+std::bitset<N> fromWords(const std::array<W, K>& words) noexcept {
+    static_assert(std::is_unsigned_v<W> && std::numeric_limits<W>::digits <= 64, "words are unsigned integers up to 64 bits wide");
+    constexpr std::size_t WIDTH = std::numeric_limits<W>::digits;
+    if constexpr (N <= 64) {
+        uint64_t all = 0;
+        for (std::size_t i = 0; i < K && i * WIDTH < 64; ++i) {
+            all |= static_cast<uint64_t>(words[i]) << (i * WIDTH);
+        }
+        return std::bitset<N>(all);
+    } else {
+        std::bitset<N> bits;
+        for (std::size_t i = K; i-- > 0;) {
+            bits <<= WIDTH;
+            bits |= std::bitset<N>(static_cast<unsigned long long>(words[i]));
+        }
+        return bits;
+    }
+}
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
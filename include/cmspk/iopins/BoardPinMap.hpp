@@ -0,0 +1,269 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__BOARD_PIN_MAP__HPP
+#define CMSPK__IOPINS__BOARD_PIN_MAP__HPP
+
+// standard includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+// project includes
+#include "cmspk/iopins/BitGatherPlan.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * A named pin of a board : its port and its position inside the port register word.
+ *
+ * A board is described by a type providing the type of its port register word and the table of its pins, e.g. :
+ *
+ * ```
+ * struct MyBoard {
+ *     using Word = uint32_t;
+ *     static constexpr std::array<BoardPin, 3> PINS{{{"LED", 0, 5}, {"BUTTON", 0, 13}, {"CS", 1, 2}}};
+ * };
+ * ```
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+struct BoardPin {
+    /**
+     * The name of the pin, unique for the board.
+     */
+    std::string_view name;
+    /**
+     * The index of the port.
+     */
+    uint8_t port;
+    /**
+     * The position of the pin inside the port register word, also the pin id.
+     */
+    uint8_t bit;
+};
+
+/**
+ * A string literal usable as a template parameter, to name the pins of a board.
+ *
+ * @param L the size of the literal, including the terminating zero.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t L>
+struct FixedString {
+    char chars[L]{};
+
+    constexpr FixedString(const char (&literal)[L]) noexcept {
+        for (std::size_t i = 0; i < L; ++i) {
+            chars[i] = literal[i];
+        }
+    }
+
+    /**
+     * Get the string, without the terminating zero.
+     */
+    constexpr std::string_view view() const noexcept { return std::string_view(chars, L - 1); }
+};
+
+/**
+ * Find a pin of a board by its name.
+ *
+ * @param Board the description of the board.
+ * @param name the name of the pin.
+ * @returns the index of the pin inside `Board::PINS`, or the size of the table when there is no such pin.
+ */
+template <typename Board>
+constexpr std::size_t boardPinIndex(std::string_view name) noexcept {
+    for (std::size_t i = 0; i < Board::PINS.size(); ++i) {
+        if (Board::PINS[i].name == name) {
+            return i;
+        }
+    }
+    return Board::PINS.size();
+}
+
+/**
+ * Tells whether the description of a board is consistent : unique names, no two names for the same pin, and each
+ * position fits in the port register word.
+ *
+ * @param Board the description of the board.
+ */
+template <typename Board>
+constexpr bool isBoardPinMapValid() noexcept {
+    constexpr std::size_t WIDTH = std::numeric_limits<typename Board::Word>::digits;
+    for (std::size_t i = 0; i < Board::PINS.size(); ++i) {
+        if (Board::PINS[i].bit >= WIDTH) {
+            return false;
+        }
+        for (std::size_t j = i + 1; j < Board::PINS.size(); ++j) {
+            if (Board::PINS[i].name == Board::PINS[j].name) {
+                return false;
+            }
+            if (Board::PINS[i].port == Board::PINS[j].port && Board::PINS[i].bit == Board::PINS[j].bit) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * A named pin of a board, resolved at compile time ; an unknown name does not compile.
+ *
+ * @param Board the description of the board.
+ * @param Name the name of the pin.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Board, FixedString Name>
+struct BoardPinOf {
+    static_assert(isBoardPinMapValid<Board>(), "The board MUST NOT have duplicate names, duplicate pins, or pins beyond its port width");
+    static_assert(boardPinIndex<Board>(Name.view()) < Board::PINS.size(), "The board MUST have a pin with this name");
+
+    /**
+     * The pin.
+     */
+    static constexpr BoardPin PIN = Board::PINS[boardPinIndex<Board>(Name.view())];
+
+    /**
+     * The index of the port of the pin.
+     */
+    static constexpr uint8_t PORT = PIN.port;
+
+    /**
+     * The pin id, i.e. its position inside the port register word.
+     */
+    static constexpr uint8_t ID = PIN.bit;
+
+    /**
+     * The mask of the pin inside the port register word.
+     */
+    static constexpr typename Board::Word MASK = static_cast<typename Board::Word>(typename Board::Word(1) << PIN.bit);
+};
+
+/**
+ * A group of named pins of the same port of a board, resolved at compile time, giving the pin ids, the mask and the
+ * gather plan of the group (see `PortInputPinGroup`) as constants.
+ *
+ * Unknown names, a name given twice and pins from different ports do not compile.
+ *
+ * @param Board the description of the board.
+ * @param Names the names of the pins, in the order of the group.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Board, FixedString... Names>
+struct BoardPinGroup {
+    static_assert(sizeof...(Names) > 0, "The group MUST have at least one pin");
+    static_assert(isBoardPinMapValid<Board>(), "The board MUST NOT have duplicate names, duplicate pins, or pins beyond its port width");
+    static_assert(((boardPinIndex<Board>(Names.view()) < Board::PINS.size()) && ...), "The board MUST have a pin for each name");
+
+    /**
+     * Type of the port register word.
+     */
+    using Word = typename Board::Word;
+
+    /**
+     * The size of the group.
+     */
+    static constexpr std::size_t N = sizeof...(Names);
+
+    /**
+     * The pins of the group.
+     */
+    static constexpr std::array<BoardPin, N> PINS{Board::PINS[boardPinIndex<Board>(Names.view())]...};
+
+  private:
+    static constexpr bool hasDuplicates() noexcept {
+        for (std::size_t i = 0; i < N; ++i) {
+            for (std::size_t j = i + 1; j < N; ++j) {
+                if (PINS[i].name == PINS[j].name) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    static constexpr bool isSinglePort() noexcept {
+        for (const BoardPin& pin : PINS) {
+            if (pin.port != PINS[0].port) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static constexpr std::array<uint8_t, N> idsOf() noexcept {
+        std::array<uint8_t, N> ids{};
+        for (std::size_t i = 0; i < N; ++i) {
+            ids[i] = PINS[i].bit;
+        }
+        return ids;
+    }
+
+    static_assert(!hasDuplicates(), "The group MUST NOT have the same pin twice");
+    static_assert(isSinglePort(), "The pins of the group MUST belong to the same port");
+
+  public:
+    /**
+     * The index of the port of the group.
+     */
+    static constexpr uint8_t PORT = PINS[0].port;
+
+    /**
+     * The pin ids, i.e. the positions of the pins inside the port register word.
+     */
+    static constexpr std::array<uint8_t, N> IDS = idsOf();
+
+    /**
+     * The plan to gather and scatter the value of the group.
+     */
+    static constexpr BitGatherPlan<N, Word> PLAN{IDS};
+
+    /**
+     * The mask of the pins of the group inside the port register word.
+     */
+    static constexpr Word MASK = PLAN.getMask();
+
+    /**
+     * Tells whether the group shares no pin with another group of the same board.
+     *
+     * @param Other the other group.
+     */
+    template <typename Other>
+    static constexpr bool isDisjointFrom() noexcept {
+        for (const BoardPin& pin : PINS) {
+            for (const BoardPin& other : Other::PINS) {
+                if (pin.port == other.port && pin.bit == other.bit) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,116 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__CACHED_IO_DIRECTION__HPP
+#define CMSPK__IOPINS__CACHED_IO_DIRECTION__HPP
+
+// standard includes
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/IoDirection.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Direction of a reconfigurable pin, or group of pins, remembered so that setting the same direction again does not
+ * access the hardware.
+ *
+ * The direction is `HIGH_Z` until the first change. When a change fails (e.g. `FAILURE_IMMUTABLE_DIRECTION`), the
+ * state of the hardware is unknown, hence the direction becomes `HIGH_Z` and is not trusted anymore : reads and writes
+ * fail with `FAILURE_PIN_IS_DISABLED` until a change succeeds, and the next change will access the hardware, even to
+ * the same direction.
+ *
+ * A specialization MUST implement `doSetDirection()`.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class CachedIoDirection {
+  public:
+    ~CachedIoDirection() noexcept {}
+
+    /**
+     * Get the last direction set.
+     */
+    IoDirection getDirection() const noexcept { return direction; }
+
+    /**
+     * Tell whether the last direction set is trusted, i.e. a change has succeeded and nothing invalidated it since.
+     */
+    bool isDirectionKnown() const noexcept { return known; }
+
+    /**
+     * Change the direction, the hardware is accessed only when the direction is different or not trusted.
+     *
+     * @param value the new direction.
+     * @returns the result of the change.
+     */
+    std::expected<void, IoFailureReason> setDirection(IoDirection value) noexcept {
+        if (known && value == direction) {
+            return std::expected<void, IoFailureReason>();
+        }
+        std::expected<void, IoFailureReason> result = doSetDirection(value);
+        direction = result.has_value() ? value : IoDirection::HIGH_Z;
+        known = result.has_value();
+        return result;
+    }
+
+    /**
+     * Forget the last direction set, e.g. after the pins have been reconfigured by something else ; the next change of
+     * direction will access the hardware.
+     */
+    void invalidateDirection() noexcept { known = false; }
+
+    bool isReadable() const noexcept { return IoDirection::READ == direction; }
+    bool isNotReadable() const noexcept { return !isReadable(); }
+    bool isWritable() const noexcept { return IoDirection::WRITE == direction; }
+    bool isNotWritable() const noexcept { return !isWritable(); }
+    bool isEnabled() const noexcept { return IoDirection::HIGH_Z != direction; }
+    bool isDisabled() const noexcept { return !isEnabled(); }
+
+  protected:
+    /**
+     * Succeed when the direction is `READ`, fail with the reason otherwise.
+     */
+    std::expected<void, IoFailureReason> checkReadDirection() const noexcept {
+        if (IoDirection::READ == direction) {
+            return std::expected<void, IoFailureReason>();
+        }
+        return std::unexpected(IoDirection::HIGH_Z == direction ? IoFailureReason::FAILURE_PIN_IS_DISABLED : IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+    }
+
+    /**
+     * Succeed when the direction is `WRITE`, fail with the reason otherwise.
+     */
+    std::expected<void, IoFailureReason> checkWriteDirection() const noexcept {
+        if (IoDirection::WRITE == direction) {
+            return std::expected<void, IoFailureReason>();
+        }
+        return std::unexpected(IoDirection::HIGH_Z == direction ? IoFailureReason::FAILURE_PIN_IS_DISABLED : IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+    }
+
+  private:
+    IoDirection direction = IoDirection::HIGH_Z;
+    bool known = false;
+
+    /**
+     * Change the direction of the hardware, all at once for a group of pins.
+     *
+     * @param value the new direction.
+     * @returns the result of the change, e.g. `FAILURE_IMMUTABLE_DIRECTION` when the hardware cannot change.
+     */
+    virtual std::expected<void, IoFailureReason> doSetDirection(IoDirection value) noexcept = 0;
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
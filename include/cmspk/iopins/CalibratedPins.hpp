@@ -0,0 +1,102 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__CALIBRATED_PINS__HPP
+#define CMSPK__IOPINS__CALIBRATED_PINS__HPP
+
+// standard includes
+#include <expected>
+#include <type_traits>
+
+// project includes
+#include "cmspk/iopins/CalibrationTables.hpp"
+#include "cmspk/iopins/InputPin.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/OutputPin.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Analog input pin giving the readings of another one in engineering units, converted by a table computed at compile
+ * time, e.g. a `PiecewiseLinearTable` or a `LookupTable`.
+ *
+ * A failure of the wrapped pin is reported as is.
+ *
+ * @param S the unsigned integer type of the raw readings, typically `uint8_t` or `uint16_t`.
+ * @param Table the conversion table, providing the types `Raw` and `Value` and `static Value toValue(Raw)`.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename S, typename Table>
+class CalibratedInputPin final : public InputPin<typename Table::Value> {
+    static_assert(std::is_same_v<S, typename Table::Raw>, "The table MUST convert raw readings of the type of the pin");
+
+  public:
+    ~CalibratedInputPin() noexcept {}
+
+    /**
+     * Fully define a calibrated input pin.
+     *
+     * @param source the pin giving the raw readings, the pin id is the same.
+     */
+    CalibratedInputPin(InputPin<S>& source) noexcept : InputPin<typename Table::Value>(source.getPinId()), source(source) {}
+
+  private:
+    InputPin<S>& source;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<typename Table::Value, IoFailureReason> doRead() noexcept {
+        std::expected<S, IoFailureReason> raw = source.read();
+        if (!raw.has_value()) {
+            return std::unexpected(raw.error());
+        }
+        return Table::toValue(raw.value());
+    }
+};
+
+/**
+ * Analog output pin taking values in engineering units, converted into the raw values of another one by the inverse
+ * mapping of a table computed at compile time.
+ *
+ * A failure of the wrapped pin is reported as is.
+ *
+ * @param S the unsigned integer type of the raw values, typically `uint8_t` or `uint16_t`.
+ * @param Table the conversion table, providing the types `Raw` and `Value` and `static Raw toRaw(Value)`.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename S, typename Table>
+class CalibratedOutputPin final : public OutputPin<typename Table::Value> {
+    static_assert(std::is_same_v<S, typename Table::Raw>, "The table MUST convert raw values of the type of the pin");
+
+  public:
+    ~CalibratedOutputPin() noexcept {}
+
+    /**
+     * Fully define a calibrated output pin.
+     *
+     * @param target the pin taking the raw values, the pin id is the same.
+     */
+    CalibratedOutputPin(OutputPin<S>& target) noexcept : OutputPin<typename Table::Value>(target.getPinId()), target(target) {}
+
+  private:
+    OutputPin<S>& target;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<void, IoFailureReason> doWrite(const typename Table::Value value) noexcept { return target.write(Table::toRaw(value)); }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,290 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__CALIBRATION_TABLES__HPP
+#define CMSPK__IOPINS__CALIBRATION_TABLES__HPP
+
+// standard includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+// project includes
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * A calibration point : a raw reading of an analog pin and the matching value in engineering units, e.g. millivolts or
+ * tenths of degree.
+ *
+ * A calibration is described by a type providing the type of the values and the table of its points, sorted by raw
+ * reading, e.g. :
+ *
+ * ```
+ * struct MyThermistor {
+ *     using Value = int16_t;
+ *     static constexpr std::array<CalibrationPoint<int16_t>, 3> POINTS{{{0, 1250}, {2048, 250}, {4095, -400}}};
+ * };
+ * ```
+ *
+ * @param V the integer type of the values.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename V>
+struct CalibrationPoint {
+    /**
+     * The raw reading.
+     */
+    uint32_t raw;
+    /**
+     * The value in engineering units.
+     */
+    V value;
+};
+
+/**
+ * Check that a calibration has at least 2 points, with strictly increasing raw readings that fit into the given raw
+ * type.
+ *
+ * @param Calibration the calibration type.
+ * @param S the type of the raw readings.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Calibration, typename S>
+constexpr bool isCalibrationValid() noexcept {
+    if (Calibration::POINTS.size() < 2) {
+        return false;
+    }
+    for (std::size_t i = 0; i < Calibration::POINTS.size(); ++i) {
+        if (Calibration::POINTS[i].raw > std::numeric_limits<S>::max()) {
+            return false;
+        }
+        if (i > 0 && Calibration::POINTS[i].raw <= Calibration::POINTS[i - 1].raw) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Check that the values of a calibration are either strictly increasing or strictly decreasing, so that a value
+ * matches a single raw reading.
+ *
+ * @param Calibration the calibration type.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Calibration>
+constexpr bool isCalibrationMonotonic() noexcept {
+    bool rising = true;
+    bool falling = true;
+    for (std::size_t i = 1; i < Calibration::POINTS.size(); ++i) {
+        rising = rising && Calibration::POINTS[i].value > Calibration::POINTS[i - 1].value;
+        falling = falling && Calibration::POINTS[i].value < Calibration::POINTS[i - 1].value;
+    }
+    return rising || falling;
+}
+
+/**
+ * Conversion table interpolating linearly between the points of a calibration, computed at compile time.
+ *
+ * The slope of each segment is precomputed in 16.16 fixed point, so that a conversion is a search among the points,
+ * one multiplication and one shift, the result being rounded to the nearest. Readings (resp. values) beyond the first
+ * or the last point are clamped.
+ *
+ * `toRaw()` requires a monotonic calibration (see `isCalibrationMonotonic()`).
+ *
+ * @param Calibration the calibration type.
+ * @param S the unsigned integer type of the raw readings, up to 16 bits.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Calibration, typename S>
+class PiecewiseLinearTable {
+    static_assert(std::is_unsigned_v<S> && sizeof(S) <= sizeof(uint16_t), "The raw readings MUST be unsigned integers of up to 16 bits");
+    static_assert(std::is_integral_v<typename Calibration::Value> && sizeof(typename Calibration::Value) <= sizeof(uint32_t),
+                  "The values MUST be integers of up to 32 bits");
+    static_assert(isCalibrationValid<Calibration, S>(), "The calibration MUST have at least 2 points, sorted by raw reading, that fit into the raw type");
+
+  public:
+    /**
+     * The type of the raw readings.
+     */
+    using Raw = S;
+
+    /**
+     * The type of the values.
+     */
+    using Value = typename Calibration::Value;
+
+    /**
+     * Convert a raw reading into a value.
+     */
+    static constexpr Value toValue(const S raw) noexcept {
+        if (raw <= POINTS[0].raw) {
+            return POINTS[0].value;
+        }
+        if (raw >= POINTS[SEGMENTS].raw) {
+            return POINTS[SEGMENTS].value;
+        }
+        std::size_t low = 0;
+        std::size_t high = SEGMENTS;
+        while (high - low > 1) {
+            std::size_t middle = (low + high) / 2;
+            if (POINTS[middle].raw <= raw) {
+                low = middle;
+            } else {
+                high = middle;
+            }
+        }
+        const int64_t delta = static_cast<int64_t>(raw) - POINTS[low].raw;
+        return static_cast<Value>(POINTS[low].value + ((delta * SLOPES[low] + HALF) >> FRACTION_BITS));
+    }
+
+    /**
+     * Convert a value into the raw reading giving it, e.g. to drive an analog output.
+     */
+    static constexpr S toRaw(const Value value) noexcept {
+        static_assert(isCalibrationMonotonic<Calibration>(), "The values of the calibration MUST be strictly monotonic to be converted back");
+        constexpr bool RISING = POINTS[SEGMENTS].value > POINTS[0].value;
+        if (RISING ? value <= POINTS[0].value : value >= POINTS[0].value) {
+            return static_cast<S>(POINTS[0].raw);
+        }
+        if (RISING ? value >= POINTS[SEGMENTS].value : value <= POINTS[SEGMENTS].value) {
+            return static_cast<S>(POINTS[SEGMENTS].raw);
+        }
+        std::size_t low = 0;
+        std::size_t high = SEGMENTS;
+        while (high - low > 1) {
+            std::size_t middle = (low + high) / 2;
+            if (RISING ? POINTS[middle].value <= value : POINTS[middle].value >= value) {
+                low = middle;
+            } else {
+                high = middle;
+            }
+        }
+        const int64_t delta = static_cast<int64_t>(value) - POINTS[low].value;
+        const int64_t raw = POINTS[low].raw + ((delta * INVERSE_SLOPES[low] + HALF) >> FRACTION_BITS);
+        return static_cast<S>(raw < POINTS[high].raw ? raw : POINTS[high].raw);
+    }
+
+  private:
+    static constexpr auto& POINTS = Calibration::POINTS;
+    static constexpr std::size_t SEGMENTS = Calibration::POINTS.size() - 1;
+    static constexpr unsigned FRACTION_BITS = 16;
+    static constexpr int64_t HALF = int64_t(1) << (FRACTION_BITS - 1);
+
+    static constexpr int64_t divideRounded(const int64_t numerator, const int64_t denominator) noexcept {
+        if (0 == denominator) {
+            return 0;
+        }
+        const bool negative = (numerator < 0) != (denominator < 0);
+        const int64_t n = numerator < 0 ? -numerator : numerator;
+        const int64_t d = denominator < 0 ? -denominator : denominator;
+        const int64_t quotient = (n + d / 2) / d;
+        return negative ? -quotient : quotient;
+    }
+
+    static constexpr std::array<int64_t, SEGMENTS> makeSlopes(const bool inverse) noexcept {
+        std::array<int64_t, SEGMENTS> slopes{};
+        for (std::size_t i = 0; i < SEGMENTS; ++i) {
+            const int64_t dr = static_cast<int64_t>(POINTS[i + 1].raw) - POINTS[i].raw;
+            const int64_t dv = static_cast<int64_t>(POINTS[i + 1].value) - POINTS[i].value;
+            slopes[i] = inverse ? divideRounded(dr * (int64_t(1) << FRACTION_BITS), dv) : divideRounded(dv * (int64_t(1) << FRACTION_BITS), dr);
+        }
+        return slopes;
+    }
+
+    static constexpr std::array<int64_t, SEGMENTS> SLOPES = makeSlopes(false);
+    static constexpr std::array<int64_t, SEGMENTS> INVERSE_SLOPES = makeSlopes(true);
+};
+
+/**
+ * Conversion table giving the value of each of the 2^Bits raw readings, computed at compile time from the
+ * interpolation of a calibration (see `PiecewiseLinearTable`) ; e.g. 256 values for a 8 bits converter, 4096 values for
+ * a 12 bits converter.
+ *
+ * The raw readings of the calibration MUST fit into the resolution. A conversion is a single indexed load, readings
+ * beyond the table being clamped to its last entry ; `toRaw()` requires a monotonic calibration.
+ *
+ * @param Calibration the calibration type.
+ * @param S the unsigned integer type of the raw readings, up to 16 bits.
+ * @param Bits the resolution of the converter, the table has 2^Bits entries.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Calibration, typename S, unsigned Bits>
+class LookupTable {
+    static_assert(Bits >= 1 && Bits <= std::numeric_limits<S>::digits && Bits <= 16, "The resolution MUST fit into the raw type, up to 16 bits");
+    static_assert(Calibration::POINTS.back().raw < (std::size_t(1) << Bits), "The raw readings of the calibration MUST fit into the resolution");
+
+  public:
+    /**
+     * The type of the raw readings.
+     */
+    using Raw = S;
+
+    /**
+     * The type of the values.
+     */
+    using Value = typename Calibration::Value;
+
+    /**
+     * The number of entries.
+     */
+    static constexpr std::size_t SIZE = std::size_t(1) << Bits;
+
+    /**
+     * Convert a raw reading into a value.
+     */
+    static constexpr Value toValue(const S raw) noexcept { return VALUES[raw < SIZE ? raw : SIZE - 1]; }
+
+    /**
+     * Convert a value into a raw reading, e.g. to drive an analog output : the table being computed from the
+     * interpolation of the calibration, this is the inverse of this interpolation (see `PiecewiseLinearTable`), i.e. a
+     * reading whose value is at most one step away from the nearest value of the table.
+     */
+    static constexpr S toRaw(const Value value) noexcept {
+        const S raw = PiecewiseLinearTable<Calibration, S>::toRaw(value);
+        return raw < SIZE ? raw : static_cast<S>(SIZE - 1);
+    }
+
+  private:
+    static constexpr std::array<Value, SIZE> makeValues() noexcept {
+        std::array<Value, SIZE> values{};
+        for (std::size_t i = 0; i < SIZE; ++i) {
+            values[i] = PiecewiseLinearTable<Calibration, S>::toValue(static_cast<S>(i));
+        }
+        return values;
+    }
+
+    static constexpr std::array<Value, SIZE> VALUES = makeValues();
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,160 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__CHANGE_NOTIFYING_INPUT_PIN__HPP
+#define CMSPK__IOPINS__CHANGE_NOTIFYING_INPUT_PIN__HPP
+
+// standard includes
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+// project includes
+#include "cmspk/iopins/InputPin.hpp"
+#include "cmspk/iopins/SpscRing.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * A change of level of an input pin, signaled from interrupt context.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+struct EdgeEvent {
+    /**
+     * The time of the change, in the unit of the timer of the backend.
+     */
+    uint32_t timestamp;
+    /**
+     * The channel of the pin, i.e. the index of its handler in an `EdgeDispatcher`.
+     */
+    uint8_t channel;
+    /**
+     * The new level of the pin, `true` for a rising edge.
+     */
+    bool level;
+};
+
+/**
+ * Bounded, allocation free, lock free queue of `EdgeEvent`s, from interrupt context to the main context.
+ *
+ * The queue is a `SpscRing` : all the pins posting into the same queue MUST do so from the same interrupt context
+ * (e.g. the same interrupt handler, or interrupts that cannot preempt each other), and only the main context consumes
+ * it. When the queue is full, the new events are dropped and counted.
+ *
+ * @param Capacity the maximum number of pending events, MUST be a power of 2.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t Capacity>
+class EdgeEventQueue {
+  public:
+    /**
+     * Append an event, **interrupt context only**.
+     *
+     * @returns `false` when the queue is full, the event is dropped and counted as an overflow.
+     */
+    bool post(const EdgeEvent& event) noexcept {
+        if (ring.push(event)) {
+            return true;
+        }
+        // single producer, no read-modify-write needed
+        overflows.store(overflows.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    /**
+     * Remove the oldest event, **main context only**.
+     */
+    std::optional<EdgeEvent> pop() noexcept { return ring.pop(); }
+
+    /**
+     * Remove as many of the oldest events as possible, **main context only**.
+     *
+     * @returns the number of removed events, copied at the start of `events`.
+     */
+    std::size_t popBatch(std::span<EdgeEvent> events) noexcept { return ring.popBatch(events); }
+
+    /**
+     * Get the number of pending events, only a snapshot.
+     */
+    std::size_t size() const noexcept { return ring.size(); }
+
+    /**
+     * Get the number of events dropped because the queue was full.
+     */
+    uint32_t getOverflowCount() const noexcept { return overflows.load(std::memory_order_relaxed); }
+
+    /**
+     * Get the maximum number of pending events.
+     */
+    static constexpr std::size_t capacity() noexcept { return Capacity; }
+
+  private:
+    SpscRing<EdgeEvent, Capacity> ring;
+    std::atomic<uint32_t> overflows{0};
+};
+
+/**
+ * Binary input pin that, in addition to polling, signals its changes of level as `EdgeEvent`s : the backend calls
+ * `notifyEdge()` from its interrupt handler, the event lands in an `EdgeEventQueue`, and is dispatched later from the
+ * main context, e.g. by an `EdgeDispatcher`.
+ *
+ * The implementation provides `checkReadability()` and `doRead()` like any input pin, and calls `notifyEdge()`.
+ *
+ * @param Capacity the capacity of the queue.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t Capacity>
+class ChangeNotifyingInputPin : public BinaryInputPin {
+  public:
+    ~ChangeNotifyingInputPin() noexcept {}
+
+    /**
+     * Fully define a change notifying input pin.
+     *
+     * @param id the native identification number of the pin.
+     * @param queue the queue receiving the events.
+     * @param channel the channel of the pin, given in the events.
+     */
+    ChangeNotifyingInputPin(uint8_t id, EdgeEventQueue<Capacity>& queue, uint8_t channel) noexcept : BinaryInputPin(id), queue(queue), channel(channel) {}
+
+    /**
+     * Get the channel of the pin.
+     */
+    uint8_t getChannel() const noexcept { return channel; }
+
+    /**
+     * Signal a change of level, **interrupt context only**.
+     *
+     * @param level the new level.
+     * @param timestamp the time of the change.
+     * @returns `false` when the event has been dropped because the queue was full.
+     */
+    bool notifyEdge(bool level, uint32_t timestamp) noexcept { return queue.post(EdgeEvent{timestamp, channel, level}); }
+
+  private:
+    EdgeEventQueue<Capacity>& queue;
+    uint8_t channel;
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
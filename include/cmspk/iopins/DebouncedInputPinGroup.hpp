@@ -0,0 +1,79 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for input pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__DEBOUNCED_INPUT_PIN_GROUP__HPP
+#define CMSPK__IOPINS__DEBOUNCED_INPUT_PIN_GROUP__HPP
+
+// standard includes
+#include <bitset>
+#include <cstddef>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/InputPinGroup.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/VerticalCounterDebouncer.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * A group of binary input pins debouncing another group : each `read()` samples the wrapped group once, and returns
+ * the debounced values of all the pins, computed with vertical counters.
+ *
+ * A failure of the wrapped group is reported as is, without sampling.
+ *
+ * @param N the size of the group.
+ * @param Samples the number of consecutive samples required to accept a change.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N, std::size_t Samples>
+class DebouncedInputPinGroup final : public InputPinGroup<N> {
+  public:
+    ~DebouncedInputPinGroup() noexcept {}
+
+    /**
+     * Fully define a debounced input pin group.
+     *
+     * @param source the group to debounce, the pin ids are the same.
+     * @param initialState **optionnal**, the initial debounced values.
+     */
+    DebouncedInputPinGroup(InputPinGroup<N>& source, std::bitset<N> initialState = std::bitset<N>()) noexcept
+        : InputPinGroup<N>(source.getPinIds()), source(source), debouncer(initialState) {}
+
+    /**
+     * Get the debounced values without sampling the wrapped group.
+     */
+    std::bitset<N> getState() const noexcept { return debouncer.getState(); }
+
+    /**
+     * Force the debounced values, and clear the counters.
+     *
+     * @param newState the new debounced values.
+     */
+    void reset(std::bitset<N> newState = std::bitset<N>()) noexcept { debouncer.reset(newState); }
+
+  private:
+    InputPinGroup<N>& source;
+    VerticalCounterDebouncer<N, Samples> debouncer;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<std::bitset<N>, IoFailureReason> doRead() noexcept {
+        std::expected<std::bitset<N>, IoFailureReason> raw = source.read();
+        if (!raw.has_value()) {
+            return raw;
+        }
+        return debouncer.sample(raw.value());
+    }
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
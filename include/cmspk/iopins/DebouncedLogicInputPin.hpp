@@ -0,0 +1,62 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__DEBOUNCED_LOGIC_INPUT_PIN__HPP
+#define CMSPK__IOPINS__DEBOUNCED_LOGIC_INPUT_PIN__HPP
+#include <bitset>
+#include <cstddef>
+#include <expected>
+
+#include "cmspk/iopins/InputPin.hpp"
+#include "cmspk/iopins/LogicInputPin.hpp"
+#include "cmspk/iopins/LogicIoPinSetting.hpp"
+#include "cmspk/iopins/VerticalCounterDebouncer.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+
+/**
+ * Logic input pin debouncing a binary input pin : each `read()` (and thus `readLogic()`, `isAsserted()`,...) samples
+ * the wrapped pin once, and the **raw** value changes after `Samples` consecutive samples differing from it.
+ *
+ * A failure of the wrapped pin is reported as is, without sampling.
+ *
+ * @param Samples the number of consecutive samples required to accept a change.
+ */
+template <std::size_t Samples>
+class DebouncedLogicInputPin final : public LogicInputPin {
+  public:
+    ~DebouncedLogicInputPin() noexcept {}
+
+    /**
+     * Fully define a debounced logic input pin.
+     *
+     * @param source the pin to debounce, the pin id is the same.
+     * @param logicSetting **optionnal**, the initial logicSetting.
+     * @param initialState **optionnal**, the initial debounced raw value.
+     */
+    DebouncedLogicInputPin(BinaryInputPin& source, LogicIoPinSetting logicSetting = LogicIoPinSetting::ACTIVE_HIGH, bool initialState = false) noexcept
+        : LogicInputPin(source.getPinId(), logicSetting), source(source), debouncer(std::bitset<1>(initialState)) {}
+
+  private:
+    BinaryInputPin& source;
+    VerticalCounterDebouncer<1, Samples> debouncer;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<bool, IoFailureReason> doRead() noexcept {
+        std::expected<bool, IoFailureReason> raw = source.read();
+        if (!raw.has_value()) {
+            return raw;
+        }
+        return debouncer.sample(std::bitset<1>(raw.value()))[0];
+    }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,125 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__EDGE_DISPATCHER__HPP
+#define CMSPK__IOPINS__EDGE_DISPATCHER__HPP
+
+// standard includes
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+// project includes
+#include "cmspk/iopins/ChangeNotifyingInputPin.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Dispatcher of the `EdgeEvent`s of an `EdgeEventQueue` to handlers, from the main context, through a fixed size
+ * table indexed by the channel of the events.
+ *
+ * @param Channels the number of channels.
+ * @param Capacity the capacity of the queue.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t Channels, std::size_t Capacity>
+class EdgeDispatcher {
+  public:
+    /**
+     * Function handling an event, with the context given at registration.
+     */
+    using Handler = void (*)(void* context, const EdgeEvent& event);
+
+    /**
+     * Number of events popped from the queue at once.
+     */
+    static constexpr std::size_t BATCH = 16;
+
+    ~EdgeDispatcher() noexcept {}
+
+    /**
+     * Fully define a dispatcher, without handlers.
+     *
+     * @param queue the queue to consume.
+     */
+    EdgeDispatcher(EdgeEventQueue<Capacity>& queue) noexcept : queue(queue) {}
+
+    /**
+     * Register the handler of a channel, replacing the previous one.
+     *
+     * @param channel the channel, lower than `Channels`.
+     * @param handler the function to call, `nullptr` to remove the handler.
+     * @param context the value given to the function.
+     * @returns `false` when the channel is out of range, nothing being registered.
+     */
+    bool setHandler(uint8_t channel, Handler handler, void* context) noexcept {
+        if (channel >= Channels) {
+            return false;
+        }
+        handlers[channel] = Entry{handler, context};
+        return true;
+    }
+
+    /**
+     * Dispatch the pending events to their handlers, in order, **main context only**.
+     *
+     * @param maxEvents **optionnal**, the maximum number of events to dispatch.
+     * @returns the number of events removed from the queue.
+     */
+    std::size_t dispatch(std::size_t maxEvents = std::numeric_limits<std::size_t>::max()) noexcept {
+        std::array<EdgeEvent, BATCH> batch;
+        std::size_t total = 0;
+        while (total < maxEvents) {
+            std::size_t count = queue.popBatch(std::span<EdgeEvent>(batch.data(), std::min(BATCH, maxEvents - total)));
+            if (0 == count) {
+                break;
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                const EdgeEvent& event = batch[i];
+                if (event.channel < Channels && nullptr != handlers[event.channel].handler) {
+                    handlers[event.channel].handler(handlers[event.channel].context, event);
+                } else {
+                    ++unhandled;
+                }
+            }
+            total += count;
+        }
+        return total;
+    }
+
+    /**
+     * Get the number of events dropped because the queue was full.
+     */
+    uint32_t getOverflowCount() const noexcept { return queue.getOverflowCount(); }
+
+    /**
+     * Get the number of events without handler.
+     */
+    uint32_t getUnhandledCount() const noexcept { return unhandled; }
+
+  private:
+    struct Entry {
+        Handler handler = nullptr;
+        void* context = nullptr;
+    };
+
+    EdgeEventQueue<Capacity>& queue;
+    std::array<Entry, Channels> handlers{};
+    uint32_t unhandled = 0;
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
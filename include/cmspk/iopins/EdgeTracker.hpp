@@ -0,0 +1,135 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for input pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__EDGE_TRACKER__HPP
+#define CMSPK__IOPINS__EDGE_TRACKER__HPP
+
+// standard includes
+#include <bitset>
+#include <cstddef>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/InputPinGroup.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/SetBitRange.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Values of a group of input pins, with the changes since the previous read.
+ *
+ * @param N the size of the group.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N>
+struct InputEdges {
+    /**
+     * The values that have been read.
+     */
+    std::bitset<N> value;
+    /**
+     * The pins that went from `false` to `true`.
+     */
+    std::bitset<N> rising;
+    /**
+     * The pins that went from `true` to `false`.
+     */
+    std::bitset<N> falling;
+    /**
+     * The pins that changed, i.e. either rising or falling.
+     */
+    std::bitset<N> changed;
+
+    /**
+     * Tells whether at least one pin changed, when not, there is nothing else to look at.
+     */
+    bool hasChanged() const noexcept { return changed.any(); }
+
+    /**
+     * Range over the indices of the rising pins.
+     */
+    SetBitRange<N> risingIndices() const noexcept { return SetBitRange<N>(rising); }
+
+    /**
+     * Range over the indices of the falling pins.
+     */
+    SetBitRange<N> fallingIndices() const noexcept { return SetBitRange<N>(falling); }
+
+    /**
+     * Range over the indices of the changed pins.
+     */
+    SetBitRange<N> changedIndices() const noexcept { return SetBitRange<N>(changed); }
+};
+
+/**
+ * Keep track of the previous values of a group of input pins, to report the rising, falling and changed pins at each
+ * read.
+ *
+ * @param N the size of the group.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N>
+class EdgeTracker {
+  public:
+    ~EdgeTracker() noexcept {}
+
+    /**
+     * Fully define an edge tracker.
+     *
+     * @param source the group to read.
+     * @param initialValue **optionnal**, the values to compare the first read with.
+     */
+    EdgeTracker(InputPinGroup<N>& source, std::bitset<N> initialValue = std::bitset<N>()) noexcept : source(source), previous(initialValue) {}
+
+    /**
+     * Read the group and compute the changes since the previous successful read.
+     *
+     * @returns the values and changes, or the failure of the read operation.
+     */
+    std::expected<InputEdges<N>, IoFailureReason> read() noexcept {
+        std::expected<std::bitset<N>, IoFailureReason> readResult = source.read();
+        if (!readResult.has_value()) {
+            return std::unexpected(readResult.error());
+        }
+        return track(readResult.value());
+    }
+
+    /**
+     * Compute the changes between the previous values and the given ones, that become the previous values.
+     *
+     * @param value the new values.
+     *
+     * @returns the values and changes.
+     */
+    InputEdges<N> track(const std::bitset<N> value) noexcept {
+        std::bitset<N> changed = value ^ previous;
+        previous = value;
+        return InputEdges<N>{value, changed & value, changed & ~value, changed};
+    }
+
+    /**
+     * Get the values of the previous successful read.
+     */
+    std::bitset<N> getPrevious() const noexcept { return previous; }
+
+  private:
+    InputPinGroup<N>& source;
+    std::bitset<N> previous;
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,198 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__EXPANDER_PINS__HPP
+#define CMSPK__IOPINS__EXPANDER_PINS__HPP
+
+// standard includes
+#include <cstdint>
+#include <expected>
+#include <limits>
+
+// project includes
+#include "cmspk/iopins/InputPin.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/LogicInputPin.hpp"
+#include "cmspk/iopins/LogicIoPinSetting.hpp"
+#include "cmspk/iopins/LogicOutputPin.hpp"
+#include "cmspk/iopins/OutputPin.hpp"
+#include "cmspk/iopins/PortExpander.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Mask of a pin of a `PortExpander`, 0 when the position is beyond the width of the expander.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+constexpr PortExpander::Word expanderMaskOf(uint8_t bit) noexcept {
+    return (bit < std::numeric_limits<PortExpander::Word>::digits) ? static_cast<PortExpander::Word>(PortExpander::Word(1) << bit) : PortExpander::Word(0);
+}
+
+/**
+ * Binary input pin bound to a pin of a `PortExpander`, the pin id is the position of the pin inside the expander.
+ *
+ * Inside a batch of the expander, the pins share one snapshot of the input register.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class ExpanderInputPin final : public BinaryInputPin {
+  public:
+    ~ExpanderInputPin() noexcept {}
+
+    /**
+     * Fully define an expander input pin.
+     *
+     * @param expander the expander.
+     * @param bit the position of the pin inside the expander, also the pin id ; a pin beyond the width of the expander is
+     * never readable.
+     */
+    ExpanderInputPin(PortExpander& expander, uint8_t bit) noexcept : BinaryInputPin(bit), expander(expander), mask(expanderMaskOf(bit)) {}
+
+  private:
+    PortExpander& expander;
+    PortExpander::Word mask;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept {
+        if (0 == mask) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+        }
+        return expander.checkReadable(mask);
+    }
+    virtual std::expected<bool, IoFailureReason> doRead() noexcept {
+        std::expected<PortExpander::Word, IoFailureReason> inputs = expander.readInputs();
+        if (!inputs.has_value()) {
+            return std::unexpected(inputs.error());
+        }
+        return 0 != (inputs.value() & mask);
+    }
+};
+
+/**
+ * Binary output pin bound to a pin of a `PortExpander`, the pin id is the position of the pin inside the expander.
+ *
+ * Inside a batch of the expander, the writes are coalesced into one transfer at `commit()`.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class ExpanderOutputPin final : public BinaryOutputPin {
+  public:
+    ~ExpanderOutputPin() noexcept {}
+
+    /**
+     * Fully define an expander output pin.
+     *
+     * @param expander the expander.
+     * @param bit the position of the pin inside the expander, also the pin id ; a pin beyond the width of the expander is
+     * never writable.
+     */
+    ExpanderOutputPin(PortExpander& expander, uint8_t bit) noexcept : BinaryOutputPin(bit), expander(expander), mask(expanderMaskOf(bit)) {}
+
+  private:
+    PortExpander& expander;
+    PortExpander::Word mask;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept {
+        if (0 == mask) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+        }
+        return expander.checkWritable(mask);
+    }
+    virtual std::expected<void, IoFailureReason> doWrite(const bool value) noexcept { return expander.writeBits(mask, value ? mask : 0); }
+};
+
+/**
+ * Logic input pin bound to a pin of a `PortExpander`, see `ExpanderInputPin`.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class ExpanderLogicInputPin final : public LogicInputPin {
+  public:
+    ~ExpanderLogicInputPin() noexcept {}
+
+    /**
+     * Fully define an expander logic input pin.
+     *
+     * @param expander the expander.
+     * @param bit the position of the pin inside the expander, also the pin id ; a pin beyond the width of the expander is
+     * never readable.
+     * @param logicSetting **optionnal**, the initial logicSetting.
+     */
+    ExpanderLogicInputPin(PortExpander& expander, uint8_t bit, LogicIoPinSetting logicSetting = LogicIoPinSetting::ACTIVE_HIGH) noexcept
+        : LogicInputPin(bit, logicSetting), expander(expander), mask(expanderMaskOf(bit)) {}
+
+  private:
+    PortExpander& expander;
+    PortExpander::Word mask;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept {
+        if (0 == mask) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+        }
+        return expander.checkReadable(mask);
+    }
+    virtual std::expected<bool, IoFailureReason> doRead() noexcept {
+        std::expected<PortExpander::Word, IoFailureReason> inputs = expander.readInputs();
+        if (!inputs.has_value()) {
+            return std::unexpected(inputs.error());
+        }
+        return 0 != (inputs.value() & mask);
+    }
+};
+
+/**
+ * Logic output pin bound to a pin of a `PortExpander`, see `ExpanderOutputPin`.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class ExpanderLogicOutputPin final : public LogicOutputPin {
+  public:
+    ~ExpanderLogicOutputPin() noexcept {}
+
+    /**
+     * Fully define an expander logic output pin.
+     *
+     * @param expander the expander.
+     * @param bit the position of the pin inside the expander, also the pin id ; a pin beyond the width of the expander is
+     * never writable.
+     * @param logicSetting **optionnal**, the initial logicSetting.
+     */
+    ExpanderLogicOutputPin(PortExpander& expander, uint8_t bit, LogicIoPinSetting logicSetting = LogicIoPinSetting::ACTIVE_HIGH) noexcept
+        : LogicOutputPin(bit, logicSetting), expander(expander), mask(expanderMaskOf(bit)) {}
+
+  private:
+    PortExpander& expander;
+    PortExpander::Word mask;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept {
+        if (0 == mask) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+        }
+        return expander.checkWritable(mask);
+    }
+    virtual std::expected<void, IoFailureReason> doWrite(const bool value) noexcept { return expander.writeBits(mask, value ? mask : 0); }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
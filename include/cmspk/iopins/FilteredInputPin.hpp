@@ -0,0 +1,117 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__FILTERED_INPUT_PIN__HPP
+#define CMSPK__IOPINS__FILTERED_INPUT_PIN__HPP
+
+// standard includes
+#include <cstddef>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/AnalogFilters.hpp"
+#include "cmspk/iopins/InputPin.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Analog input pin filtering another one : each `read()` samples the wrapped pin once, and gives the sample to the
+ * filter, e.g. a `MovingAverage`, a `MedianFilter` or an `IirFilter`.
+ *
+ * A failure of the wrapped pin is reported as is, without sampling.
+ *
+ * @param S the unsigned integer type of the samples, typically `uint16_t` or `uint32_t`.
+ * @param Filter the filter, providing `S push(S)`.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename S, typename Filter>
+class FilteredInputPin final : public InputPin<S> {
+  public:
+    ~FilteredInputPin() noexcept {}
+
+    /**
+     * Fully define a filtered input pin.
+     *
+     * @param source the pin to filter, the pin id is the same.
+     * @param filter **optionnal**, the initial state of the filter.
+     */
+    FilteredInputPin(InputPin<S>& source, Filter filter = Filter()) noexcept : InputPin<S>(source.getPinId()), source(source), filter(filter) {}
+
+    /**
+     * Access to the filter, e.g. to feed it with logged samples.
+     */
+    Filter& getFilter() noexcept { return filter; }
+
+  private:
+    InputPin<S>& source;
+    Filter filter;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<S, IoFailureReason> doRead() noexcept {
+        std::expected<S, IoFailureReason> raw = source.read();
+        if (!raw.has_value()) {
+            return raw;
+        }
+        return filter.push(raw.value());
+    }
+};
+
+/**
+ * Analog input pin oversampling another one : each `read()` samples the wrapped pin `Factor` times, and gives the sum
+ * shifted right by `Shift` ; e.g. a factor of 4^n with a shift of n gives n more bits of resolution.
+ *
+ * A failure of the wrapped pin is reported as is.
+ *
+ * @param S the unsigned integer type of the samples, the results MUST fit into it.
+ * @param Factor the number of samples per read.
+ * @param Shift the right shift applied to the sum.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename S, std::size_t Factor, unsigned Shift>
+class OversampledInputPin final : public InputPin<S> {
+    static_assert(Factor >= 1, "Factor MUST NOT be 0");
+
+  public:
+    ~OversampledInputPin() noexcept {}
+
+    /**
+     * Fully define an oversampled input pin.
+     *
+     * @param source the pin to oversample, the pin id is the same.
+     */
+    OversampledInputPin(InputPin<S>& source) noexcept : InputPin<S>(source.getPinId()), source(source) {}
+
+  private:
+    InputPin<S>& source;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<S, IoFailureReason> doRead() noexcept {
+        AnalogAccumulator<S> sum = 0;
+        for (std::size_t i = 0; i < Factor; ++i) {
+            std::expected<S, IoFailureReason> raw = source.read();
+            if (!raw.has_value()) {
+                return raw;
+            }
+            sum += raw.value();
+        }
+        return static_cast<S>(sum >> Shift);
+    }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
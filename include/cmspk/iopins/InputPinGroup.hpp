@@ -16,6 +16,7 @@ A C++ abstraction layer for input pins of micro-controllers.
 #include <cstddef>
 #include <cstdint>
 #include <expected>
+#include <span>
 
 // dependencies includes
 #include "cmspk/ucdev.hpp"
@@ -37,6 +38,12 @@ namespace cmspk::iopins {
 template <std::size_t N>
 class InputPinGroup : public cmspk::ucdev::InputValueDevice<std::bitset<N>, IoFailureReason>, public cmspk::ucdev::SimpleReadableDeviceAssertions {
   public:
+    /**
+     * Function called after each sample of a burst, to pace it, with the context given along with it ; none means as
+     * fast as possible.
+     */
+    using Pacing = void (*)(void* context);
+
     ~InputPinGroup() noexcept {}
 
     /**
@@ -51,8 +58,38 @@ class InputPinGroup : public cmspk::ucdev::InputValueDevice<std::bitset<N>, IoFa
      */
     std::array<uint8_t, N> getPinIds() const noexcept { return ids; }
 
+    /**
+     * Read a burst of samples, e.g. to capture a waveform.
+     *
+     * @param samples the samples to fill, in order.
+     * @param pacing **optionnal**, the function called after each sample.
+     * @param context **optionnal**, the context given to the pacing function.
+     * @returns the result of the capture, that stops at the first failure.
+     */
+    std::expected<void, IoFailureReason> readSamples(std::span<std::bitset<N>> samples, Pacing pacing = nullptr, void* context = nullptr) noexcept {
+        return doReadSamples(samples, pacing, context);
+    }
+
   private:
     std::array<uint8_t, N> ids;
+
+    /**
+     * Read a burst of samples, by default one `read()` per sample ; an implementation MAY override it with a tighter
+     * loop, e.g. checking the readability once.
+     */
+    virtual std::expected<void, IoFailureReason> doReadSamples(std::span<std::bitset<N>> samples, Pacing pacing, void* context) noexcept {
+        for (std::bitset<N>& sample : samples) {
+            std::expected<std::bitset<N>, IoFailureReason> result = this->read();
+            if (!result.has_value()) {
+                return std::unexpected(result.error());
+            }
+            sample = result.value();
+            if (nullptr != pacing) {
+                pacing(context);
+            }
+        }
+        return std::expected<void, IoFailureReason>();
+    }
 };
 
 /**
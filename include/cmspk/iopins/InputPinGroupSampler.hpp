@@ -0,0 +1,115 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for input pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__INPUT_PIN_GROUP_SAMPLER__HPP
+#define CMSPK__IOPINS__INPUT_PIN_GROUP_SAMPLER__HPP
+
+// standard includes
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/InputPinGroup.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/SpscRing.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Values of a group of input pins, read at a given time.
+ *
+ * @param N the size of the group.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N>
+struct TimestampedSample {
+    /**
+     * The time of the read, in the unit of the clock of the sampler.
+     */
+    uint32_t timestamp;
+    /**
+     * The values that have been read.
+     */
+    std::bitset<N> value;
+};
+
+/**
+ * Producer of timestamped samples of a group of input pins into a `SpscRing`.
+ *
+ * The sampler is the single producer of the ring, `poll()` is typically called from an interrupt handler or a capture
+ * thread.
+ *
+ * @param N the size of the group.
+ * @param Capacity the capacity of the ring.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N, std::size_t Capacity>
+class InputPinGroupSampler {
+  public:
+    /**
+     * Clock giving the timestamp of the samples, called with the context given along with it, e.g. a timer.
+     */
+    using Clock = uint32_t (*)(void* context);
+
+    ~InputPinGroupSampler() noexcept {}
+
+    /**
+     * Fully define a sampler.
+     *
+     * @param source the group to sample.
+     * @param ring the ring receiving the samples.
+     * @param clock the clock giving the timestamp of the samples.
+     * @param clockContext **optionnal**, the context given to `clock`.
+     */
+    InputPinGroupSampler(InputPinGroup<N>& source, SpscRing<TimestampedSample<N>, Capacity>& ring, Clock clock, void* clockContext = nullptr) noexcept
+        : source(source), ring(ring), clock(clock), clockContext(clockContext) {}
+
+    /**
+     * Read the group and append the sample to the ring.
+     *
+     * @returns `true` when the sample has been appended, `false` when the ring was full (an overrun), or the failure
+     * of the read operation.
+     */
+    std::expected<bool, IoFailureReason> poll() noexcept {
+        uint32_t timestamp = clock(clockContext);
+        std::expected<std::bitset<N>, IoFailureReason> readResult = source.read();
+        if (!readResult.has_value()) {
+            return std::unexpected(readResult.error());
+        }
+        if (!ring.push(TimestampedSample<N>{timestamp, readResult.value()})) {
+            ++overruns;
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Get the number of samples lost because the ring was full.
+     */
+    uint32_t getOverrunCount() const noexcept { return overruns; }
+
+  private:
+    InputPinGroup<N>& source;
+    SpscRing<TimestampedSample<N>, Capacity>& ring;
+    Clock clock;
+    void* clockContext;
+    uint32_t overruns = 0;
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,198 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__INSTRUMENTED_PINS__HPP
+#define CMSPK__IOPINS__INSTRUMENTED_PINS__HPP
+
+// standard includes
+#include <bitset>
+#include <cstddef>
+#include <expected>
+#include <span>
+
+// project includes
+#include "cmspk/iopins/InputPin.hpp"
+#include "cmspk/iopins/InputPinGroup.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/OutputPin.hpp"
+#include "cmspk/iopins/OutputPinGroup.hpp"
+#include "cmspk/iopins/PinInstrumentation.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Input pin instrumenting the reads of another one, e.g. to count the reads and failures of a pin of a driver ; the
+ * static pins (e.g. `StaticInputPin`) take the instrumentation policy directly instead.
+ *
+ * @param S storage type for the value, typically a `bool` or an `uint8_t`
+ * @param Instrumentation the instrumentation policy, e.g. `CountingInstrumentation`.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename S, typename Instrumentation>
+class InstrumentedInputPin final : public InputPin<S> {
+  public:
+    ~InstrumentedInputPin() noexcept {}
+
+    /**
+     * Fully define an instrumented input pin.
+     *
+     * @param source the pin to instrument, the pin id is the same.
+     */
+    InstrumentedInputPin(InputPin<S>& source) noexcept : InputPin<S>(source.getPinId()), source(source) {}
+
+    /**
+     * Access to the instrumentation policy, e.g. to register its statistics.
+     */
+    Instrumentation& getInstrumentation() noexcept { return instrumentation; }
+
+  private:
+    InputPin<S>& source;
+    [[no_unique_address]] Instrumentation instrumentation;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<S, IoFailureReason> doRead() noexcept {
+        return instrumentOperation(instrumentation, PIN_OPERATION_READ, [this]() noexcept { return source.read(); });
+    }
+};
+
+/**
+ * Output pin instrumenting the writes of another one, e.g. to count the writes and failures of a pin of a driver ; the
+ * static pins (e.g. `StaticOutputPin`) take the instrumentation policy directly instead.
+ *
+ * @param S storage type for the value, typically a `bool` or an `uint8_t`
+ * @param Instrumentation the instrumentation policy, e.g. `CountingInstrumentation`.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename S, typename Instrumentation>
+class InstrumentedOutputPin final : public OutputPin<S> {
+  public:
+    ~InstrumentedOutputPin() noexcept {}
+
+    /**
+     * Fully define an instrumented output pin.
+     *
+     * @param target the pin to instrument, the pin id is the same.
+     */
+    InstrumentedOutputPin(OutputPin<S>& target) noexcept : OutputPin<S>(target.getPinId()), target(target) {}
+
+    /**
+     * Access to the instrumentation policy, e.g. to register its statistics.
+     */
+    Instrumentation& getInstrumentation() noexcept { return instrumentation; }
+
+  private:
+    OutputPin<S>& target;
+    [[no_unique_address]] Instrumentation instrumentation;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<void, IoFailureReason> doWrite(const S value) noexcept {
+        return instrumentOperation(instrumentation, PIN_OPERATION_WRITE, [this, value]() noexcept { return target.write(value); });
+    }
+};
+
+/**
+ * Input pin group instrumenting the reads and the bursts of another one ; a burst is forwarded to `readSamples()` of
+ * the instrumented group, so that its own loop is kept, and is counted once. The static groups (e.g.
+ * `StaticInputPinGroup`) take the instrumentation policy directly instead.
+ *
+ * @param N the size of the group.
+ * @param Instrumentation the instrumentation policy, e.g. `CountingInstrumentation`.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N, typename Instrumentation>
+class InstrumentedInputPinGroup final : public InputPinGroup<N> {
+  public:
+    ~InstrumentedInputPinGroup() noexcept {}
+
+    /**
+     * Fully define an instrumented input pin group.
+     *
+     * @param source the group to instrument, the pin ids are the same.
+     */
+    InstrumentedInputPinGroup(InputPinGroup<N>& source) noexcept : InputPinGroup<N>(source.getPinIds()), source(source) {}
+
+    /**
+     * Access to the instrumentation policy, e.g. to register its statistics.
+     */
+    Instrumentation& getInstrumentation() noexcept { return instrumentation; }
+
+  private:
+    InputPinGroup<N>& source;
+    [[no_unique_address]] Instrumentation instrumentation;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<std::bitset<N>, IoFailureReason> doRead() noexcept {
+        return instrumentOperation(instrumentation, PIN_OPERATION_READ, [this]() noexcept { return source.read(); });
+    }
+    virtual std::expected<void, IoFailureReason> doReadSamples(std::span<std::bitset<N>> samples, typename InputPinGroup<N>::Pacing pacing,
+                                                               void* context) noexcept {
+        return instrumentOperation(instrumentation, PIN_OPERATION_READ_BURST,
+                                   [this, samples, pacing, context]() noexcept { return source.readSamples(samples, pacing, context); });
+    }
+};
+
+/**
+ * Output pin group instrumenting the writes and the sequences of another one ; a sequence is forwarded to
+ * `writeSequence()` of the instrumented group, so that its own loop is kept, and is counted once. The static groups
+ * (e.g. `StaticOutputPinGroup`) take the instrumentation policy directly instead.
+ *
+ * @param N the size of the group.
+ * @param Instrumentation the instrumentation policy, e.g. `CountingInstrumentation`.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N, typename Instrumentation>
+class InstrumentedOutputPinGroup final : public OutputPinGroup<N> {
+  public:
+    ~InstrumentedOutputPinGroup() noexcept {}
+
+    /**
+     * Fully define an instrumented output pin group.
+     *
+     * @param target the group to instrument, the pin ids are the same.
+     */
+    InstrumentedOutputPinGroup(OutputPinGroup<N>& target) noexcept : OutputPinGroup<N>(target.getPinIds()), target(target) {}
+
+    /**
+     * Access to the instrumentation policy, e.g. to register its statistics.
+     */
+    Instrumentation& getInstrumentation() noexcept { return instrumentation; }
+
+  private:
+    OutputPinGroup<N>& target;
+    [[no_unique_address]] Instrumentation instrumentation;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<void, IoFailureReason> doWrite(const std::bitset<N> value) noexcept {
+        return instrumentOperation(instrumentation, PIN_OPERATION_WRITE, [this, value]() noexcept { return target.write(value); });
+    }
+    virtual std::expected<void, IoFailureReason> doWriteSequence(std::span<const std::bitset<N>> values, typename OutputPinGroup<N>::Pacing pacing,
+                                                                 void* context) noexcept {
+        return instrumentOperation(instrumentation, PIN_OPERATION_WRITE_BURST,
+                                   [this, values, pacing, context]() noexcept { return target.writeSequence(values, pacing, context); });
+    }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
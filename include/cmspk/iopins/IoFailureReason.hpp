@@ -31,7 +31,15 @@ enum IoFailureReason {
     FAILURE_PIN_IS_DISABLED,
     FAILURE_PIN_IS_NOT_WRITABLE,
     FAILURE_PIN_IS_NOT_READABLE,
-    FAILURE_IMMUTABLE_DIRECTION
+    FAILURE_IMMUTABLE_DIRECTION,
+    /**
+     * A device on a bus did not acknowledge, e.g. an I2C target.
+     */
+    FAILURE_NO_ACKNOWLEDGE,
+    /**
+     * An awaited condition did not happen in time, e.g. an I2C target stretching the clock for too long.
+     */
+    FAILURE_TIMEOUT
     // etc...
 };
 
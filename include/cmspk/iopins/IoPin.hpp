@@ -0,0 +1,77 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__IO_PIN__HPP
+#define CMSPK__IOPINS__IO_PIN__HPP
+
+// standard includes
+#include <cstdint>
+#include <expected>
+
+// dependencies includes
+#include "cmspk/ucdev.hpp"
+
+// project includes
+#include "cmspk/iopins/CachedIoDirection.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/ucdev/OutputValueDevice.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * An abstraction of bidirectional pins, with a value represented by the given type, that can be reconfigured at
+ * runtime : the pin is readable in `READ` direction, writable in `WRITE` direction, disabled in `HIGH_Z` direction.
+ *
+ * A specialization MUST implement `doSetDirection()`, `doRead()` and `doWrite()` ; the direction is checked before
+ * reading or writing.
+ *
+ * @param S storage type for the value, typically a `bool` or an `uint8_t`
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename S>
+class IoPin : public cmspk::ucdev::InputValueDevice<S, IoFailureReason>,
+              public cmspk::ucdev::OutputValueDevice<S, IoFailureReason>,
+              public CachedIoDirection {
+  public:
+    ~IoPin() noexcept {}
+
+    /**
+     * Fully define a bidirectional pin, disabled until the first change of direction.
+     *
+     * @param id the native identification number of the pin.
+     */
+    IoPin(uint8_t id) noexcept : id(id) {}
+
+    /**
+     * Get the pin id for the underlying microcontroller/board.
+     */
+    uint8_t getPinId() const noexcept { return id; }
+
+  private:
+    uint8_t id;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept final { return checkReadDirection(); }
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept final { return checkWriteDirection(); }
+};
+
+/**
+ * Specialization of bidirectional pins using a single bit (`bool`) to represent its values.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+using BinaryIoPin = IoPin<bool>;
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
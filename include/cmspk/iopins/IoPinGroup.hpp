@@ -0,0 +1,80 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__IO_PIN_GROUP__HPP
+#define CMSPK__IOPINS__IO_PIN_GROUP__HPP
+
+// standard includes
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+
+// dependencies includes
+#include "cmspk/ucdev.hpp"
+
+// project includes
+#include "cmspk/iopins/CachedIoDirection.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/ucdev/OutputValueDevice.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * An abstraction of a group of bidirectional binary (true/false) pins of a given size, read or written all at once, and
+ * turned around all at once, e.g. the data lines of a shared bus.
+ *
+ * A specialization MUST implement `doSetDirection()` as a single mask operation on the pins, `doRead()` and
+ * `doWrite()` ; the direction is checked before reading or writing.
+ *
+ * @param N the size of the group.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N>
+class IoPinGroup : public cmspk::ucdev::InputValueDevice<std::bitset<N>, IoFailureReason>,
+                   public cmspk::ucdev::OutputValueDevice<std::bitset<N>, IoFailureReason>,
+                   public CachedIoDirection {
+  public:
+    ~IoPinGroup() noexcept {}
+
+    /**
+     * Fully define a group of bidirectional pins, disabled until the first change of direction.
+     *
+     * @param ids the N native identification numbers of the pins.
+     */
+    IoPinGroup(std::array<uint8_t, N> ids) noexcept : ids(ids) {}
+
+    /**
+     * Get the pin ids for the underlying microcontroller/board.
+     */
+    std::array<uint8_t, N> getPinIds() const noexcept { return ids; }
+
+  private:
+    std::array<uint8_t, N> ids;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept final { return checkReadDirection(); }
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept final { return checkWriteDirection(); }
+};
+
+/**
+ * Alias for a group of bidirectional pins with 8 members.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+using IoPinOctet = IoPinGroup<8>;
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
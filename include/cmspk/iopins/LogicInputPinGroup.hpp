@@ -0,0 +1,137 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__LOGIC_INPUT_PIN_GROUP__HPP
+#define CMSPK__IOPINS__LOGIC_INPUT_PIN_GROUP__HPP
+
+// standard includes
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/InputPinGroup.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/LogicIoPinSetting.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Abstraction of a group of input pins that can each be **asserted/active** or **negated/inactive**.
+ *
+ * The **raw** value is accessible through `read()` ; the **logic** value is accessible through `readLogic()` and the
+ * wrappers `isAsserted()`/`isNegated()`. The logic settings of the pins are packed into a polarity mask, so that the
+ * conversion is a single XOR whatever the size of the group.
+ *
+ * The logic settings can be changed.
+ *
+ * @param N the size of the group.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N>
+class LogicInputPinGroup : public InputPinGroup<N> {
+  public:
+    ~LogicInputPinGroup() noexcept {}
+
+    /**
+     * Fully define a group of logic input pins sharing the same logic setting.
+     *
+     * @param ids the N native identification numbers of the pins.
+     * @param logicSetting **optionnal**, the initial logic setting of every pin.
+     */
+    LogicInputPinGroup(std::array<uint8_t, N> ids, LogicIoPinSetting logicSetting = LogicIoPinSetting::ACTIVE_HIGH) noexcept
+        : InputPinGroup<N>(ids), polarityMask(LogicIoPinSetting::ACTIVE_LOW == logicSetting ? std::bitset<N>().set() : std::bitset<N>()) {}
+
+    /**
+     * Fully define a group of logic input pins.
+     *
+     * @param ids the N native identification numbers of the pins.
+     * @param logicSettings the initial logic setting of each pin.
+     */
+    LogicInputPinGroup(std::array<uint8_t, N> ids, const std::array<LogicIoPinSetting, N>& logicSettings) noexcept
+        : InputPinGroup<N>(ids), polarityMask(polarityMaskOf(logicSettings)) {}
+
+    /**
+     * Get the polarity mask, the bits of the `ACTIVE_LOW` pins are set.
+     */
+    std::bitset<N> getPolarityMask() const noexcept { return polarityMask; }
+
+    /**
+     * Get the logic setting of a pin.
+     *
+     * @param index the index of the pin in the group.
+     */
+    LogicIoPinSetting getLogicSetting(std::size_t index) const noexcept {
+        return polarityMask[index] ? LogicIoPinSetting::ACTIVE_LOW : LogicIoPinSetting::ACTIVE_HIGH;
+    }
+
+    /**
+     * Change the logic setting of a pin.
+     *
+     * @param index the index of the pin in the group.
+     * @param logicSetting the new value.
+     */
+    void setLogicSetting(std::size_t index, LogicIoPinSetting logicSetting) noexcept { polarityMask.set(index, LogicIoPinSetting::ACTIVE_LOW == logicSetting); }
+
+    /**
+     * Change the logic settings of all the pins.
+     *
+     * @param logicSettings the new values.
+     */
+    void setLogicSettings(const std::array<LogicIoPinSetting, N>& logicSettings) noexcept { polarityMask = polarityMaskOf(logicSettings); }
+
+    /**
+     * Read operation, the group MUST be readable to be able to succeed.
+     *
+     * @returns the result of the read operation, the logic value of each pin.
+     */
+    std::expected<std::bitset<N>, IoFailureReason> readLogic() noexcept {
+        std::expected<std::bitset<N>, IoFailureReason> rawRead = this->read();
+        if (rawRead.has_value()) {
+            return rawRead.value() ^ polarityMask;
+        }
+        return rawRead;
+    }
+
+    /**
+     * Wrapper calling `readLogic()` and asserting whether all the given pins are asserted, **SHOULD be called ONLY when
+     * the group is readable**.
+     *
+     * @param mask **optionnal**, the pins to check, all by default.
+     * @returns `true` only when the group is readable and all the given pins are asserted.
+     */
+    bool isAsserted(const std::bitset<N>& mask = std::bitset<N>().set()) noexcept {
+        std::expected<std::bitset<N>, IoFailureReason> result = readLogic();
+        return result.has_value() && (result.value() & mask) == mask;
+    }
+
+    /**
+     * Wrapper calling `readLogic()` and asserting whether all the given pins are negated, **SHOULD be called ONLY when
+     * the group is readable**.
+     *
+     * @param mask **optionnal**, the pins to check, all by default.
+     * @returns `true` only when the group is readable and all the given pins are negated.
+     */
+    bool isNegated(const std::bitset<N>& mask = std::bitset<N>().set()) noexcept {
+        std::expected<std::bitset<N>, IoFailureReason> result = readLogic();
+        return result.has_value() && (result.value() & mask).none();
+    }
+
+  private:
+    std::bitset<N> polarityMask;
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
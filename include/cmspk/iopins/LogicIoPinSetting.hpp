@@ -10,6 +10,11 @@ A C++ abstraction layer for I/O pins of micro-controllers.
 #ifndef CMSPK__IOPINS__LOGIC_IO_PIN_SETTING__HPP
 #define CMSPK__IOPINS__LOGIC_IO_PIN_SETTING__HPP
 
+// standard includes
+#include <array>
+#include <bitset>
+#include <cstddef>
+
 namespace cmspk::iopins {
 // ================[ CODE BEGINS ]================
 /**
@@ -25,6 +30,24 @@ enum LogicIoPinSetting {
      */
     ACTIVE_HIGH
 };
+
+/**
+ * Pack the logic settings of a group of pins into a polarity mask, where the bits of the `ACTIVE_LOW` pins are set ;
+ * the logic value of the group is then the raw value XOR the mask, and conversely.
+ *
+ * @param settings the logic setting of each pin.
+ * @returns the polarity mask.
+ */
+template <std::size_t N>
+constexpr std::bitset<N> polarityMaskOf(const std::array<LogicIoPinSetting, N>& settings) noexcept {
+    std::bitset<N> mask;
+    for (std::size_t i = 0; i < N; ++i) {
+        if (LogicIoPinSetting::ACTIVE_LOW == settings[i]) {
+            mask.set(i);
+        }
+    }
+    return mask;
+}
 // ================[ END OF CODE ]================
 };  // namespace cmspk::iopins
 #endif
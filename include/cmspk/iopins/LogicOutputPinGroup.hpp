@@ -0,0 +1,137 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__LOGIC_OUTPUT_PIN_GROUP__HPP
+#define CMSPK__IOPINS__LOGIC_OUTPUT_PIN_GROUP__HPP
+
+// standard includes
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/LogicIoPinSetting.hpp"
+#include "cmspk/iopins/OutputPinGroup.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Abstraction of a group of output pins that can each be **asserted/active** or **negated/inactive**.
+ *
+ * The **raw** value is written through `write()` ; the **logic** value is written through `writeLogic()` and the
+ * wrappers `assertMask()`/`negateMask()`. The logic settings of the pins are packed into a polarity mask, so that the
+ * conversion is a single XOR whatever the size of the group.
+ *
+ * The group remembers the last logic value successfully written through `writeLogic()` and its wrappers, initially
+ * all the pins negated ; a raw `write()` is not tracked.
+ *
+ * @param N the size of the group.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N>
+class LogicOutputPinGroup : public OutputPinGroup<N> {
+  public:
+    ~LogicOutputPinGroup() noexcept {}
+
+    /**
+     * Fully define a group of logic output pins sharing the same logic setting.
+     *
+     * @param ids the N native identification numbers of the pins.
+     * @param logicSetting **optionnal**, the initial logic setting of every pin.
+     */
+    LogicOutputPinGroup(std::array<uint8_t, N> ids, LogicIoPinSetting logicSetting = LogicIoPinSetting::ACTIVE_HIGH) noexcept
+        : OutputPinGroup<N>(ids), polarityMask(LogicIoPinSetting::ACTIVE_LOW == logicSetting ? std::bitset<N>().set() : std::bitset<N>()) {}
+
+    /**
+     * Fully define a group of logic output pins.
+     *
+     * @param ids the N native identification numbers of the pins.
+     * @param logicSettings the initial logic setting of each pin.
+     */
+    LogicOutputPinGroup(std::array<uint8_t, N> ids, const std::array<LogicIoPinSetting, N>& logicSettings) noexcept
+        : OutputPinGroup<N>(ids), polarityMask(polarityMaskOf(logicSettings)) {}
+
+    /**
+     * Get the polarity mask, the bits of the `ACTIVE_LOW` pins are set.
+     */
+    std::bitset<N> getPolarityMask() const noexcept { return polarityMask; }
+
+    /**
+     * Get the logic setting of a pin.
+     *
+     * @param index the index of the pin in the group.
+     */
+    LogicIoPinSetting getLogicSetting(std::size_t index) const noexcept {
+        return polarityMask[index] ? LogicIoPinSetting::ACTIVE_LOW : LogicIoPinSetting::ACTIVE_HIGH;
+    }
+
+    /**
+     * Change the logic setting of a pin, effective at the next write.
+     *
+     * @param index the index of the pin in the group.
+     * @param logicSetting the new value.
+     */
+    void setLogicSetting(std::size_t index, LogicIoPinSetting logicSetting) noexcept { polarityMask.set(index, LogicIoPinSetting::ACTIVE_LOW == logicSetting); }
+
+    /**
+     * Change the logic settings of all the pins, effective at the next write.
+     *
+     * @param logicSettings the new values.
+     */
+    void setLogicSettings(const std::array<LogicIoPinSetting, N>& logicSettings) noexcept { polarityMask = polarityMaskOf(logicSettings); }
+
+    /**
+     * Get the last logic value written.
+     */
+    std::bitset<N> getLogicState() const noexcept { return logicState; }
+
+    /**
+     * Write operation, the group MUST be writable to be able to succeed.
+     *
+     * @param value the logic value of each pin.
+     * @returns the result of the write operation.
+     */
+    std::expected<void, IoFailureReason> writeLogic(const std::bitset<N> value) noexcept {
+        std::expected<void, IoFailureReason> result = this->write(value ^ polarityMask);
+        if (result.has_value()) {
+            logicState = value;
+        }
+        return result;
+    }
+
+    /**
+     * Assert the given pins, the other pins keep their logic value.
+     *
+     * @param mask the pins to assert.
+     * @returns the result of the write operation.
+     */
+    std::expected<void, IoFailureReason> assertMask(const std::bitset<N> mask) noexcept { return writeLogic(logicState | mask); }
+
+    /**
+     * Negate the given pins, the other pins keep their logic value.
+     *
+     * @param mask the pins to negate.
+     * @returns the result of the write operation.
+     */
+    std::expected<void, IoFailureReason> negateMask(const std::bitset<N> mask) noexcept { return writeLogic(logicState & ~mask); }
+
+  private:
+    std::bitset<N> polarityMask;
+    std::bitset<N> logicState;
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,218 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__MATRIX_SCANNER__HPP
+#define CMSPK__IOPINS__MATRIX_SCANNER__HPP
+
+// standard includes
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <optional>
+
+// project includes
+#include "cmspk/iopins/InputPinGroup.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/LogicIoPinSetting.hpp"
+#include "cmspk/iopins/OutputPinGroup.hpp"
+#include "cmspk/iopins/SetBitRange.hpp"
+#include "cmspk/iopins/VerticalCounterDebouncer.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * A change of state of a key of a matrix.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+struct KeyEvent {
+    uint8_t row;
+    uint8_t column;
+    /**
+     * `true` when the key has been pressed, `false` when it has been released.
+     */
+    bool pressed;
+};
+
+/**
+ * Scanner of a keyboard matrix, selecting the rows one at a time through an output pin group and sampling the columns
+ * through an input pin group.
+ *
+ * Each `scan()` builds a frame of the state of all the keys, packed in a `std::bitset<Rows * Cols>` where the key at
+ * (`row`, `column`) is the bit `row * Cols + column`. Then :
+ *
+ * * when two rows have at least two pressed columns in common, a phantom key may appear (ghosting), and the frame
+ *   keeps the previous values of those rows ;
+ * * the frame is debounced, all the keys at once ;
+ * * the changes of the debounced state are queued as `KeyEvent`s, to be retrieved with `pollEvent()`.
+ *
+ * @param Rows the number of rows.
+ * @param Cols the number of columns, up to 64.
+ * @param Samples the number of consecutive samples required to accept a change of a key.
+ * @param EventCapacity the capacity of the event queue, when full, new events are dropped.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t Rows, std::size_t Cols, std::size_t Samples = 4, std::size_t EventCapacity = 32>
+class MatrixScanner {
+    static_assert(Cols <= 64, "Cols MUST NOT exceed 64");
+    static_assert(Rows <= 256 && EventCapacity > 0);
+
+  public:
+    /**
+     * Number of keys.
+     */
+    static constexpr std::size_t KEYS = Rows * Cols;
+
+    ~MatrixScanner() noexcept {}
+
+    /**
+     * Fully define a matrix scanner.
+     *
+     * @param rows the group selecting the rows.
+     * @param columns the group sampling the columns.
+     * @param rowSetting **optionnal**, how a row is selected, i.e. driven low by default.
+     * @param columnSetting **optionnal**, how a pressed key is read on its column, i.e. low by default.
+     */
+    MatrixScanner(OutputPinGroup<Rows>& rows, InputPinGroup<Cols>& columns, LogicIoPinSetting rowSetting = LogicIoPinSetting::ACTIVE_LOW,
+                  LogicIoPinSetting columnSetting = LogicIoPinSetting::ACTIVE_LOW) noexcept
+        : rows(rows), columns(columns), rowInversion((LogicIoPinSetting::ACTIVE_LOW == rowSetting) ? ~std::bitset<Rows>() : std::bitset<Rows>()),
+          columnInversion((LogicIoPinSetting::ACTIVE_LOW == columnSetting) ? ~std::bitset<Cols>() : std::bitset<Cols>()) {}
+
+    /**
+     * Scan all the rows once, update the state of the keys and queue the changes.
+     *
+     * The rows are all deselected at the end of the scan, and also when a failure occurs.
+     *
+     * @returns the result of the operation, the state of the keys is unchanged on failure.
+     */
+    std::expected<void, IoFailureReason> scan() noexcept {
+        std::array<std::bitset<Cols>, Rows> frame;
+        for (std::size_t r = 0; r < Rows; ++r) {
+            std::expected<void, IoFailureReason> selected = rows.write(rowInversion ^ std::bitset<Rows>().set(r));
+            if (!selected.has_value()) {
+                rows.write(rowInversion);
+                return selected;
+            }
+            std::expected<std::bitset<Cols>, IoFailureReason> sampled = columns.read();
+            if (!sampled.has_value()) {
+                rows.write(rowInversion);
+                return std::unexpected(sampled.error());
+            }
+            frame[r] = sampled.value() ^ columnInversion;
+        }
+        std::expected<void, IoFailureReason> deselected = rows.write(rowInversion);
+        if (!deselected.has_value()) {
+            return deselected;
+        }
+
+        // ghosting : keep the previous values of rows having at least 2 pressed columns in common
+        ghosting = false;
+        std::bitset<Rows> ghostRows;
+        for (std::size_t r = 0; r < Rows; ++r) {
+            for (std::size_t other = r + 1; other < Rows; ++other) {
+                if ((frame[r] & frame[other]).count() > 1) {
+                    ghostRows.set(r).set(other);
+                }
+            }
+        }
+        std::bitset<KEYS> packed;
+        for (std::size_t r = Rows; r-- > 0;) {
+            if (ghostRows[r]) {
+                ghosting = true;
+                frame[r] = previousFrame[r];
+            }
+            packed <<= Cols;
+            packed |= std::bitset<KEYS>(frame[r].to_ullong());
+        }
+        previousFrame = frame;
+
+        // debounce and queue the changes
+        std::bitset<KEYS> state = debouncer.sample(packed);
+        std::bitset<KEYS> changed = state ^ keys;
+        keys = state;
+        if (changed.any()) {
+            for (std::size_t index : SetBitRange<KEYS>(changed)) {
+                pushEvent(KeyEvent{static_cast<uint8_t>(index / Cols), static_cast<uint8_t>(index % Cols), state[index]});
+            }
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+
+    /**
+     * Get the debounced state of all the keys, the key at (`row`, `column`) is the bit `row * Cols + column`.
+     */
+    const std::bitset<KEYS>& getKeyStates() const noexcept { return keys; }
+
+    /**
+     * Tells whether the given key is pressed, according to the debounced state.
+     */
+    bool isPressed(std::size_t row, std::size_t column) const noexcept { return keys[row * Cols + column]; }
+
+    /**
+     * Tells whether ghosting was detected during the last scan.
+     */
+    bool isGhostingDetected() const noexcept { return ghosting; }
+
+    /**
+     * Retrieve the oldest queued event, if any.
+     */
+    std::optional<KeyEvent> pollEvent() noexcept {
+        if (0 == eventCount) {
+            return std::nullopt;
+        }
+        KeyEvent event = events[eventHead];
+        eventHead = (eventHead + 1) % EventCapacity;
+        --eventCount;
+        return event;
+    }
+
+    /**
+     * Get the number of queued events.
+     */
+    std::size_t getPendingEventCount() const noexcept { return eventCount; }
+
+    /**
+     * Get the number of events dropped because the queue was full.
+     */
+    std::size_t getDroppedEventCount() const noexcept { return droppedEvents; }
+
+  private:
+    OutputPinGroup<Rows>& rows;
+    InputPinGroup<Cols>& columns;
+    std::bitset<Rows> rowInversion;
+    std::bitset<Cols> columnInversion;
+    std::array<std::bitset<Cols>, Rows> previousFrame{};
+    VerticalCounterDebouncer<KEYS, Samples> debouncer;
+    std::bitset<KEYS> keys;
+    bool ghosting = false;
+    std::array<KeyEvent, EventCapacity> events{};
+    std::size_t eventHead = 0;
+    std::size_t eventCount = 0;
+    std::size_t droppedEvents = 0;
+
+    void pushEvent(const KeyEvent& event) noexcept {
+        if (EventCapacity == eventCount) {
+            ++droppedEvents;
+            return;
+        }
+        events[(eventHead + eventCount) % EventCapacity] = event;
+        ++eventCount;
+    }
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
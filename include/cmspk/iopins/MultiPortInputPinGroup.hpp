@@ -0,0 +1,122 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__MULTI_PORT_INPUT_PIN_GROUP__HPP
+#define CMSPK__IOPINS__MULTI_PORT_INPUT_PIN_GROUP__HPP
+
+// standard includes
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/BitsetWords.hpp"
+#include "cmspk/iopins/InputPinGroup.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/PortSlice.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * A group of binary input pins spanning several ports, e.g. a wide parallel bus, with one slice of consecutive pins
+ * per port.
+ *
+ * A read accesses each port once, even when several slices share a port, all the ports being read back to back before
+ * assembling the value of the group, to keep the skew between ports low. The implementation only has to provide
+ * `checkReadability()` and `doReadPort()`.
+ *
+ * @param N the size of the group, e.g. up to 128 pins.
+ * @param Ports the number of slices, usually one per port.
+ * @param W the unsigned integer type of the port register word.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N, std::size_t Ports, typename W = uint32_t>
+class MultiPortInputPinGroup : public InputPinGroup<N> {
+  public:
+    /**
+     * Number of 64 bits words of the group.
+     */
+    static constexpr std::size_t WORDS = bitsetWordCount<uint64_t, N>;
+
+    ~MultiPortInputPinGroup() noexcept {}
+
+    /**
+     * Fully define a multi-port input pin group.
+     *
+     * @param layout the slices of the group, the counts of the slices MUST add up to N and the slices MUST fit inside the
+     * port register word.
+     */
+    MultiPortInputPinGroup(const PortSliceLayout<N, Ports, W>& layout) noexcept : InputPinGroup<N>(layout.getPinIds()), layout(layout) {}
+
+    /**
+     * Get the layout of the group.
+     */
+    const PortSliceLayout<N, Ports, W>& getLayout() const noexcept { return layout; }
+
+    /**
+     * Read the group as native words, see `toWords()`.
+     *
+     * @param V **optionnal**, the unsigned integer type of the words, up to 64 bits wide.
+     * @returns the result of the read operation.
+     */
+    template <typename V = uint64_t>
+    std::expected<std::array<V, bitsetWordCount<V, N>>, IoFailureReason> readWords() noexcept {
+        std::expected<std::bitset<N>, IoFailureReason> bits = this->read();
+        if (!bits.has_value()) {
+            return std::unexpected(bits.error());
+        }
+        return toWords<V>(bits.value());
+    }
+
+  private:
+    PortSliceLayout<N, Ports, W> layout;
+
+    /**
+     * Read a whole port register.
+     *
+     * @param port the index of the port.
+     * @returns the value of the port register word.
+     */
+    virtual std::expected<W, IoFailureReason> doReadPort(uint8_t port) noexcept = 0;
+
+    virtual std::expected<std::bitset<N>, IoFailureReason> doRead() noexcept final {
+        std::array<W, Ports> raw;
+        for (std::size_t s = 0; s < Ports; ++s) {
+            if (layout.getOwner(s) != s) {
+                continue;
+            }
+            std::expected<W, IoFailureReason> word = doReadPort(layout.getSlice(s).port);
+            if (!word.has_value()) {
+                return std::unexpected(word.error());
+            }
+            raw[s] = word.value();
+        }
+        std::array<uint64_t, WORDS> words{};
+        for (std::size_t s = 0; s < Ports; ++s) {
+            const PortSlice& slice = layout.getSlice(s);
+            const uint64_t value = (static_cast<uint64_t>(raw[layout.getOwner(s)]) >> slice.firstBit) & PortSliceLayout<N, Ports, W>::lowMask(slice.count);
+            const std::size_t offset = layout.getOffset(s);
+            const std::size_t shift = offset % 64;
+            words[offset / 64] |= value << shift;
+            if (shift + slice.count > 64 && offset / 64 + 1 < WORDS) {
+                words[offset / 64 + 1] |= value >> (64 - shift);
+            }
+        }
+        return fromWords<N>(words);
+    }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,125 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__MULTI_PORT_OUTPUT_PIN_GROUP__HPP
+#define CMSPK__IOPINS__MULTI_PORT_OUTPUT_PIN_GROUP__HPP
+
+// standard includes
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/BitsetWords.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/OutputPinGroup.hpp"
+#include "cmspk/iopins/PortSlice.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * A group of binary output pins spanning several ports, e.g. a wide parallel bus, with one slice of consecutive pins
+ * per port.
+ *
+ * A write computes the value of every port first, then writes the ports back to back with one masked write per port,
+ * even when several slices share a port, to keep the skew between ports low. The implementation only has to provide
+ * `checkWritability()` and `doWritePort()`.
+ *
+ * @param N the size of the group, e.g. up to 128 pins.
+ * @param Ports the number of slices, usually one per port.
+ * @param W the unsigned integer type of the port register word.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N, std::size_t Ports, typename W = uint32_t>
+class MultiPortOutputPinGroup : public OutputPinGroup<N> {
+  public:
+    /**
+     * Number of 64 bits words of the group.
+     */
+    static constexpr std::size_t WORDS = bitsetWordCount<uint64_t, N>;
+
+    ~MultiPortOutputPinGroup() noexcept {}
+
+    /**
+     * Fully define a multi-port output pin group.
+     *
+     * @param layout the slices of the group, the counts of the slices MUST add up to N and the slices MUST fit inside the
+     * port register word.
+     */
+    MultiPortOutputPinGroup(const PortSliceLayout<N, Ports, W>& layout) noexcept : OutputPinGroup<N>(layout.getPinIds()), layout(layout) {
+        for (std::size_t s = 0; s < Ports; ++s) {
+            masks[layout.getOwner(s)] |= layout.getMask(s);
+        }
+    }
+
+    /**
+     * Get the layout of the group.
+     */
+    const PortSliceLayout<N, Ports, W>& getLayout() const noexcept { return layout; }
+
+    /**
+     * Write the group from native words, see `fromWords()`.
+     *
+     * @param V **optionnal**, the unsigned integer type of the words, up to 64 bits wide.
+     * @param words the value of the group.
+     * @returns the result of the write operation.
+     */
+    template <typename V = uint64_t>
+    std::expected<void, IoFailureReason> writeWords(const std::array<V, bitsetWordCount<V, N>>& words) noexcept {
+        return this->write(fromWords<N>(words));
+    }
+
+  private:
+    PortSliceLayout<N, Ports, W> layout;
+    std::array<W, Ports> masks{};
+
+    /**
+     * Write some pins of a port register.
+     *
+     * @param port the index of the port.
+     * @param mask the pins to write.
+     * @param values the values of the pins to write.
+     * @returns the result of the write operation.
+     */
+    virtual std::expected<void, IoFailureReason> doWritePort(uint8_t port, W mask, W values) noexcept = 0;
+
+    virtual std::expected<void, IoFailureReason> doWrite(const std::bitset<N> value) noexcept final {
+        const std::array<uint64_t, WORDS> words = toWords<uint64_t>(value);
+        std::array<W, Ports> values{};
+        for (std::size_t s = 0; s < Ports; ++s) {
+            const PortSlice& slice = layout.getSlice(s);
+            const std::size_t offset = layout.getOffset(s);
+            const std::size_t shift = offset % 64;
+            uint64_t bits = words[offset / 64] >> shift;
+            if (shift + slice.count > 64 && offset / 64 + 1 < WORDS) {
+                bits |= words[offset / 64 + 1] << (64 - shift);
+            }
+            values[layout.getOwner(s)] |= static_cast<W>((bits & PortSliceLayout<N, Ports, W>::lowMask(slice.count)) << slice.firstBit);
+        }
+        for (std::size_t s = 0; s < Ports; ++s) {
+            if (layout.getOwner(s) != s) {
+                continue;
+            }
+            std::expected<void, IoFailureReason> result = doWritePort(layout.getSlice(s).port, masks[s], values[s]);
+            if (!result.has_value()) {
+                return result;
+            }
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
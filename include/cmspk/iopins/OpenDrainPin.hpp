@@ -0,0 +1,106 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__OPEN_DRAIN_PIN__HPP
+#define CMSPK__IOPINS__OPEN_DRAIN_PIN__HPP
+
+// standard includes
+#include <cstdint>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/CachedIoDirection.hpp"
+#include "cmspk/iopins/IoDirection.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Open-drain line emulated by switching the direction of a pin whose output latch is low : the `READ` direction
+ * releases the line (pulled high by a resistor unless another device pulls it low), the `WRITE` direction drives the
+ * line low, the `HIGH_Z` direction disables the pin.
+ *
+ * The last direction set is remembered by a `CachedIoDirection`, so that setting the same direction again does not
+ * access the pin ; the level of the line can be read in both `READ` and `WRITE` direction.
+ *
+ * A specialization MUST implement `doSetDirection()`, that ensures the output latch is low when switching to `WRITE`,
+ * and `doRead()`.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class OpenDrainPin : private CachedIoDirection {
+  public:
+    ~OpenDrainPin() noexcept {}
+
+    /**
+     * Fully define an open-drain pin, its direction is unknown until the first change.
+     *
+     * @param id the native identification number of the pin.
+     */
+    OpenDrainPin(uint8_t id) noexcept : id(id) {}
+
+    /**
+     * Get the pin id for the underlying microcontroller/board.
+     */
+    uint8_t getPinId() const noexcept { return id; }
+
+    using CachedIoDirection::getDirection;
+    using CachedIoDirection::invalidateDirection;
+
+    /**
+     * Release the line, i.e. switch to `READ` direction.
+     */
+    std::expected<void, IoFailureReason> release() noexcept { return setDirection(IoDirection::READ); }
+
+    /**
+     * Drive the line low, i.e. switch to `WRITE` direction.
+     */
+    std::expected<void, IoFailureReason> driveLow() noexcept { return setDirection(IoDirection::WRITE); }
+
+    /**
+     * Release the line when the given level is high, drive it low otherwise.
+     */
+    std::expected<void, IoFailureReason> set(bool level) noexcept { return level ? release() : driveLow(); }
+
+    /**
+     * Disable the pin, i.e. switch to `HIGH_Z` direction.
+     */
+    std::expected<void, IoFailureReason> disable() noexcept { return setDirection(IoDirection::HIGH_Z); }
+
+    /**
+     * Read the level of the line, the pin MUST NOT be disabled.
+     *
+     * @returns the result of the read operation.
+     */
+    std::expected<bool, IoFailureReason> read() noexcept {
+        if (isDirectionKnown() && isDisabled()) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_DISABLED);
+        }
+        return doRead();
+    }
+
+  private:
+    uint8_t id;
+
+    /**
+     * Change the direction of the pin, the output latch MUST be low in `WRITE` direction.
+     */
+    virtual std::expected<void, IoFailureReason> doSetDirection(IoDirection value) noexcept = 0;
+
+    /**
+     * Read the level of the line.
+     */
+    virtual std::expected<bool, IoFailureReason> doRead() noexcept = 0;
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
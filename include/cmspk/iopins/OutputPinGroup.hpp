@@ -16,6 +16,7 @@ A C++ abstraction layer for input pins of micro-controllers.
 #include <cstddef>
 #include <cstdint>
 #include <expected>
+#include <span>
 
 // dependencies includes
 #include "cmspk/ucdev.hpp"
@@ -38,6 +39,12 @@ namespace cmspk::iopins {
 template <std::size_t N>
 class OutputPinGroup : public cmspk::ucdev::OutputValueDevice<std::bitset<N>, IoFailureReason>, public cmspk::ucdev::SimpleWritableDeviceAssertions {
   public:
+    /**
+     * Function called after each sample of a sequence, to pace it, with the context given along with it ; none means
+     * as fast as possible.
+     */
+    using Pacing = void (*)(void* context);
+
     ~OutputPinGroup() noexcept {}
 
     /**
@@ -52,8 +59,37 @@ class OutputPinGroup : public cmspk::ucdev::OutputValueDevice<std::bitset<N>, Io
      */
     std::array<uint8_t, N> getPinIds() const noexcept { return ids; }
 
+    /**
+     * Write a sequence of samples, e.g. to output a waveform.
+     *
+     * @param values the samples to write, in order.
+     * @param pacing **optionnal**, the function called after each sample.
+     * @param context **optionnal**, the context given to the pacing function.
+     * @returns the result of the output, that stops at the first failure.
+     */
+    std::expected<void, IoFailureReason> writeSequence(std::span<const std::bitset<N>> values, Pacing pacing = nullptr, void* context = nullptr) noexcept {
+        return doWriteSequence(values, pacing, context);
+    }
+
   private:
     std::array<uint8_t, N> ids;
+
+    /**
+     * Write a sequence of samples, by default one `write()` per sample ; an implementation MAY override it with a
+     * tighter loop, e.g. checking the writability once.
+     */
+    virtual std::expected<void, IoFailureReason> doWriteSequence(std::span<const std::bitset<N>> values, Pacing pacing, void* context) noexcept {
+        for (const std::bitset<N>& value : values) {
+            std::expected<void, IoFailureReason> result = this->write(value);
+            if (!result.has_value()) {
+                return result;
+            }
+            if (nullptr != pacing) {
+                pacing(context);
+            }
+        }
+        return std::expected<void, IoFailureReason>();
+    }
 };
 
 /**
@@ -0,0 +1,280 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__OUTPUT_TRANSACTION__HPP
+#define CMSPK__IOPINS__OUTPUT_TRANSACTION__HPP
+
+// standard includes
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <initializer_list>
+
+// project includes
+#include "cmspk/iopins/IoFailureReason.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+class OutputTransaction;
+
+/**
+ * An output port of a micro-controller, shared by the pins bound to it (`PortOutputPin`, `PortLogicOutputPin`), that
+ * can defer their writes into an `OutputTransaction`.
+ *
+ * Outside of a transaction, a pin write is one masked write of the port. The port keeps a shadow of the outputs it
+ * successfully wrote, so that a transaction can drop the writes that would not change anything ; the shadow is empty at
+ * first, and `invalidate()` empties it, e.g. when something else writes the port.
+ *
+ * A specialization MUST implement `doCheckWritable()` and `doWriteMasked()`, the latter being a single write of the
+ * pins of the mask, e.g. through a set/reset register (BSRR) so that they all change at once ; the values outside of
+ * the mask MUST be ignored.
+ *
+ * A port destroyed while in a transaction leaves it, its deferred writes being discarded.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class OutputPort {
+    friend OutputTransaction;
+
+  public:
+    /**
+     * Type of a port register word.
+     */
+    using Word = uint32_t;
+
+    virtual ~OutputPort() noexcept;
+
+    /**
+     * Fully define an output port.
+     *
+     * @param index the index of the port, transactions write the ports by increasing index.
+     */
+    OutputPort(uint8_t index) noexcept : index(index) {}
+
+    /**
+     * Get the index of the port.
+     */
+    uint8_t getIndex() const noexcept { return index; }
+
+    /**
+     * Tells whether the writes are deferred into a transaction.
+     */
+    bool isDeferring() const noexcept { return nullptr != transaction; }
+
+    /**
+     * Check that all the given pins are writable.
+     */
+    std::expected<void, IoFailureReason> checkWritable(Word mask) const noexcept { return doCheckWritable(mask); }
+
+    /**
+     * Write some pins of the port, or record the write when deferring into a transaction ; a later write of the same
+     * pins in the same transaction replaces it.
+     *
+     * @param mask the pins to write.
+     * @param values the values of the pins to write.
+     * @returns the result of the write, always successful when deferring.
+     */
+    std::expected<void, IoFailureReason> writeBits(Word mask, Word values) noexcept {
+        if (nullptr != transaction) {
+            pendingMask |= mask;
+            pendingValues = (pendingValues & ~mask) | (values & mask);
+            return std::expected<void, IoFailureReason>();
+        }
+        return writeThrough(mask, values);
+    }
+
+    /**
+     * Forget the shadow of the outputs, so that the next transaction writes all its pins.
+     */
+    void invalidate() noexcept { knownMask = 0; }
+
+  private:
+    uint8_t index;
+    Word outputs = 0;
+    Word knownMask = 0;
+    Word pendingMask = 0;
+    Word pendingValues = 0;
+    OutputTransaction* transaction = nullptr;
+    OutputPort* next = nullptr;
+
+    std::expected<void, IoFailureReason> writeThrough(Word mask, Word values) noexcept {
+        std::expected<void, IoFailureReason> result = doWriteMasked(mask, values);
+        if (result.has_value()) {
+            outputs = (outputs & ~mask) | (values & mask);
+            knownMask |= mask;
+        } else {
+            knownMask &= ~mask;
+        }
+        return result;
+    }
+
+    // ---[ hooks ]---
+    virtual std::expected<void, IoFailureReason> doCheckWritable(Word mask) const noexcept = 0;
+    virtual std::expected<void, IoFailureReason> doWriteMasked(Word mask, Word values) noexcept = 0;
+};
+
+/**
+ * Scope deferring the pin writes of some output ports, to apply them all at once : `commit()` issues one masked write
+ * per port, by increasing port index, back to back. Only the last value written to a pin counts, and a pin whose last
+ * value is already the output of the port is left out, so that a port without any actual change is not written at all.
+ *
+ * The ports join the transaction at construction or with `join()`, and stay deferring until the transaction is
+ * destroyed, so that the transaction can be committed repeatedly, e.g. once per step of a state machine ; the writes
+ * not committed are discarded by `rollback()` or the destruction.
+ *
+ * ```
+ * OutputTransaction transaction{portA, portB};
+ * red.write(false);
+ * green.write(true);
+ * transaction.commit();
+ * ```
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class OutputTransaction {
+  public:
+    ~OutputTransaction() noexcept {
+        while (nullptr != ports) {
+            OutputPort* port = ports;
+            ports = port->next;
+            port->pendingMask = 0;
+            port->transaction = nullptr;
+            port->next = nullptr;
+        }
+    }
+
+    OutputTransaction() noexcept {}
+
+    /**
+     * Fully define a transaction over the given ports.
+     *
+     * @param ports the ports to defer, that MUST NOT be in another transaction.
+     */
+    OutputTransaction(std::initializer_list<std::reference_wrapper<OutputPort>> ports) noexcept {
+        for (OutputPort& port : ports) {
+            join(port);
+        }
+    }
+
+    OutputTransaction(const OutputTransaction&) = delete;
+    OutputTransaction& operator=(const OutputTransaction&) = delete;
+
+    /**
+     * Defer the writes of a port into this transaction.
+     *
+     * @param port the port.
+     * @returns `false` when the port is already in another transaction.
+     */
+    bool join(OutputPort& port) noexcept {
+        if (this == port.transaction) {
+            return true;
+        }
+        if (nullptr != port.transaction) {
+            return false;
+        }
+        // the list of ports is kept sorted by index
+        OutputPort** link = &ports;
+        while (nullptr != *link && (*link)->index <= port.index) {
+            link = &(*link)->next;
+        }
+        port.next = *link;
+        *link = &port;
+        port.transaction = this;
+        return true;
+    }
+
+    /**
+     * Stop deferring the writes of a port, its deferred writes being discarded.
+     *
+     * @param port the port.
+     * @returns `false` when the port is not in this transaction.
+     */
+    bool leave(OutputPort& port) noexcept {
+        OutputPort** link = &ports;
+        while (nullptr != *link && &port != *link) {
+            link = &(*link)->next;
+        }
+        if (nullptr == *link) {
+            return false;
+        }
+        *link = port.next;
+        port.pendingMask = 0;
+        port.transaction = nullptr;
+        port.next = nullptr;
+        return true;
+    }
+
+    /**
+     * Tells whether some writes are waiting for `commit()`.
+     */
+    bool isPending() const noexcept {
+        for (const OutputPort* port = ports; nullptr != port; port = port->next) {
+            if (0 != effectiveMaskOf(*port)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Apply the deferred writes, one masked write per port with actual changes.
+     *
+     * All the ports are written even when one fails ; the pins of a failed write are removed from the shadow of their
+     * port, so that the next transaction writes them again.
+     *
+     * @returns the result of the first failed write, if any.
+     */
+    std::expected<void, IoFailureReason> commit() noexcept {
+        std::expected<void, IoFailureReason> outcome;
+        for (OutputPort* port = ports; nullptr != port; port = port->next) {
+            const OutputPort::Word mask = effectiveMaskOf(*port);
+            port->pendingMask = 0;
+            if (0 == mask) {
+                continue;
+            }
+            std::expected<void, IoFailureReason> result = port->writeThrough(mask, port->pendingValues);
+            if (!result.has_value() && outcome.has_value()) {
+                outcome = result;
+            }
+        }
+        return outcome;
+    }
+
+    /**
+     * Discard the deferred writes.
+     */
+    void rollback() noexcept {
+        for (OutputPort* port = ports; nullptr != port; port = port->next) {
+            port->pendingMask = 0;
+        }
+    }
+
+  private:
+    OutputPort* ports = nullptr;
+
+    static OutputPort::Word effectiveMaskOf(const OutputPort& port) noexcept {
+        const OutputPort::Word unchanged = port.knownMask & ~(port.outputs ^ port.pendingValues);
+        return port.pendingMask & ~unchanged;
+    }
+};
+
+inline OutputPort::~OutputPort() noexcept {
+    if (nullptr != transaction) {
+        transaction->leave(*this);
+    }
+}
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
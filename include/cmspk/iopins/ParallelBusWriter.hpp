@@ -0,0 +1,325 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__PARALLEL_BUS_WRITER__HPP
+#define CMSPK__IOPINS__PARALLEL_BUS_WRITER__HPP
+
+// standard includes
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+
+// project includes
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/OutputPin.hpp"
+#include "cmspk/iopins/OutputPinGroup.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Encoding of the strobe protocols of a parallel bus.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+enum ParallelBusProtocol {
+    /**
+     * Intel 8080 style : the write strobe (`WR`) idles high, the byte is latched on its rising edge.
+     */
+    BUS_8080 = 0,
+    /**
+     * Motorola 6800 style : the enable strobe (`E`) idles low, the byte is latched on its falling edge ; the `R/W` line
+     * is expected to be held low.
+     */
+    BUS_6800
+};
+
+/**
+ * Lines of a parallel bus writer using an output pin group for the data lines, and a distinct output pin for each of
+ * the data/command (`DC`, also `RS`) and strobe (`WR` or `E`) lines.
+ *
+ * The last written levels are remembered, so that only the lines that change are actually written ; repeating the same
+ * byte only toggles the strobe.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class ParallelSeparateLines {
+  public:
+    ~ParallelSeparateLines() noexcept {}
+
+    /**
+     * Fully define the lines.
+     *
+     * @param data the data lines, the pin at index 0 is the least significant bit.
+     * @param dc the data/command line, high for data.
+     * @param strobe the strobe line.
+     */
+    ParallelSeparateLines(OutputPinOctet& data, BinaryOutputPin& dc, BinaryOutputPin& strobe) noexcept : data(data), dc(dc), strobe(strobe) {}
+
+    /**
+     * Set the levels of the lines, the data and data/command lines are written before the strobe line.
+     *
+     * @param value the byte on the data lines.
+     * @param isData the level of the data/command line.
+     * @param strobeLevel the level of the strobe line.
+     * @returns the result of the write operations.
+     */
+    std::expected<void, IoFailureReason> set(uint8_t value, bool isData, bool strobeLevel) noexcept {
+        if (!dataKnown || value != lastData) {
+            std::expected<void, IoFailureReason> result = data.write(std::bitset<8>(value));
+            dataKnown = result.has_value();
+            if (!dataKnown) {
+                return result;
+            }
+            lastData = value;
+        }
+        std::expected<void, IoFailureReason> result = writeLine(dc, lastDc, isData);
+        if (!result.has_value()) {
+            return result;
+        }
+        return writeLine(strobe, lastStrobe, strobeLevel);
+    }
+
+    /**
+     * Set the level of the strobe line only, the other lines keep their levels.
+     */
+    std::expected<void, IoFailureReason> setStrobe(bool strobeLevel) noexcept { return writeLine(strobe, lastStrobe, strobeLevel); }
+
+    /**
+     * Forget the last written levels, e.g. after the pins have been written by something else ; the next call to
+     * `set()` will write all the lines.
+     */
+    void invalidate() noexcept {
+        dataKnown = false;
+        lastDc = UNKNOWN;
+        lastStrobe = UNKNOWN;
+    }
+
+  private:
+    static constexpr uint8_t UNKNOWN = 0xff;
+    OutputPinOctet& data;
+    BinaryOutputPin& dc;
+    BinaryOutputPin& strobe;
+    uint8_t lastData = 0;
+    bool dataKnown = false;
+    uint8_t lastDc = UNKNOWN;
+    uint8_t lastStrobe = UNKNOWN;
+
+    static std::expected<void, IoFailureReason> writeLine(BinaryOutputPin& pin, uint8_t& last, bool level) noexcept {
+        if (static_cast<uint8_t>(level) == last) {
+            return std::expected<void, IoFailureReason>();
+        }
+        std::expected<void, IoFailureReason> result = pin.write(level);
+        last = result.has_value() ? static_cast<uint8_t>(level) : UNKNOWN;
+        return result;
+    }
+};
+
+/**
+ * Lines of a parallel bus writer where the data, data/command (`DC`, also `RS`) and strobe (`WR` or `E`) lines are
+ * pins of the same port, so that a single port write updates all of them.
+ *
+ * The pins at index 0 to 7 of the group are the data lines (least significant bit first), the pin at index 8 is the
+ * data/command line, the pin at index 9 is the strobe line. The last written value is remembered, so that the group is
+ * written only when a line changes.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class ParallelSharedPortLines {
+  public:
+    ~ParallelSharedPortLines() noexcept {}
+
+    /**
+     * Fully define the lines.
+     *
+     * @param lines the data (index 0 to 7), data/command (index 8) and strobe (index 9) lines.
+     */
+    ParallelSharedPortLines(OutputPinGroup<10>& lines) noexcept : lines(lines) {}
+
+    /**
+     * Set the levels of all the lines at once.
+     *
+     * @param value the byte on the data lines.
+     * @param isData the level of the data/command line.
+     * @param strobeLevel the level of the strobe line.
+     * @returns the result of the write operation.
+     */
+    std::expected<void, IoFailureReason> set(uint8_t value, bool isData, bool strobeLevel) noexcept {
+        const uint16_t word = static_cast<uint16_t>(value | (static_cast<uint16_t>(isData) << 8) | (static_cast<uint16_t>(strobeLevel) << 9));
+        if (word == last) {
+            return std::expected<void, IoFailureReason>();
+        }
+        std::expected<void, IoFailureReason> result = lines.write(std::bitset<10>(word));
+        last = result.has_value() ? word : UNKNOWN;
+        return result;
+    }
+
+    /**
+     * Set the level of the strobe line only, the other lines keep their levels ; `set()` MUST have been called before.
+     */
+    std::expected<void, IoFailureReason> setStrobe(bool strobeLevel) noexcept {
+        return set(static_cast<uint8_t>(last), (last >> 8) & 1u, strobeLevel);
+    }
+
+    /**
+     * Forget the last written value, e.g. after the pins have been written by something else ; the next call to `set()`
+     * will write the group.
+     */
+    void invalidate() noexcept { last = UNKNOWN; }
+
+  private:
+    static constexpr uint16_t UNKNOWN = 0xffff;
+    OutputPinGroup<10>& lines;
+    uint16_t last = UNKNOWN;
+};
+
+/**
+ * Write-only parallel bus master, typically for displays with an 8-bit parallel interface.
+ *
+ * Each byte takes a strobe pulse : the data, data/command and active strobe levels are set together, then the strobe
+ * goes back to idle. When the data/command line changes, it is first set with the strobe idle, for the setup time of
+ * the address. The chip select and read lines are not managed, it is up to the caller to hold them around the
+ * transfers.
+ *
+ * @param Lines the lines of the bus, e.g. `ParallelSeparateLines` or `ParallelSharedPortLines` ; it provides
+ * `set(value, isData, strobeLevel)`, `setStrobe(strobeLevel)` and `invalidate()`.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Lines>
+class ParallelBusWriter {
+  public:
+    /**
+     * Function called after each strobe edge, to meet the timings of the target, with the context given along with it ;
+     * none means as fast as possible.
+     */
+    using Delay = void (*)(void* context);
+
+    ~ParallelBusWriter() noexcept {}
+
+    /**
+     * Fully define a writer.
+     *
+     * @param lines the lines of the bus.
+     * @param protocol **optionnal**, the strobe protocol.
+     * @param strobeDelay **optionnal**, the function called after each strobe edge.
+     * @param delayContext **optionnal**, the context given to `strobeDelay`, e.g. a timer.
+     */
+    ParallelBusWriter(Lines lines, ParallelBusProtocol protocol = BUS_8080, Delay strobeDelay = nullptr, void* delayContext = nullptr) noexcept
+        : lines(lines), protocol(protocol), strobeDelay(strobeDelay), delayContext(delayContext) {}
+
+    /**
+     * Accessor of `protocol` property.
+     */
+    ParallelBusProtocol getProtocol() const noexcept { return protocol; }
+
+    /**
+     * Access to the lines of the bus.
+     */
+    Lines& getLines() noexcept { return lines; }
+
+    /**
+     * Send a command byte, i.e. with the data/command line low.
+     */
+    std::expected<void, IoFailureReason> writeCommand(uint8_t command) noexcept { return writeByte(command, false); }
+
+    /**
+     * Send a sequence of data bytes, i.e. with the data/command line high, e.g. pixels.
+     *
+     * @param values the bytes to send.
+     * @returns the result of the transfer, that stops at the first failure.
+     */
+    std::expected<void, IoFailureReason> writeData(std::span<const uint8_t> values) noexcept {
+        for (uint8_t value : values) {
+            std::expected<void, IoFailureReason> result = writeByte(value, true);
+            if (!result.has_value()) {
+                return result;
+            }
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+
+    /**
+     * Send a pattern of data bytes repeatedly, e.g. the 2 bytes of a RGB565 color to fill an area ; the data lines are
+     * written only when they change.
+     *
+     * @param pattern the bytes to repeat.
+     * @param count the number of repetitions of the pattern.
+     * @returns the result of the transfer, that stops at the first failure.
+     */
+    std::expected<void, IoFailureReason> fill(std::span<const uint8_t> pattern, std::size_t count) noexcept {
+        for (std::size_t i = 0; i < count; ++i) {
+            std::expected<void, IoFailureReason> result = writeData(pattern);
+            if (!result.has_value()) {
+                return result;
+            }
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+
+    /**
+     * Send a data byte repeatedly, see the pattern version.
+     */
+    std::expected<void, IoFailureReason> fill(uint8_t value, std::size_t count) noexcept { return fill(std::span<const uint8_t>(&value, 1), count); }
+
+  private:
+    static constexpr uint8_t UNKNOWN = 0xff;
+    Lines lines;
+    ParallelBusProtocol protocol;
+    Delay strobeDelay;
+    void* delayContext;
+    uint8_t lastDc = UNKNOWN;
+
+    std::expected<void, IoFailureReason> writeByte(uint8_t value, bool isData) noexcept {
+        const bool idle = (BUS_8080 == protocol);
+        if (static_cast<uint8_t>(isData) != lastDc) {
+            // setup of the data/command line before the strobe
+            std::expected<void, IoFailureReason> setup = strobeTo(value, isData, idle);
+            lastDc = setup.has_value() ? static_cast<uint8_t>(isData) : UNKNOWN;
+            if (!setup.has_value()) {
+                return setup;
+            }
+        }
+        std::expected<void, IoFailureReason> result = strobeTo(value, isData, !idle);
+        if (result.has_value()) {
+            result = lines.setStrobe(idle);
+            if (nullptr != strobeDelay) {
+                strobeDelay(delayContext);
+            }
+        }
+        if (!result.has_value()) {
+            lastDc = UNKNOWN;
+        }
+        return result;
+    }
+
+    std::expected<void, IoFailureReason> strobeTo(uint8_t value, bool isData, bool strobeLevel) noexcept {
+        std::expected<void, IoFailureReason> result = lines.set(value, isData, strobeLevel);
+        if (nullptr != strobeDelay) {
+            strobeDelay(delayContext);
+        }
+        return result;
+    }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,324 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__PIN_INSTRUMENTATION__HPP
+#define CMSPK__IOPINS__PIN_INSTRUMENTATION__HPP
+
+// standard includes
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+#include <type_traits>
+
+// project includes
+#include "cmspk/iopins/IoFailureReason.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Encoding of the operations of a pin, as counted by an instrumentation policy.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+enum PinOperation {
+    PIN_OPERATION_READ = 0,
+    PIN_OPERATION_WRITE,
+    /**
+     * A burst of samples, e.g. `readSamples()`, counted once.
+     */
+    PIN_OPERATION_READ_BURST,
+    /**
+     * A sequence of samples, e.g. `writeSequence()`, counted once.
+     */
+    PIN_OPERATION_WRITE_BURST,
+    PIN_OPERATION_COUNT
+};
+
+/**
+ * Instrumentation policy of the pins that does nothing : the pins using it are compiled exactly as without any
+ * instrumentation, and it takes no room (`[[no_unique_address]]`).
+ *
+ * An instrumentation policy provides `ENABLED` ; when enabled, it also provides `uint32_t now()`, giving the current
+ * time in ticks of any unit, `record(PinOperation, uint32_t ticks)` and `recordFailure(IoFailureReason)`.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+struct NoInstrumentation {
+    static constexpr bool ENABLED = false;
+};
+
+/**
+ * Statistics of the operations of a pin : counts per operation and per failure reason, and a histogram of the
+ * latencies with a bucket per power of 2, i.e. the bucket `b` counts the latencies `t` such that `2^(b-1) <= t < 2^b`,
+ * the bucket 0 counting the null latencies and the last bucket all the latencies above.
+ *
+ * The counters are not atomic, they MUST be updated from a single context.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class PinStatistics {
+  public:
+    /**
+     * Number of failure reasons counted separately, the unknown reasons are counted as `FAILURE`.
+     */
+    static constexpr std::size_t FAILURE_REASON_COUNT = FAILURE_TIMEOUT + 1;
+
+    /**
+     * Number of buckets of the latency histogram.
+     */
+    static constexpr std::size_t LATENCY_BUCKETS = 32;
+
+    ~PinStatistics() noexcept {}
+
+    PinStatistics() noexcept {}
+
+    /**
+     * Get the bucket of the histogram counting the given latency.
+     */
+    static constexpr std::size_t latencyBucketOf(uint32_t ticks) noexcept {
+        const std::size_t bucket = std::bit_width(ticks);
+        return bucket < LATENCY_BUCKETS ? bucket : LATENCY_BUCKETS - 1;
+    }
+
+    /**
+     * Count an operation and its latency.
+     */
+    void record(PinOperation operation, uint32_t ticks) noexcept {
+        ++operations[operation];
+        ++latencies[latencyBucketOf(ticks)];
+    }
+
+    /**
+     * Count a failure, in addition to its operation.
+     */
+    void recordFailure(IoFailureReason reason) noexcept { ++failures[static_cast<std::size_t>(reason) < FAILURE_REASON_COUNT ? reason : FAILURE]; }
+
+    /**
+     * Get the number of operations of a kind, failed ones included.
+     */
+    uint32_t getOperationCount(PinOperation operation) const noexcept { return operations[operation]; }
+
+    /**
+     * Get the number of operations of any kind, failed ones included.
+     */
+    uint32_t getTotalOperationCount() const noexcept {
+        uint32_t total = 0;
+        for (uint32_t count : operations) {
+            total += count;
+        }
+        return total;
+    }
+
+    /**
+     * Get the number of failures for a reason.
+     */
+    uint32_t getFailureCount(IoFailureReason reason) const noexcept {
+        return static_cast<std::size_t>(reason) < FAILURE_REASON_COUNT ? failures[reason] : 0;
+    }
+
+    /**
+     * Get the number of failures for any reason.
+     */
+    uint32_t getTotalFailureCount() const noexcept {
+        uint32_t total = 0;
+        for (uint32_t count : failures) {
+            total += count;
+        }
+        return total;
+    }
+
+    /**
+     * Get the histogram of the latencies (see `latencyBucketOf()`).
+     */
+    std::span<const uint32_t, LATENCY_BUCKETS> getLatencies() const noexcept { return latencies; }
+
+    /**
+     * Reset all the counters.
+     */
+    void reset() noexcept {
+        operations.fill(0);
+        failures.fill(0);
+        latencies.fill(0);
+    }
+
+  private:
+    std::array<uint32_t, PIN_OPERATION_COUNT> operations{};
+    std::array<uint32_t, FAILURE_REASON_COUNT> failures{};
+    std::array<uint32_t, LATENCY_BUCKETS> latencies{};
+};
+
+/**
+ * Instrumentation policy of the pins that keeps `PinStatistics`, timing each operation with the given clock.
+ *
+ * A clock provides `static uint32_t now()`, the latencies being computed modulo 2^32 ; on a micro-controller, it would
+ * typically read a cycle counter (e.g. the DWT cycle counter of a Cortex-M), on a host computer see
+ * `SteadyInstrumentationClock`.
+ *
+ * @param Clock the clock.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Clock>
+class CountingInstrumentation : public PinStatistics {
+  public:
+    static constexpr bool ENABLED = true;
+
+    ~CountingInstrumentation() noexcept {}
+
+    CountingInstrumentation() noexcept {}
+
+    /**
+     * Get the current time of the clock.
+     */
+    uint32_t now() const noexcept { return Clock::now(); }
+
+    /**
+     * Access to the statistics, e.g. to register them.
+     */
+    PinStatistics& getStatistics() noexcept { return *this; }
+};
+
+/**
+ * Run an operation of a pin under an instrumentation policy : when the policy is enabled, the operation is timed and
+ * counted, along with its failure if any ; otherwise, this is just the operation.
+ *
+ * @param instrumentation the policy.
+ * @param operation the kind of operation.
+ * @param run the operation, returning a `std::expected<..., IoFailureReason>`.
+ * @returns the result of the operation.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Instrumentation, typename Operation>
+inline std::invoke_result_t<Operation> instrumentOperation(Instrumentation& instrumentation, PinOperation operation, Operation&& run) noexcept {
+    if constexpr (Instrumentation::ENABLED) {
+        const uint32_t start = instrumentation.now();
+        std::invoke_result_t<Operation> result = run();
+        instrumentation.record(operation, instrumentation.now() - start);
+        if (!result.has_value()) {
+            instrumentation.recordFailure(result.error());
+        }
+        return result;
+    } else {
+        static_cast<void>(instrumentation);
+        static_cast<void>(operation);
+        return run();
+    }
+}
+
+/**
+ * A copy of the statistics of a registered pin.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+struct PinStatisticsSnapshot {
+    /**
+     * The name given at registration.
+     */
+    const char* name;
+    /**
+     * The statistics at the time of the snapshot.
+     */
+    PinStatistics statistics;
+};
+
+/**
+ * Fixed capacity registry of the statistics of the instrumented pins of a firmware, to take a snapshot of all of them
+ * at once, e.g. to find the hot pins.
+ *
+ * @param Capacity the maximum number of registered pins.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t Capacity>
+class InstrumentationRegistry {
+  public:
+    ~InstrumentationRegistry() noexcept {}
+
+    InstrumentationRegistry() noexcept {}
+
+    /**
+     * Register the statistics of a pin.
+     *
+     * @param name the name of the pin, that MUST outlive the registry.
+     * @param statistics the statistics, that MUST outlive the registry.
+     * @returns `false` when the registry is full.
+     */
+    bool add(const char* name, PinStatistics& statistics) noexcept {
+        if (count == Capacity) {
+            return false;
+        }
+        entries[count++] = Entry{name, &statistics};
+        return true;
+    }
+
+    /**
+     * Get the number of registered pins.
+     */
+    std::size_t size() const noexcept { return count; }
+
+    /**
+     * Copy the statistics of the registered pins, in order of registration.
+     *
+     * @param output the snapshots to fill.
+     * @returns the number of snapshots, up to the size of `output`.
+     */
+    std::size_t snapshot(std::span<PinStatisticsSnapshot> output) const noexcept {
+        const std::size_t copied = output.size() < count ? output.size() : count;
+        for (std::size_t i = 0; i < copied; ++i) {
+            output[i] = PinStatisticsSnapshot{entries[i].name, *entries[i].statistics};
+        }
+        return copied;
+    }
+
+    /**
+     * Reset the statistics of all the registered pins.
+     */
+    void resetAll() noexcept {
+        for (std::size_t i = 0; i < count; ++i) {
+            entries[i].statistics->reset();
+        }
+    }
+
+  private:
+    struct Entry {
+        const char* name;
+        PinStatistics* statistics;
+    };
+
+    std::array<Entry, Capacity> entries{};
+    std::size_t count = 0;
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,210 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__PORT_EXPANDER__HPP
+#define CMSPK__IOPINS__PORT_EXPANDER__HPP
+
+// standard includes
+#include <cstdint>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/IoFailureReason.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * An I/O expander chip reached through a bus (e.g. an I2C or SPI port expander with up to 16 pins), shared by the
+ * pins bound to it (`ExpanderOutputPin`, `ExpanderInputPin`, etc.).
+ *
+ * The expander keeps an image of its output register : a pin write updates the image, then transfers the whole image
+ * in one bus transaction. Between `beginBatch()` and `commit()`, the pin writes only update the image, and `commit()`
+ * transfers it once when it differs from the last image transferred ; likewise the first pin read of a batch takes a
+ * snapshot of the input register, that the following reads of the batch reuse. Batches can be nested, only the
+ * outermost `commit()` transfers.
+ *
+ * The chip is assumed to be in its usual power-on state : all the pins are inputs, and the output register is 0.
+ *
+ * A specialization MUST implement `doWriteOutputs()`, `doReadInputs()` and `doWriteDirections()`, each being one bus
+ * transaction.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class PortExpander {
+  public:
+    /**
+     * Type of a register word of the expander.
+     */
+    using Word = uint16_t;
+
+    ~PortExpander() noexcept {}
+
+    PortExpander() noexcept {}
+
+    // ---[ configuration ]---
+
+    /**
+     * Get the pins that are outputs.
+     */
+    Word getOutputMask() const noexcept { return outputMask; }
+
+    /**
+     * Change the pins that are outputs, the other pins are inputs ; this is always one bus transaction.
+     *
+     * @param mask the pins that are outputs.
+     * @returns the result of the operation.
+     */
+    std::expected<void, IoFailureReason> setOutputMask(Word mask) noexcept {
+        std::expected<void, IoFailureReason> result = doWriteDirections(mask);
+        if (result.has_value()) {
+            outputMask = mask;
+        }
+        return result;
+    }
+
+    /**
+     * Check that all the given pins are outputs.
+     */
+    std::expected<void, IoFailureReason> checkWritable(Word mask) const noexcept {
+        if (~outputMask & mask) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+
+    /**
+     * Check that all the given pins are inputs.
+     */
+    std::expected<void, IoFailureReason> checkReadable(Word mask) const noexcept {
+        if (outputMask & mask) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+
+    // ---[ batches ]---
+
+    /**
+     * Start a batch, or nest a batch inside the current one.
+     */
+    void beginBatch() noexcept { ++batchDepth; }
+
+    /**
+     * Tells whether a batch is in progress.
+     */
+    bool isBatching() const noexcept { return 0 != batchDepth; }
+
+    /**
+     * End a batch ; when ending the outermost batch, transfer the output image if it is pending, and
+     * forget the snapshot of the input register.
+     *
+     * When the transfer fails, the batch is ended anyway but the output image stays pending, so that the next
+     * `commit()` or pin write retries the transfer.
+     *
+     * @returns the result of the transfer, if any.
+     */
+    std::expected<void, IoFailureReason> commit() noexcept {
+        if (0 != batchDepth) {
+            --batchDepth;
+        }
+        if (0 != batchDepth) {
+            return std::expected<void, IoFailureReason>();
+        }
+        snapshotValid = false;
+        return isPending() ? transferOutputs() : std::expected<void, IoFailureReason>();
+    }
+
+    // ---[ pins side ]---
+
+    /**
+     * Get the image of the output register, including the changes not yet transferred.
+     */
+    Word getOutputImage() const noexcept { return outputImage; }
+
+    /**
+     * Tells whether the output image differs from the last image transferred, or whether the last transfer failed.
+     */
+    bool isPending() const noexcept { return !transferredValid || transferredImage != outputImage; }
+
+    /**
+     * Update some pins of the output image, and transfer the image unless a batch is in progress.
+     *
+     * @param mask the pins to update.
+     * @param values the values of the pins to update.
+     * @returns the result of the transfer, if any.
+     */
+    std::expected<void, IoFailureReason> writeBits(Word mask, Word values) noexcept {
+        outputImage = static_cast<Word>((outputImage & ~mask) | (values & mask));
+        if (0 != batchDepth) {
+            return std::expected<void, IoFailureReason>();
+        }
+        return transferOutputs();
+    }
+
+    /**
+     * Get the input register, from the snapshot of the current batch when there is one.
+     *
+     * @returns the value of the input register.
+     */
+    std::expected<Word, IoFailureReason> readInputs() noexcept {
+        if (snapshotValid) {
+            return snapshot;
+        }
+        std::expected<Word, IoFailureReason> result = doReadInputs();
+        if (result.has_value() && 0 != batchDepth) {
+            snapshot = result.value();
+            snapshotValid = true;
+        }
+        return result;
+    }
+
+    /**
+     * Forget the snapshot of the input register, so that the next read inside the batch takes a new one.
+     */
+    void invalidateSnapshot() noexcept { snapshotValid = false; }
+
+  private:
+    Word outputMask = 0;
+    Word outputImage = 0;
+    Word transferredImage = 0;
+    Word snapshot = 0;
+    uint8_t batchDepth = 0;
+    bool transferredValid = true;
+    bool snapshotValid = false;
+
+    std::expected<void, IoFailureReason> transferOutputs() noexcept {
+        std::expected<void, IoFailureReason> result = doWriteOutputs(outputImage);
+        transferredImage = outputImage;
+        transferredValid = result.has_value();
+        return result;
+    }
+
+    /**
+     * Transfer the whole output register.
+     */
+    virtual std::expected<void, IoFailureReason> doWriteOutputs(Word image) noexcept = 0;
+
+    /**
+     * Read the whole input register.
+     */
+    virtual std::expected<Word, IoFailureReason> doReadInputs() noexcept = 0;
+
+    /**
+     * Transfer the direction register.
+     *
+     * @param outputMask the pins that are outputs.
+     */
+    virtual std::expected<void, IoFailureReason> doWriteDirections(Word outputMask) noexcept = 0;
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
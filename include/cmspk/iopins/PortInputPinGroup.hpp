@@ -0,0 +1,101 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for input pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__PORT_INPUT_PIN_GROUP__HPP
+#define CMSPK__IOPINS__PORT_INPUT_PIN_GROUP__HPP
+
+// standard includes
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+
+// project includes
+#include "cmspk/iopins/BitGatherPlan.hpp"
+#include "cmspk/iopins/InputPinGroup.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * A group of binary input pins belonging to the same port, read with a single access to the port register.
+ *
+ * The pin ids are the positions of the pins inside the port register word. The implementation only has to provide
+ * `checkReadability()` and `doReadPort()`, the bits of the pins are gathered by a plan computed once. A burst of
+ * samples checks the readability only for its first sample.
+ *
+ * @param N the size of the group.
+ * @param W the unsigned integer type of the port register word.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N, typename W = uint32_t>
+class PortInputPinGroup : public InputPinGroup<N> {
+  public:
+    ~PortInputPinGroup() noexcept {}
+
+    /**
+     * Fully define a port input pin group, the gather plan is computed from the ids.
+     *
+     * @param ids the N positions of the pins inside the port register word.
+     */
+    PortInputPinGroup(std::array<uint8_t, N> ids) noexcept : InputPinGroup<N>(ids), plan(ids) {}
+
+    /**
+     * Fully define a port input pin group with a precomputed gather plan, typically a `constexpr` one.
+     *
+     * @param ids the N positions of the pins inside the port register word.
+     * @param plan the gather plan, MUST have been built from `ids`.
+     */
+    PortInputPinGroup(std::array<uint8_t, N> ids, const BitGatherPlan<N, W>& plan) noexcept : InputPinGroup<N>(ids), plan(plan) {}
+
+    /**
+     * Get the gather plan of the group.
+     */
+    const BitGatherPlan<N, W>& getGatherPlan() const noexcept { return plan; }
+
+  private:
+    BitGatherPlan<N, W> plan;
+
+    /**
+     * Read the whole port register.
+     *
+     * @returns the value of the port register word.
+     */
+    virtual std::expected<W, IoFailureReason> doReadPort() noexcept = 0;
+
+    virtual std::expected<std::bitset<N>, IoFailureReason> doRead() noexcept final {
+        std::expected<W, IoFailureReason> word = doReadPort();
+        if (!word.has_value()) {
+            return std::unexpected(word.error());
+        }
+        return std::bitset<N>(static_cast<unsigned long long>(plan.gather(word.value())));
+    }
+
+    virtual std::expected<void, IoFailureReason> doReadSamples(std::span<std::bitset<N>> samples, typename InputPinGroup<N>::Pacing pacing, void* context) noexcept {
+        for (std::size_t i = 0; i < samples.size(); ++i) {
+            std::expected<std::bitset<N>, IoFailureReason> sample = (0 == i) ? this->read() : doRead();
+            if (!sample.has_value()) {
+                return std::unexpected(sample.error());
+            }
+            samples[i] = sample.value();
+            if (nullptr != pacing) {
+                pacing(context);
+            }
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,124 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__PORT_OUTPUT_PINS__HPP
+#define CMSPK__IOPINS__PORT_OUTPUT_PINS__HPP
+
+// standard includes
+#include <cstdint>
+#include <expected>
+#include <limits>
+
+// project includes
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/LogicIoPinSetting.hpp"
+#include "cmspk/iopins/LogicOutputPin.hpp"
+#include "cmspk/iopins/OutputPin.hpp"
+#include "cmspk/iopins/OutputTransaction.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Mask of a pin of an `OutputPort`, 0 when the position is beyond the width of the port.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+constexpr OutputPort::Word outputPortMaskOf(uint8_t bit) noexcept {
+    return (bit < std::numeric_limits<OutputPort::Word>::digits) ? static_cast<OutputPort::Word>(OutputPort::Word(1) << bit) : OutputPort::Word(0);
+}
+
+/**
+ * Binary output pin bound to a pin of an `OutputPort`, the pin id is the position of the pin inside the port.
+ *
+ * While the port is in an `OutputTransaction`, the writes are deferred until `commit()`.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class PortOutputPin final : public BinaryOutputPin {
+  public:
+    ~PortOutputPin() noexcept {}
+
+    /**
+     * Fully define a port output pin.
+     *
+     * @param port the port.
+     * @param bit the position of the pin inside the port, also the pin id ; a pin beyond the width of the port is never
+     * writable.
+     */
+    PortOutputPin(OutputPort& port, uint8_t bit) noexcept : BinaryOutputPin(bit), port(port), mask(outputPortMaskOf(bit)) {}
+
+    /**
+     * Get the port of the pin.
+     */
+    OutputPort& getPort() const noexcept { return port; }
+
+  private:
+    OutputPort& port;
+    OutputPort::Word mask;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept {
+        if (0 == mask) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+        }
+        return port.checkWritable(mask);
+    }
+    virtual std::expected<void, IoFailureReason> doWrite(const bool value) noexcept { return port.writeBits(mask, value ? mask : 0); }
+};
+
+/**
+ * Logic output pin bound to a pin of an `OutputPort`, the pin id is the position of the pin inside the port.
+ *
+ * While the port is in an `OutputTransaction`, the writes are deferred until `commit()`.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class PortLogicOutputPin final : public LogicOutputPin {
+  public:
+    ~PortLogicOutputPin() noexcept {}
+
+    /**
+     * Fully define a port logic output pin.
+     *
+     * @param port the port.
+     * @param bit the position of the pin inside the port, also the pin id ; a pin beyond the width of the port is never
+     * writable.
+     * @param logicSetting **optionnal**, the initial logicSetting.
+     */
+    PortLogicOutputPin(OutputPort& port, uint8_t bit, LogicIoPinSetting logicSetting = LogicIoPinSetting::ACTIVE_HIGH) noexcept
+        : LogicOutputPin(bit, logicSetting), port(port), mask(outputPortMaskOf(bit)) {}
+
+    /**
+     * Get the port of the pin.
+     */
+    OutputPort& getPort() const noexcept { return port; }
+
+  private:
+    OutputPort& port;
+    OutputPort::Word mask;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept {
+        if (0 == mask) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+        }
+        return port.checkWritable(mask);
+    }
+    virtual std::expected<void, IoFailureReason> doWrite(const bool value) noexcept { return port.writeBits(mask, value ? mask : 0); }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,149 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__PORT_SLICE__HPP
+#define CMSPK__IOPINS__PORT_SLICE__HPP
+
+// standard includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * A run of consecutive pins of a port, that are consecutive members of a group spanning several ports.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+struct PortSlice {
+    /**
+     * The index of the port.
+     */
+    uint8_t port;
+    /**
+     * The position of the first pin of the run inside the port register word.
+     */
+    uint8_t firstBit;
+    /**
+     * The number of pins of the run.
+     */
+    uint8_t count;
+};
+
+/**
+ * Called, only when building a `PortSliceLayout`, whose slice counts do not add up to N ; being not `constexpr`, it
+ * makes the build of the layout fail at compile time.
+ */
+inline void portSliceCountsMustAddUpToTheGroupSize() noexcept {}
+
+/**
+ * Called, only when building a `PortSliceLayout`, having a slice that does not fit inside the port register word ;
+ * being not `constexpr`, it makes the build of the layout fail at compile time.
+ */
+inline void portSliceMustFitInsideThePortWord() noexcept {}
+
+/**
+ * Layout of a group of N pins made of consecutive slices : the first slice gives the first members of the group, and
+ * so on ; the counts of the slices MUST add up to N, and each slice MUST fit inside the port register word, which is
+ * checked at compile time, a layout being always built as a constant.
+ *
+ * The offsets of the slices inside the group, the masks of the slices inside their port register word and the ids of
+ * the members (their positions inside their port register word) are computed once. The slices of the same port are
+ * accessed together, through the first slice of the port.
+ *
+ * @param N the size of the group.
+ * @param Slices the number of slices.
+ * @param W **optionnal**, the unsigned integer type of the port register word.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N, std::size_t Slices, typename W = uint32_t>
+class PortSliceLayout {
+  public:
+    /**
+     * Fully define the layout ; the build fails when the counts of the slices do not add up to N, or when a slice does
+     * not fit inside the port register word.
+     *
+     * @param slices the slices, in the order of the members of the group.
+     */
+    consteval PortSliceLayout(const PortSlice (&slices)[Slices]) noexcept {
+        std::size_t offset = 0;
+        for (std::size_t s = 0; s < Slices; ++s) {
+            if (slices[s].firstBit >= std::numeric_limits<W>::digits || slices[s].firstBit + slices[s].count > std::numeric_limits<W>::digits) {
+                portSliceMustFitInsideThePortWord();
+            }
+            this->slices[s] = slices[s];
+            offsets[s] = offset;
+            masks[s] = static_cast<W>(lowMask(slices[s].count) << slices[s].firstBit);
+            owners[s] = s;
+            for (std::size_t o = 0; o < s; ++o) {
+                if (slices[o].port == slices[s].port) {
+                    owners[s] = o;
+                    break;
+                }
+            }
+            for (std::size_t i = 0; i < slices[s].count && offset + i < N; ++i) {
+                ids[offset + i] = static_cast<uint8_t>(slices[s].firstBit + i);
+            }
+            offset += slices[s].count;
+        }
+        if (offset != N) {
+            portSliceCountsMustAddUpToTheGroupSize();
+        }
+    }
+
+    /**
+     * Get a slice.
+     */
+    constexpr const PortSlice& getSlice(std::size_t s) const noexcept { return slices[s]; }
+
+    /**
+     * Get the index of the first member of a slice inside the group.
+     */
+    constexpr std::size_t getOffset(std::size_t s) const noexcept { return offsets[s]; }
+
+    /**
+     * Get the mask of the pins of a slice inside its port register word.
+     */
+    constexpr W getMask(std::size_t s) const noexcept { return masks[s]; }
+
+    /**
+     * Get the index of the first slice of the port of a slice, that accesses the port for all the slices of the port.
+     */
+    constexpr std::size_t getOwner(std::size_t s) const noexcept { return owners[s]; }
+
+    /**
+     * Get the ids of the members of the group, i.e. their positions inside their port register word.
+     */
+    constexpr const std::array<uint8_t, N>& getPinIds() const noexcept { return ids; }
+
+    /**
+     * Get a mask of the `count` lowest bits.
+     */
+    static constexpr uint64_t lowMask(std::size_t count) noexcept { return (count >= 64) ? ~uint64_t(0) : ((uint64_t(1) << count) - 1); }
+
+  private:
+    std::array<PortSlice, Slices> slices{};
+    std::array<std::size_t, Slices> offsets{};
+    std::array<W, Slices> masks{};
+    std::array<std::size_t, Slices> owners{};
+    std::array<uint8_t, N> ids{};
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,105 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SET_BIT_RANGE__HPP
+#define CMSPK__IOPINS__SET_BIT_RANGE__HPP
+
+// standard includes
+#include <array>
+#include <bit>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
+// project includes
+#include "cmspk/iopins/BitsetWords.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Range over the indices of the set bits of a `std::bitset<N>`, in increasing order.
+ *
+ * Each step uses a count-trailing-zeros on a 64 bits word, so that iterating costs one step per set bit (plus one per
+ * 64 bits word), instead of one per bit.
+ *
+ * ```cpp
+ * for (std::size_t index : SetBitRange<N>(pressed)) {
+ *     // ...
+ * }
+ * ```
+ *
+ * @param N the size of the bitset.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N>
+class SetBitRange {
+  public:
+    /**
+     * Number of 64 bits words.
+     */
+    static constexpr std::size_t WORDS = bitsetWordCount<uint64_t, N>;
+
+    /**
+     * Iterator over the indices of the set bits.
+     */
+    class Iterator {
+      public:
+        Iterator(const std::array<uint64_t, WORDS>& words, std::size_t wordIndex, uint64_t remaining) noexcept
+            : words(&words), wordIndex(wordIndex), remaining(remaining) {
+            skipEmptyWords();
+        }
+
+        std::size_t operator*() const noexcept { return wordIndex * 64 + static_cast<std::size_t>(std::countr_zero(remaining)); }
+
+        Iterator& operator++() noexcept {
+            remaining &= remaining - 1;
+            skipEmptyWords();
+            return *this;
+        }
+
+        bool operator==(const Iterator& other) const noexcept { return wordIndex == other.wordIndex && remaining == other.remaining; }
+
+      private:
+        const std::array<uint64_t, WORDS>* words;
+        std::size_t wordIndex;
+        uint64_t remaining;
+
+        void skipEmptyWords() noexcept {
+            while (0 == remaining && wordIndex < WORDS) {
+                ++wordIndex;
+                remaining = (wordIndex < WORDS) ? (*words)[wordIndex] : 0;
+            }
+        }
+    };
+
+    /**
+     * Fully define the range.
+     *
+     * @param bits the bitset, copied.
+     */
+    SetBitRange(const std::bitset<N>& bits) noexcept : words(toWords<uint64_t>(bits)) {}
+
+    Iterator begin() const noexcept { return Iterator(words, 0, words[0]); }
+
+    Iterator end() const noexcept { return Iterator(words, WORDS, 0); }
+
+    /**
+     * Tells whether there is no set bit at all.
+     */
+    bool empty() const noexcept { return begin() == end(); }
+
+  private:
+    std::array<uint64_t, WORDS> words;
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,98 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for output pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SHADOWED_OUTPUT_PIN_GROUP__HPP
+#define CMSPK__IOPINS__SHADOWED_OUTPUT_PIN_GROUP__HPP
+
+// standard includes
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/OutputPinGroup.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * A group of binary output pins that keeps a shadow copy of the last committed value, and only updates the pins that
+ * changed, using a set mask and a clear mask (like the BSRR register of STM32 micro-controllers).
+ *
+ * The implementation only has to provide `checkWritability()` and `doWriteMasks()`, the latter is not called at all
+ * when no pin changes. As long as no value has been committed, a write updates all the pins.
+ *
+ * @param N the size of the group.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N>
+class ShadowedOutputPinGroup : public OutputPinGroup<N> {
+  public:
+    ~ShadowedOutputPinGroup() noexcept {}
+
+    /**
+     * Fully define a shadowed output pin group.
+     *
+     * @param ids the N native identification numbers of the pins.
+     */
+    ShadowedOutputPinGroup(std::array<uint8_t, N> ids) noexcept : OutputPinGroup<N>(ids) {}
+
+    /**
+     * Get the last committed value, only meaningful when `isShadowValid()`.
+     */
+    std::bitset<N> getShadow() const noexcept { return shadow; }
+
+    /**
+     * Tells whether a value has been committed since the creation or the last invalidation.
+     */
+    bool isShadowValid() const noexcept { return shadowValid; }
+
+    /**
+     * Forget the last committed value, so that the next write updates all the pins, e.g. when the port has been
+     * modified by other means.
+     */
+    void invalidateShadow() noexcept { shadowValid = false; }
+
+  private:
+    std::bitset<N> shadow;
+    bool shadowValid = false;
+
+    /**
+     * Set the pins of the set mask and clear the pins of the clear mask, the other pins MUST be left untouched.
+     *
+     * The masks are disjoint, and one of them may be empty.
+     *
+     * @param setMask the pins to set.
+     * @param clearMask the pins to clear.
+     *
+     * @returns the result of the write operation.
+     */
+    virtual std::expected<void, IoFailureReason> doWriteMasks(const std::bitset<N> setMask, const std::bitset<N> clearMask) noexcept = 0;
+
+    virtual std::expected<void, IoFailureReason> doWrite(const std::bitset<N> value) noexcept final {
+        std::bitset<N> changed = shadowValid ? (value ^ shadow) : ~std::bitset<N>();
+        if (changed.none()) {
+            return std::expected<void, IoFailureReason>();
+        }
+        std::expected<void, IoFailureReason> result = doWriteMasks(value & changed, ~value & changed);
+        if (result.has_value()) {
+            shadow = value;
+            shadowValid = true;
+        }
+        return result;
+    }
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
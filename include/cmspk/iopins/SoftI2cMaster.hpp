@@ -0,0 +1,319 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SOFT_I2C_MASTER__HPP
+#define CMSPK__IOPINS__SOFT_I2C_MASTER__HPP
+
+// standard includes
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+
+// project includes
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/OpenDrainPin.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Bit-banged I2C master on two open-drain lines, supporting clock stretching by the targets.
+ *
+ * The bus primitives (`start()`, `stop()`, `writeByte()`, `readByte()`) allow any transaction, while the bulk
+ * transactions (`write()`, `read()`, `writeRegisters()`, `readRegisters()`) perform a whole exchange in one call and
+ * always try to release the bus with a stop condition, even after a failure.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class SoftI2cMaster {
+  public:
+    /**
+     * Function called after each change of a line, to limit the frequency of the bus, with the context given along with
+     * it ; none means as fast as possible.
+     */
+    using Delay = void (*)(void* context);
+
+    /**
+     * Default number of reads of the clock line waiting for a target that stretches the clock.
+     */
+    static constexpr uint32_t DEFAULT_STRETCH_TIMEOUT = 1000;
+
+    ~SoftI2cMaster() noexcept {}
+
+    /**
+     * Fully define a master.
+     *
+     * @param scl the clock line.
+     * @param sda the data line.
+     * @param stretchTimeout **optionnal**, the number of reads of the clock line waiting for it to be released, before
+     * failing with `FAILURE_TIMEOUT`.
+     * @param halfPeriodDelay **optionnal**, the function called after each change of a line.
+     * @param delayContext **optionnal**, the context given to `halfPeriodDelay`, e.g. a timer.
+     */
+    SoftI2cMaster(OpenDrainPin& scl, OpenDrainPin& sda, uint32_t stretchTimeout = DEFAULT_STRETCH_TIMEOUT, Delay halfPeriodDelay = nullptr,
+                  void* delayContext = nullptr) noexcept
+        : scl(scl), sda(sda), stretchTimeout(stretchTimeout), halfPeriodDelay(halfPeriodDelay), delayContext(delayContext) {}
+
+    // ---[ bus primitives ]---
+
+    /**
+     * Send a start condition, or a repeated start condition when a transaction is in progress.
+     */
+    std::expected<void, IoFailureReason> start() noexcept {
+        std::expected<void, IoFailureReason> result = lineTo(sda, true);
+        if (result.has_value()) {
+            result = releaseClock();
+        }
+        if (result.has_value()) {
+            result = lineTo(sda, false);
+        }
+        if (result.has_value()) {
+            result = lineTo(scl, false);
+        }
+        return result;
+    }
+
+    /**
+     * Send a stop condition, the bus is released.
+     */
+    std::expected<void, IoFailureReason> stop() noexcept {
+        std::expected<void, IoFailureReason> result = lineTo(sda, false);
+        if (result.has_value()) {
+            result = releaseClock();
+        }
+        if (result.has_value()) {
+            result = lineTo(sda, true);
+        }
+        return result;
+    }
+
+    /**
+     * Send a byte and check that the target acknowledges it.
+     *
+     * @param value the byte to send.
+     * @returns the result of the operation, failing with `FAILURE_NO_ACKNOWLEDGE` when the target does not acknowledge.
+     */
+    std::expected<void, IoFailureReason> writeByte(uint8_t value) noexcept {
+        for (int i = 7; i >= 0; --i) {
+            std::expected<void, IoFailureReason> result = writeBit((value >> i) & 1u);
+            if (!result.has_value()) {
+                return result;
+            }
+        }
+        std::expected<bool, IoFailureReason> acknowledge = readBit();
+        if (!acknowledge.has_value()) {
+            return std::unexpected(acknowledge.error());
+        }
+        if (acknowledge.value()) {
+            return std::unexpected(IoFailureReason::FAILURE_NO_ACKNOWLEDGE);
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+
+    /**
+     * Receive a byte, then acknowledge it or not.
+     *
+     * @param acknowledge `true` to acknowledge (more bytes are wanted), `false` for the last byte of a read.
+     * @returns the received byte.
+     */
+    std::expected<uint8_t, IoFailureReason> readByte(bool acknowledge) noexcept {
+        uint8_t value = 0;
+        for (int i = 0; i < 8; ++i) {
+            std::expected<bool, IoFailureReason> bit = readBit();
+            if (!bit.has_value()) {
+                return std::unexpected(bit.error());
+            }
+            value = static_cast<uint8_t>((value << 1) | static_cast<uint8_t>(bit.value()));
+        }
+        std::expected<void, IoFailureReason> result = writeBit(!acknowledge);
+        if (!result.has_value()) {
+            return std::unexpected(result.error());
+        }
+        return value;
+    }
+
+    // ---[ bulk transactions ]---
+
+    /**
+     * Send bytes to a target.
+     *
+     * @param address the 7-bits address of the target.
+     * @param values the bytes to send.
+     * @returns the result of the transaction.
+     */
+    std::expected<void, IoFailureReason> write(uint8_t address, std::span<const uint8_t> values) noexcept {
+        std::expected<void, IoFailureReason> result = begin(address, false);
+        if (result.has_value()) {
+            result = writeBytes(values);
+        }
+        return end(result);
+    }
+
+    /**
+     * Receive bytes from a target.
+     *
+     * @param address the 7-bits address of the target.
+     * @param values the received bytes, as many as its size.
+     * @returns the result of the transaction.
+     */
+    std::expected<void, IoFailureReason> read(uint8_t address, std::span<uint8_t> values) noexcept {
+        std::expected<void, IoFailureReason> result = begin(address, true);
+        if (result.has_value()) {
+            result = readBytes(values);
+        }
+        return end(result);
+    }
+
+    /**
+     * Write consecutive registers of a target : the register address then the values are sent in one transaction.
+     *
+     * @param address the 7-bits address of the target.
+     * @param firstRegister the address of the first register to write.
+     * @param values the values to write.
+     * @returns the result of the transaction.
+     */
+    std::expected<void, IoFailureReason> writeRegisters(uint8_t address, uint8_t firstRegister, std::span<const uint8_t> values) noexcept {
+        std::expected<void, IoFailureReason> result = begin(address, false);
+        if (result.has_value()) {
+            result = writeByte(firstRegister);
+        }
+        if (result.has_value()) {
+            result = writeBytes(values);
+        }
+        return end(result);
+    }
+
+    /**
+     * Read consecutive registers of a target : the register address is sent, then the values are received after a
+     * repeated start.
+     *
+     * @param address the 7-bits address of the target.
+     * @param firstRegister the address of the first register to read.
+     * @param values the read values, as many as its size.
+     * @returns the result of the transaction.
+     */
+    std::expected<void, IoFailureReason> readRegisters(uint8_t address, uint8_t firstRegister, std::span<uint8_t> values) noexcept {
+        std::expected<void, IoFailureReason> result = begin(address, false);
+        if (result.has_value()) {
+            result = writeByte(firstRegister);
+        }
+        if (result.has_value()) {
+            result = begin(address, true);
+        }
+        if (result.has_value()) {
+            result = readBytes(values);
+        }
+        return end(result);
+    }
+
+  private:
+    OpenDrainPin& scl;
+    OpenDrainPin& sda;
+    uint32_t stretchTimeout;
+    Delay halfPeriodDelay;
+    void* delayContext;
+
+    std::expected<void, IoFailureReason> lineTo(OpenDrainPin& line, bool level) noexcept {
+        std::expected<void, IoFailureReason> result = line.set(level);
+        if (nullptr != halfPeriodDelay) {
+            halfPeriodDelay(delayContext);
+        }
+        return result;
+    }
+
+    /**
+     * Release the clock line and wait for it to be high, in case a target stretches the clock.
+     */
+    std::expected<void, IoFailureReason> releaseClock() noexcept {
+        std::expected<void, IoFailureReason> result = lineTo(scl, true);
+        if (!result.has_value()) {
+            return result;
+        }
+        for (uint32_t i = 0; i < stretchTimeout; ++i) {
+            std::expected<bool, IoFailureReason> level = scl.read();
+            if (!level.has_value()) {
+                return std::unexpected(level.error());
+            }
+            if (level.value()) {
+                return std::expected<void, IoFailureReason>();
+            }
+        }
+        return std::unexpected(IoFailureReason::FAILURE_TIMEOUT);
+    }
+
+    std::expected<void, IoFailureReason> writeBit(bool bit) noexcept {
+        std::expected<void, IoFailureReason> result = lineTo(sda, bit);
+        if (result.has_value()) {
+            result = releaseClock();
+        }
+        if (result.has_value()) {
+            result = lineTo(scl, false);
+        }
+        return result;
+    }
+
+    std::expected<bool, IoFailureReason> readBit() noexcept {
+        std::expected<void, IoFailureReason> result = lineTo(sda, true);
+        if (result.has_value()) {
+            result = releaseClock();
+        }
+        if (!result.has_value()) {
+            return std::unexpected(result.error());
+        }
+        std::expected<bool, IoFailureReason> bit = sda.read();
+        result = lineTo(scl, false);
+        if (!result.has_value()) {
+            return std::unexpected(result.error());
+        }
+        return bit;
+    }
+
+    std::expected<void, IoFailureReason> begin(uint8_t address, bool reading) noexcept {
+        std::expected<void, IoFailureReason> result = start();
+        if (result.has_value()) {
+            result = writeByte(static_cast<uint8_t>((address << 1) | static_cast<uint8_t>(reading)));
+        }
+        return result;
+    }
+
+    std::expected<void, IoFailureReason> writeBytes(std::span<const uint8_t> values) noexcept {
+        for (uint8_t value : values) {
+            std::expected<void, IoFailureReason> result = writeByte(value);
+            if (!result.has_value()) {
+                return result;
+            }
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+
+    std::expected<void, IoFailureReason> readBytes(std::span<uint8_t> values) noexcept {
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            std::expected<uint8_t, IoFailureReason> value = readByte(i + 1 < values.size());
+            if (!value.has_value()) {
+                return std::unexpected(value.error());
+            }
+            values[i] = value.value();
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+
+    /**
+     * Terminate a transaction with a stop condition, the failure of the transaction prevails.
+     */
+    std::expected<void, IoFailureReason> end(std::expected<void, IoFailureReason> result) noexcept {
+        std::expected<void, IoFailureReason> stopped = stop();
+        return result.has_value() ? stopped : result;
+    }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,392 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SOFT_SPI_MASTER__HPP
+#define CMSPK__IOPINS__SOFT_SPI_MASTER__HPP
+
+// standard includes
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+// project includes
+#include "cmspk/iopins/InputPin.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/OutputPin.hpp"
+#include "cmspk/iopins/OutputPinGroup.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Encoding of the SPI modes, i.e. the clock polarity (`CPOL`, idle level of the clock) and the clock phase (`CPHA`,
+ * whether the data are sampled on the leading or on the trailing edge of the clock).
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+enum SpiMode {
+    /**
+     * `CPOL = 0`, `CPHA = 0` : the clock idles low, the data are sampled on the rising edge.
+     */
+    SPI_MODE_0 = 0,
+    /**
+     * `CPOL = 0`, `CPHA = 1` : the clock idles low, the data are sampled on the falling edge.
+     */
+    SPI_MODE_1,
+    /**
+     * `CPOL = 1`, `CPHA = 0` : the clock idles high, the data are sampled on the falling edge.
+     */
+    SPI_MODE_2,
+    /**
+     * `CPOL = 1`, `CPHA = 1` : the clock idles high, the data are sampled on the rising edge.
+     */
+    SPI_MODE_3
+};
+
+/**
+ * Encoding of the order of the bits of the words sent and received on a SPI bus.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+enum SpiBitOrder {
+    /**
+     * The most significant bit goes first.
+     */
+    MSB_FIRST = 0,
+    /**
+     * The least significant bit goes first.
+     */
+    LSB_FIRST
+};
+
+/**
+ * Lines of a bit-banged SPI master using a distinct output pin for each of the clock (`SCK`) and the data out (`MOSI`)
+ * lines.
+ *
+ * The last written levels are remembered, so that only the line that changes is actually written.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class SpiSeparateLines {
+  public:
+    ~SpiSeparateLines() noexcept {}
+
+    /**
+     * Fully define the lines.
+     *
+     * @param sck the clock line.
+     * @param mosi the data out line.
+     * @param miso the data in line.
+     */
+    SpiSeparateLines(BinaryOutputPin& sck, BinaryOutputPin& mosi, BinaryInputPin& miso) noexcept : sck(sck), mosi(mosi), miso(miso) {}
+
+    /**
+     * Set the levels of the clock and data out lines, the data line is written first.
+     *
+     * @param clock the level of the clock line.
+     * @param data the level of the data out line.
+     * @returns the result of the write operations.
+     */
+    std::expected<void, IoFailureReason> set(bool clock, bool data) noexcept {
+        if (static_cast<uint8_t>(data) != lastData) {
+            std::expected<void, IoFailureReason> result = mosi.write(data);
+            if (!result.has_value()) {
+                lastData = UNKNOWN;
+                return result;
+            }
+            lastData = data;
+        }
+        if (static_cast<uint8_t>(clock) != lastClock) {
+            std::expected<void, IoFailureReason> result = sck.write(clock);
+            if (!result.has_value()) {
+                lastClock = UNKNOWN;
+                return result;
+            }
+            lastClock = clock;
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+
+    /**
+     * Read the data in line.
+     */
+    std::expected<bool, IoFailureReason> read() noexcept { return miso.read(); }
+
+    /**
+     * Forget the last written levels, e.g. after the pins have been written by something else ; the next call to
+     * `set()` will write both lines.
+     */
+    void invalidate() noexcept {
+        lastClock = UNKNOWN;
+        lastData = UNKNOWN;
+    }
+
+  private:
+    static constexpr uint8_t UNKNOWN = 0xff;
+    BinaryOutputPin& sck;
+    BinaryOutputPin& mosi;
+    BinaryInputPin& miso;
+    uint8_t lastClock = UNKNOWN;
+    uint8_t lastData = UNKNOWN;
+};
+
+/**
+ * Lines of a bit-banged SPI master where the clock (`SCK`) and the data out (`MOSI`) lines are a pair of pins of the
+ * same port, so that a single port write updates both lines.
+ *
+ * The pin at index 0 of the pair is the clock line, the pin at index 1 is the data out line. The last written value
+ * is remembered, so that the pair is written only when a line changes.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class SpiSharedPortLines {
+  public:
+    ~SpiSharedPortLines() noexcept {}
+
+    /**
+     * Fully define the lines.
+     *
+     * @param sckMosi the clock (index 0) and data out (index 1) lines.
+     * @param miso the data in line.
+     */
+    SpiSharedPortLines(OutputPinPair& sckMosi, BinaryInputPin& miso) noexcept : sckMosi(sckMosi), miso(miso) {}
+
+    /**
+     * Set the levels of the clock and data out lines at once.
+     *
+     * @param clock the level of the clock line.
+     * @param data the level of the data out line.
+     * @returns the result of the write operation.
+     */
+    std::expected<void, IoFailureReason> set(bool clock, bool data) noexcept {
+        const uint8_t value = static_cast<uint8_t>(clock) | static_cast<uint8_t>(data << 1);
+        if (value == last) {
+            return std::expected<void, IoFailureReason>();
+        }
+        std::expected<void, IoFailureReason> result = sckMosi.write(std::bitset<2>(value));
+        last = result.has_value() ? value : UNKNOWN;
+        return result;
+    }
+
+    /**
+     * Read the data in line.
+     */
+    std::expected<bool, IoFailureReason> read() noexcept { return miso.read(); }
+
+    /**
+     * Forget the last written value, e.g. after the pins have been written by something else ; the next call to `set()`
+     * will write the pair.
+     */
+    void invalidate() noexcept { last = UNKNOWN; }
+
+  private:
+    static constexpr uint8_t UNKNOWN = 0xff;
+    OutputPinPair& sckMosi;
+    BinaryInputPin& miso;
+    uint8_t last = UNKNOWN;
+};
+
+/**
+ * Bit-banged, full-duplex, SPI master.
+ *
+ * The chip select line is not managed, it is up to the caller to assert it around the transfers.
+ *
+ * @param Lines the lines of the bus, e.g. `SpiSeparateLines` or `SpiSharedPortLines` ; it provides `set(clock, data)`,
+ * `read()` and `invalidate()`.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Lines>
+class SoftSpiMaster {
+  public:
+    /**
+     * Function called after each clock edge, to limit the frequency of the bus, with the context given along with it ;
+     * none means as fast as possible.
+     */
+    using Delay = void (*)(void* context);
+
+    ~SoftSpiMaster() noexcept {}
+
+    /**
+     * Fully define a master.
+     *
+     * @param lines the lines of the bus.
+     * @param mode **optionnal**, the SPI mode.
+     * @param bitOrder **optionnal**, the order of the bits of the words.
+     * @param halfPeriodDelay **optionnal**, the function called after each clock edge.
+     * @param delayContext **optionnal**, the context given to `halfPeriodDelay`, e.g. a timer.
+     */
+    SoftSpiMaster(Lines lines, SpiMode mode = SPI_MODE_0, SpiBitOrder bitOrder = MSB_FIRST, Delay halfPeriodDelay = nullptr,
+                  void* delayContext = nullptr) noexcept
+        : lines(lines), mode(mode), bitOrder(bitOrder), halfPeriodDelay(halfPeriodDelay), delayContext(delayContext) {}
+
+    /**
+     * Accessor of `mode` property.
+     */
+    SpiMode getMode() const noexcept { return mode; }
+
+    /**
+     * Mutator of `mode` property, the clock line goes to its new idle level at the beginning of the next transfer.
+     */
+    void setMode(SpiMode value) noexcept { mode = value; }
+
+    /**
+     * Accessor of `bitOrder` property.
+     */
+    SpiBitOrder getBitOrder() const noexcept { return bitOrder; }
+
+    /**
+     * Mutator of `bitOrder` property.
+     */
+    void setBitOrder(SpiBitOrder value) noexcept { bitOrder = value; }
+
+    /**
+     * Access to the lines of the bus.
+     */
+    Lines& getLines() noexcept { return lines; }
+
+    /**
+     * Send a word while receiving another one.
+     *
+     * @param W the type of word, `uint8_t`, `uint16_t` or `uint32_t`.
+     * @param value the word to send.
+     * @returns the received word.
+     */
+    template <typename W>
+    std::expected<W, IoFailureReason> transferWord(W value) noexcept {
+        static_assert(std::is_same_v<W, uint8_t> || std::is_same_v<W, uint16_t> || std::is_same_v<W, uint32_t>, "words are 8, 16 or 32 bits wide");
+        constexpr int BITS = std::numeric_limits<W>::digits;
+        const bool idle = (SPI_MODE_2 == mode || SPI_MODE_3 == mode);
+        const bool sampleOnLeadingEdge = (SPI_MODE_0 == mode || SPI_MODE_2 == mode);
+        if (!sampleOnLeadingEdge) {
+            // the clock MUST be idle before the leading edge of the first bit
+            std::expected<void, IoFailureReason> ready = lines.set(idle, firstBit(value));
+            if (!ready.has_value()) {
+                return std::unexpected(ready.error());
+            }
+        }
+        W received = 0;
+        for (int i = 0; i < BITS; ++i) {
+            const bool bit = ((MSB_FIRST == bitOrder) ? (value >> (BITS - 1 - i)) : (value >> i)) & 1u;
+            std::expected<void, IoFailureReason> edge;
+            if (sampleOnLeadingEdge) {
+                // the data are set along the trailing edge of the previous bit, and sampled on the leading edge
+                edge = edgeTo(idle, bit);
+                if (edge.has_value()) {
+                    edge = edgeTo(!idle, bit);
+                }
+            } else {
+                // the data are set on the leading edge, and sampled on the trailing edge
+                edge = edgeTo(!idle, bit);
+                if (edge.has_value()) {
+                    edge = edgeTo(idle, bit);
+                }
+            }
+            if (!edge.has_value()) {
+                return std::unexpected(edge.error());
+            }
+            std::expected<bool, IoFailureReason> sample = lines.read();
+            if (!sample.has_value()) {
+                return std::unexpected(sample.error());
+            }
+            if (MSB_FIRST == bitOrder) {
+                received = static_cast<W>((received << 1) | static_cast<W>(sample.value()));
+            } else {
+                received = static_cast<W>(received | (static_cast<W>(sample.value()) << i));
+            }
+        }
+        if (sampleOnLeadingEdge) {
+            // trailing edge of the last bit
+            std::expected<void, IoFailureReason> edge = edgeTo(idle, lastBit(value));
+            if (!edge.has_value()) {
+                return std::unexpected(edge.error());
+            }
+        }
+        return received;
+    }
+
+    /**
+     * Send a sequence of bytes while receiving another one.
+     *
+     * @param out the bytes to send.
+     * @param in the received bytes, the bytes received beyond its size are discarded ; it may be empty.
+     * @returns the result of the transfer, that stops at the first failure.
+     */
+    std::expected<void, IoFailureReason> transfer(std::span<const uint8_t> out, std::span<uint8_t> in) noexcept { return transferWords(out, in); }
+
+    /**
+     * Send a sequence of 16-bits words while receiving another one, see the bytes version.
+     */
+    std::expected<void, IoFailureReason> transfer(std::span<const uint16_t> out, std::span<uint16_t> in) noexcept { return transferWords(out, in); }
+
+    /**
+     * Send a sequence of 32-bits words while receiving another one, see the bytes version.
+     */
+    std::expected<void, IoFailureReason> transfer(std::span<const uint32_t> out, std::span<uint32_t> in) noexcept { return transferWords(out, in); }
+
+  private:
+    Lines lines;
+    SpiMode mode;
+    SpiBitOrder bitOrder;
+    Delay halfPeriodDelay;
+    void* delayContext;
+
+    template <typename W>
+    bool firstBit(W value) const noexcept {
+        return ((MSB_FIRST == bitOrder) ? (value >> (std::numeric_limits<W>::digits - 1)) : value) & 1u;
+    }
+
+    template <typename W>
+    bool lastBit(W value) const noexcept {
+        return ((MSB_FIRST == bitOrder) ? value : (value >> (std::numeric_limits<W>::digits - 1))) & 1u;
+    }
+
+    std::expected<void, IoFailureReason> edgeTo(bool clock, bool data) noexcept {
+        std::expected<void, IoFailureReason> result = lines.set(clock, data);
+        if (nullptr != halfPeriodDelay) {
+            halfPeriodDelay(delayContext);
+        }
+        return result;
+    }
+
+    template <typename W>
+    std::expected<void, IoFailureReason> transferWords(std::span<const W> out, std::span<W> in) noexcept {
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            std::expected<W, IoFailureReason> received = transferWord<W>(out[i]);
+            if (!received.has_value()) {
+                return std::unexpected(received.error());
+            }
+            if (i < in.size()) {
+                in[i] = received.value();
+            }
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
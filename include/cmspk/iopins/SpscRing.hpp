@@ -0,0 +1,124 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SPSC_RING__HPP
+#define CMSPK__IOPINS__SPSC_RING__HPP
+
+// standard includes
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <span>
+
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Fixed capacity, allocation free, lock free ring buffer for a single producer and a single consumer, e.g. an
+ * interrupt handler or a capture thread producing samples consumed by the main loop.
+ *
+ * Only the producer may call `push()`/`pushBatch()`, and only the consumer may call `pop()`/`popBatch()`.
+ *
+ * @param T the type of the elements, MUST be trivially copyable.
+ * @param Capacity the maximum number of elements, MUST be a power of 2.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename T, std::size_t Capacity>
+class SpscRing {
+    static_assert(Capacity > 0 && 0 == (Capacity & (Capacity - 1)), "Capacity MUST be a power of 2");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free, "The indices MUST be lock free");
+
+  public:
+    /**
+     * Append an element, **producer side only**.
+     *
+     * @param element the element to append.
+     *
+     * @returns `false` when the ring is full, the element is not appended.
+     */
+    bool push(const T& element) noexcept { return 1 == pushBatch(std::span<const T>(&element, 1)); }
+
+    /**
+     * Append as many elements as possible, **producer side only**.
+     *
+     * @param elements the elements to append, in order.
+     *
+     * @returns the number of appended elements, the first ones of `elements`.
+     */
+    std::size_t pushBatch(std::span<const T> elements) noexcept {
+        std::size_t tail = writeIndex.load(std::memory_order_relaxed);
+        std::size_t count = std::min(elements.size(), Capacity - (tail - readIndex.load(std::memory_order_acquire)));
+        std::size_t start = tail & (Capacity - 1);
+        std::size_t firstPart = std::min(count, Capacity - start);
+        std::copy_n(elements.begin(), firstPart, slots.begin() + start);
+        std::copy_n(elements.begin() + firstPart, count - firstPart, slots.begin());
+        writeIndex.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * Remove the oldest element, **consumer side only**.
+     *
+     * @returns the oldest element, if any.
+     */
+    std::optional<T> pop() noexcept {
+        T element;
+        if (0 == popBatch(std::span<T>(&element, 1))) {
+            return std::nullopt;
+        }
+        return element;
+    }
+
+    /**
+     * Remove as many of the oldest elements as possible, **consumer side only**.
+     *
+     * @param elements where to copy the removed elements, in order.
+     *
+     * @returns the number of removed elements, copied at the start of `elements`.
+     */
+    std::size_t popBatch(std::span<T> elements) noexcept {
+        std::size_t head = readIndex.load(std::memory_order_relaxed);
+        std::size_t count = std::min(elements.size(), writeIndex.load(std::memory_order_acquire) - head);
+        std::size_t start = head & (Capacity - 1);
+        std::size_t firstPart = std::min(count, Capacity - start);
+        std::copy_n(slots.begin() + start, firstPart, elements.begin());
+        std::copy_n(slots.begin(), count - firstPart, elements.begin() + firstPart);
+        readIndex.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * Get the number of elements, only a snapshot when called concurrently.
+     */
+    std::size_t size() const noexcept { return writeIndex.load(std::memory_order_acquire) - readIndex.load(std::memory_order_acquire); }
+
+    /**
+     * Tells whether the ring is empty, only a snapshot when called concurrently.
+     */
+    bool empty() const noexcept { return 0 == size(); }
+
+    /**
+     * Get the maximum number of elements.
+     */
+    static constexpr std::size_t capacity() noexcept { return Capacity; }
+
+  private:
+    // the indices grow forever (wrapping around), the slot of an index is `index % Capacity`.
+    alignas(64) std::atomic<std::size_t> writeIndex{0};
+    alignas(64) std::atomic<std::size_t> readIndex{0};
+    alignas(64) std::array<T, Capacity> slots{};
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
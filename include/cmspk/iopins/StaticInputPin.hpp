@@ -0,0 +1,157 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for input pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__STATIC_INPUT_PIN__HPP
+#define CMSPK__IOPINS__STATIC_INPUT_PIN__HPP
+
+// standard includes
+#include <cstdint>
+#include <expected>
+
+// dependencies includes
+#include "cmspk/ucdev.hpp"
+
+// project includes
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/PinInstrumentation.hpp"
+#include "cmspk/iopins/StaticPinHandles.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * An abstraction of input pins, with a value represented by the given type, whose hooks are resolved at compile time.
+ *
+ * This is the static dispatch counterpart of `InputPin` : the implementation `Derived` provides the non virtual hooks
+ * `checkReadability()` and `doRead()`, with the same signatures as their virtual counterparts, and they MUST be
+ * accessible from this class (e.g. by befriending it). Calls to `read()` can then be fully inlined.
+ *
+ * For inner loops, `acquireReader()` checks the readability once and gives a `StaticPinReader`, whose `readRaw()` is
+ * the bare `doRead()` ; the implementation MUST call `invalidateCapabilities()` when the readability of the pin
+ * changes, so that the handles acquired so far are seen as invalid.
+ *
+ * @param Derived the implementation class, deriving from this class.
+ * @param S storage type for the value, typically a `bool` or an `uint8_t`
+ * @param Instrumentation **optionnal**, the instrumentation policy of the operations, see `NoInstrumentation` and
+ *   `CountingInstrumentation` ; the handles are not instrumented.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename S, typename Instrumentation = NoInstrumentation>
+class StaticInputPin : public cmspk::ucdev::SimpleReadableDeviceAssertions, public CapabilityEpoch {
+    friend StaticPinReader<StaticInputPin, S>;
+
+  public:
+    /**
+     * Type of the handle given by `acquireReader()`.
+     */
+    using Reader = StaticPinReader<StaticInputPin, S>;
+
+    ~StaticInputPin() noexcept {}
+
+    /**
+     * Fully define an input pin.
+     *
+     * @param id the native identification number of the pin.
+     */
+    StaticInputPin(uint8_t id) noexcept : id(id) {}
+
+    /**
+     * Get the pin id for the underlying microcontroller/board.
+     */
+    uint8_t getPinId() const noexcept { return id; }
+
+    /**
+     * Access to the instrumentation policy, e.g. to register its statistics.
+     */
+    Instrumentation& getInstrumentation() noexcept { return instrumentation; }
+
+    /**
+     * Read operation, the pin MUST be readable to be able to succeed.
+     *
+     * @returns the result of the read operation.
+     */
+    std::expected<S, IoFailureReason> read() noexcept {
+        return instrumentOperation(instrumentation, PIN_OPERATION_READ, [&]() noexcept -> std::expected<S, IoFailureReason> {
+            Derived& self = static_cast<Derived&>(*this);
+            std::expected<void, IoFailureReason> readability = self.checkReadability();
+            if (!readability.has_value()) {
+                return std::unexpected(readability.error());
+            }
+            return self.doRead();
+        });
+    }
+
+    /**
+     * Check the readability once, and get a handle to read the pin without further checks.
+     *
+     * @returns the handle, or the reason why the pin is not readable.
+     */
+    std::expected<Reader, IoFailureReason> acquireReader() noexcept {
+        std::expected<void, IoFailureReason> readability = static_cast<Derived&>(*this).checkReadability();
+        if (!readability.has_value()) {
+            return std::unexpected(readability.error());
+        }
+        return Reader(*this);
+    }
+
+  private:
+    uint8_t id;
+    [[no_unique_address]] Instrumentation instrumentation;
+
+    S readUnchecked() noexcept { return static_cast<Derived&>(*this).doRead().value_or(S()); }
+};
+
+/**
+ * Specialization of static input pins using a single bit (`bool`) to represent its values.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticBinaryInputPin = StaticInputPin<Derived, bool, Instrumentation>;
+
+/**
+ * Specialization of static input pins using an 8 bits wide integer (`uint8_t`) to represent its values.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticAnalogInputPin8 = StaticInputPin<Derived, uint8_t, Instrumentation>;
+
+/**
+ * Specialization of static input pins using a 16 bits wide integer (`uint16_t`) to represent its values.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticAnalogInputPin16 = StaticInputPin<Derived, uint16_t, Instrumentation>;
+
+/**
+ * Specialization of static input pins using a 32 bits wide integer (`uint32_t`) to represent its values.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticAnalogInputPin32 = StaticInputPin<Derived, uint32_t, Instrumentation>;
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
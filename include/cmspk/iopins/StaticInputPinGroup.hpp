@@ -0,0 +1,228 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for input pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__STATIC_INPUT_PIN_GROUP__HPP
+#define CMSPK__IOPINS__STATIC_INPUT_PIN_GROUP__HPP
+
+// standard includes
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+
+// dependencies includes
+#include "cmspk/ucdev.hpp"
+
+// project includes
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/PinInstrumentation.hpp"
+#include "cmspk/iopins/StaticPinHandles.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * An abstraction of a group of binary (true/false) input pins of a given size, that is read all at once, whose hooks
+ * are resolved at compile time.
+ *
+ * This is the static dispatch counterpart of `InputPinGroup` : the implementation `Derived` provides the non virtual
+ * hooks `checkReadability()` and `doRead()`, that MUST be accessible from this class (e.g. by befriending it).
+ *
+ * Like `StaticInputPin`, `acquireReader()` gives a handle to read the group without further checks ; likewise,
+ * `readSamples()` checks the readability once for the whole burst.
+ *
+ * @param Derived the implementation class, deriving from this class.
+ * @param N the size of the group.
+ * @param Instrumentation **optionnal**, the instrumentation policy of the operations, see `NoInstrumentation` and
+ *   `CountingInstrumentation` ; the handles are not instrumented.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, std::size_t N, typename Instrumentation = NoInstrumentation>
+class StaticInputPinGroup : public cmspk::ucdev::SimpleReadableDeviceAssertions, public CapabilityEpoch {
+    friend StaticPinReader<StaticInputPinGroup, std::bitset<N>>;
+
+  public:
+    /**
+     * Type of the handle given by `acquireReader()`.
+     */
+    using Reader = StaticPinReader<StaticInputPinGroup, std::bitset<N>>;
+
+    /**
+     * Function called after each sample of a burst, to pace it, with the context given along with it ; none means as
+     * fast as possible.
+     */
+    using Pacing = void (*)(void* context);
+
+    ~StaticInputPinGroup() noexcept {}
+
+    /**
+     * Fully define an input pin group.
+     *
+     * @param ids the N native identification numbers of the pins.
+     */
+    StaticInputPinGroup(std::array<uint8_t, N> ids) noexcept : ids(ids) {}
+
+    /**
+     * Get the pin ids for the underlying microcontroller/board.
+     */
+    std::array<uint8_t, N> getPinIds() const noexcept { return ids; }
+
+    /**
+     * Access to the instrumentation policy, e.g. to register its statistics.
+     */
+    Instrumentation& getInstrumentation() noexcept { return instrumentation; }
+
+    /**
+     * Read operation, the group MUST be readable to be able to succeed.
+     *
+     * @returns the result of the read operation.
+     */
+    std::expected<std::bitset<N>, IoFailureReason> read() noexcept {
+        return instrumentOperation(instrumentation, PIN_OPERATION_READ, [&]() noexcept -> std::expected<std::bitset<N>, IoFailureReason> {
+            Derived& self = static_cast<Derived&>(*this);
+            std::expected<void, IoFailureReason> readability = self.checkReadability();
+            if (!readability.has_value()) {
+                return std::unexpected(readability.error());
+            }
+            return self.doRead();
+        });
+    }
+
+    /**
+     * Read a burst of samples, e.g. to capture a waveform, the readability is checked once.
+     *
+     * @param samples the samples to fill, in order.
+     * @param pacing **optionnal**, the function called after each sample.
+     * @param context **optionnal**, the context given to the pacing function.
+     * @returns the result of the capture, that stops at the first failure.
+     */
+    std::expected<void, IoFailureReason> readSamples(std::span<std::bitset<N>> samples, Pacing pacing = nullptr, void* context = nullptr) noexcept {
+        return instrumentOperation(instrumentation, PIN_OPERATION_READ_BURST, [&]() noexcept -> std::expected<void, IoFailureReason> {
+            Derived& self = static_cast<Derived&>(*this);
+            std::expected<void, IoFailureReason> readability = self.checkReadability();
+            if (!readability.has_value()) {
+                return readability;
+            }
+            for (std::bitset<N>& sample : samples) {
+                std::expected<std::bitset<N>, IoFailureReason> result = self.doRead();
+                if (!result.has_value()) {
+                    return std::unexpected(result.error());
+                }
+                sample = result.value();
+                if (nullptr != pacing) {
+                    pacing(context);
+                }
+            }
+            return std::expected<void, IoFailureReason>();
+        });
+    }
+
+    /**
+     * Check the readability once, and get a handle to read the group without further checks.
+     *
+     * @returns the handle, or the reason why the group is not readable.
+     */
+    std::expected<Reader, IoFailureReason> acquireReader() noexcept {
+        std::expected<void, IoFailureReason> readability = static_cast<Derived&>(*this).checkReadability();
+        if (!readability.has_value()) {
+            return std::unexpected(readability.error());
+        }
+        return Reader(*this);
+    }
+
+  private:
+    std::array<uint8_t, N> ids;
+    [[no_unique_address]] Instrumentation instrumentation;
+
+    std::bitset<N> readUnchecked() noexcept { return static_cast<Derived&>(*this).doRead().value_or(std::bitset<N>()); }
+};
+
+/**
+ * Alias for a static group of pins with 2 members.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticInputPinPair = StaticInputPinGroup<Derived, 2, Instrumentation>;
+
+/**
+ * Alias for a static group of pins with 3 members.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticInputPinTrio = StaticInputPinGroup<Derived, 3, Instrumentation>;
+
+/**
+ * Alias for a static group of pins with 4 members.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticInputPinQuartet = StaticInputPinGroup<Derived, 4, Instrumentation>;
+
+/**
+ * Alias for a static group of pins with 5 members.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticInputPinQuintet = StaticInputPinGroup<Derived, 5, Instrumentation>;
+
+/**
+ * Alias for a static group of pins with 6 members.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticInputPinSextet = StaticInputPinGroup<Derived, 6, Instrumentation>;
+
+/**
+ * Alias for a static group of pins with 7 members.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticInputPinSeptet = StaticInputPinGroup<Derived, 7, Instrumentation>;
+
+/**
+ * Alias for a static group of pins with 8 members.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticInputPinOctet = StaticInputPinGroup<Derived, 8, Instrumentation>;
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,126 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__STATIC_LOGIC_INPUT_PIN__HPP
+#define CMSPK__IOPINS__STATIC_LOGIC_INPUT_PIN__HPP
+#include <cstdint>
+#include <exception>
+
+#include "cmspk/iopins/LogicIoPinSetting.hpp"
+#include "cmspk/iopins/PinInstrumentation.hpp"
+#include "cmspk/iopins/StaticInputPin.hpp"
+#include "cmspk/iopins/StaticPinHandles.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+
+/**
+ * Abstraction of an input pin that can be **asserted/active** or **negated/inactive**, whose hooks are resolved at
+ * compile time.
+ *
+ * This is the static dispatch counterpart of `LogicInputPin`, see `StaticInputPin` for the requirements on `Derived`.
+ * Changing the logic setting invalidates the handles acquired so far.
+ *
+ * @param Derived the implementation class, deriving from this class.
+ * @param Instrumentation **optionnal**, the instrumentation policy of the operations, see `NoInstrumentation` and
+ *   `CountingInstrumentation`.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+class StaticLogicInputPin : public StaticBinaryInputPin<Derived, Instrumentation> {
+  public:
+    /**
+     * Type of the handle given by `acquireLogicReader()`.
+     */
+    using LogicReader = StaticLogicPinReader<typename StaticBinaryInputPin<Derived, Instrumentation>::Reader>;
+
+    ~StaticLogicInputPin() noexcept {}
+
+    /**
+     * Fully define a logic I/O pin.
+     *
+     * @param id the native identification number of the pin.
+     * @param logicSetting **optionnal**, the initial logicSetting.
+     */
+    StaticLogicInputPin(uint8_t id, LogicIoPinSetting logicSetting = LogicIoPinSetting::ACTIVE_HIGH) noexcept
+        : StaticBinaryInputPin<Derived, Instrumentation>(id), myLogicSetting(logicSetting) {}
+
+    /**
+     * Accessor of `logicSetting` property.
+     *
+     * @returns the property's value.
+     */
+    LogicIoPinSetting getLogicSetting() const noexcept { return myLogicSetting; }
+
+    /**
+     * Mutator of `logicSetting` property.
+     *
+     * @param logicSetting the new value.
+     */
+    void setLogicSetting(LogicIoPinSetting logicSetting) noexcept {
+        if (logicSetting != myLogicSetting) {
+            this->invalidateCapabilities();
+        }
+        myLogicSetting = logicSetting;
+    }
+
+    /**
+     * Check the readability once, and get a handle to read the logic value of the pin without further checks.
+     *
+     * @returns the handle, or the reason why the pin is not readable.
+     */
+    std::expected<LogicReader, IoFailureReason> acquireLogicReader() noexcept {
+        std::expected<typename StaticBinaryInputPin<Derived, Instrumentation>::Reader, IoFailureReason> reader = this->acquireReader();
+        if (!reader.has_value()) {
+            return std::unexpected(reader.error());
+        }
+        return LogicReader(reader.value(), LogicIoPinSetting::ACTIVE_LOW == myLogicSetting);
+    }
+
+    /**
+     * Read operation, the pin MUST have `READ` direction to be able to succeed.
+     *
+     * @returns the result of the read operation.
+     */
+    std::expected<bool, IoFailureReason> readLogic() noexcept {
+        std::expected<bool, IoFailureReason> rawRead = this->read();
+        if (rawRead.has_value()) {
+            return logicFromRaw(rawRead.value());
+        } else {
+            return rawRead;
+        }
+    }
+
+    /**
+     * Wrapper calling `readLogic()` and asserting whether it got `true`, **SHOULD be called ONLY when the pin is readable**.
+     *
+     * @returns `true` only when the pin is readable and is at the logic active state defined as the logic setting.
+     */
+    bool isAsserted() noexcept {
+        std::expected<bool, IoFailureReason> result = readLogic();
+        return (result.has_value() && result.value());
+    }
+
+    /**
+     * Wrapper calling `readLogic()` and asserting whether it got `false`, **SHOULD be called ONLY when the pin is readable**.
+     *
+     * @returns `true` only when the pin is readable and is at the logic inactive state defined as the logic setting.
+     */
+    bool isNegated() noexcept {
+        std::expected<bool, IoFailureReason> result = readLogic();
+        return (result.has_value() && !(result.value()));
+    }
+
+  private:
+    LogicIoPinSetting myLogicSetting;
+
+    bool logicFromRaw(bool value) const noexcept { return (LogicIoPinSetting::ACTIVE_HIGH == myLogicSetting) ? value : !value; }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
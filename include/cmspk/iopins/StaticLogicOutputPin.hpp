@@ -0,0 +1,114 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__STATIC_LOGIC_OUTPUT_PIN__HPP
+#define CMSPK__IOPINS__STATIC_LOGIC_OUTPUT_PIN__HPP
+#include <cstdint>
+#include <exception>
+
+#include "cmspk/iopins/LogicIoPinSetting.hpp"
+#include "cmspk/iopins/PinInstrumentation.hpp"
+#include "cmspk/iopins/StaticOutputPin.hpp"
+#include "cmspk/iopins/StaticPinHandles.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Abstraction of an output pin that can be **asserted/active** or **negated/inactive**, whose hooks are resolved at
+ * compile time.
+ *
+ * This is the static dispatch counterpart of `LogicOutputPin`, see `StaticOutputPin` for the requirements on `Derived`.
+ * Changing the logic setting invalidates the handles acquired so far.
+ *
+ * @param Derived the implementation class, deriving from this class.
+ * @param Instrumentation **optionnal**, the instrumentation policy of the operations, see `NoInstrumentation` and
+ *   `CountingInstrumentation`.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+class StaticLogicOutputPin : public StaticBinaryOutputPin<Derived, Instrumentation> {
+  public:
+    /**
+     * Type of the handle given by `acquireLogicWriter()`.
+     */
+    using LogicWriter = StaticLogicPinWriter<typename StaticBinaryOutputPin<Derived, Instrumentation>::Writer>;
+
+    ~StaticLogicOutputPin() noexcept {}
+
+    /**
+     * Fully define a logic I/O pin.
+     *
+     * @param id the native identification number of the pin.
+     * @param logicSetting **optionnal**, the initial logicSetting.
+     */
+    StaticLogicOutputPin(uint8_t id, LogicIoPinSetting logicSetting = LogicIoPinSetting::ACTIVE_HIGH) noexcept
+        : StaticBinaryOutputPin<Derived, Instrumentation>(id), myLogicSetting(logicSetting) {}
+
+    /**
+     * Accessor of `logicSetting` property.
+     *
+     * @returns the property's value.
+     */
+    LogicIoPinSetting getLogicSetting() const noexcept { return myLogicSetting; }
+
+    /**
+     * Mutator of `logicSetting` property.
+     *
+     * @param logicSetting the new value.
+     */
+    void setLogicSetting(LogicIoPinSetting logicSetting) noexcept {
+        if (logicSetting != myLogicSetting) {
+            this->invalidateCapabilities();
+        }
+        myLogicSetting = logicSetting;
+    }
+
+    /**
+     * Check the writability once, and get a handle to write the logic value of the pin without further checks.
+     *
+     * @returns the handle, or the reason why the pin is not writable.
+     */
+    std::expected<LogicWriter, IoFailureReason> acquireLogicWriter() noexcept {
+        std::expected<typename StaticBinaryOutputPin<Derived, Instrumentation>::Writer, IoFailureReason> writer = this->acquireWriter();
+        if (!writer.has_value()) {
+            return std::unexpected(writer.error());
+        }
+        return LogicWriter(writer.value(), LogicIoPinSetting::ACTIVE_LOW == myLogicSetting);
+    }
+
+    /**
+     * Write operation, the pin MUST have `WRITE` direction to be able to succeed.
+     *
+     * @param value the value to write to the I/O pin.
+     *
+     * @returns the result of the write operation.
+     */
+    std::expected<void, IoFailureReason> writeLogic(const bool value) noexcept { return this->write(rawFromLogic(value)); }
+
+    /**
+     * Wrapper calling `writeLogic(true)`.
+     *
+     * @returns the result of the write operation.
+     */
+    std::expected<void, IoFailureReason> toAsserted() noexcept { return writeLogic(true); }
+
+    /**
+     * Wrapper calling `writeLogic(false)`.
+     *
+     * @returns the result of the write operation.
+     */
+    std::expected<void, IoFailureReason> toNegated() noexcept { return writeLogic(false); }
+
+  private:
+    LogicIoPinSetting myLogicSetting;
+
+    bool rawFromLogic(bool value) const noexcept { return (LogicIoPinSetting::ACTIVE_HIGH == myLogicSetting) ? value : !value; }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,161 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for output pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__STATIC_OUTPUT_PIN__HPP
+#define CMSPK__IOPINS__STATIC_OUTPUT_PIN__HPP
+// standard includes
+#include <cstdint>
+#include <expected>
+
+// dependencies includes
+#include "cmspk/ucdev.hpp"
+
+// project includes
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/PinInstrumentation.hpp"
+#include "cmspk/iopins/StaticPinHandles.hpp"
+#include "cmspk/ucdev/ReadWriteAssertions.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * An abstraction of output pins, with a value represented by the given type, whose hooks are resolved at compile time.
+ *
+ * This is the static dispatch counterpart of `OutputPin` : the implementation `Derived` provides the non virtual hooks
+ * `checkWritability()` and `doWrite(const S)`, with the same signatures as their virtual counterparts, and they MUST
+ * be accessible from this class (e.g. by befriending it). Calls to `write()` can then be fully inlined.
+ *
+ * For inner loops, `acquireWriter()` checks the writability once and gives a `StaticPinWriter`, whose `writeRaw()` is
+ * the bare `doWrite()` ; the implementation MUST call `invalidateCapabilities()` when the writability of the pin
+ * changes, so that the handles acquired so far are seen as invalid.
+ *
+ * This base output pin has a fixed direction and cannot be reconfigured.
+ *
+ * @param Derived the implementation class, deriving from this class.
+ * @param S storage type for the value, typically a `bool` or an `uint8_t`
+ * @param Instrumentation **optionnal**, the instrumentation policy of the operations, see `NoInstrumentation` and
+ *   `CountingInstrumentation` ; the handles are not instrumented.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename S, typename Instrumentation = NoInstrumentation>
+class StaticOutputPin : public cmspk::ucdev::SimpleWritableDeviceAssertions, public CapabilityEpoch {
+    friend StaticPinWriter<StaticOutputPin, S>;
+
+  public:
+    /**
+     * Type of the handle given by `acquireWriter()`.
+     */
+    using Writer = StaticPinWriter<StaticOutputPin, S>;
+
+    ~StaticOutputPin() noexcept {}
+
+    /**
+     * Fully define an output pin.
+     *
+     * @param id the native identification number of the pin.
+     */
+    StaticOutputPin(uint8_t id) noexcept : id(id) {}
+
+    /**
+     * Get the pin id for the underlying microcontroller/board.
+     */
+    uint8_t getPinId() const noexcept { return id; }
+
+    /**
+     * Access to the instrumentation policy, e.g. to register its statistics.
+     */
+    Instrumentation& getInstrumentation() noexcept { return instrumentation; }
+
+    /**
+     * Write operation, the pin MUST be writable to be able to succeed.
+     *
+     * @param value the value to write to the I/O pin.
+     *
+     * @returns the result of the write operation.
+     */
+    std::expected<void, IoFailureReason> write(const S value) noexcept {
+        return instrumentOperation(instrumentation, PIN_OPERATION_WRITE, [&]() noexcept -> std::expected<void, IoFailureReason> {
+            Derived& self = static_cast<Derived&>(*this);
+            std::expected<void, IoFailureReason> writability = self.checkWritability();
+            if (!writability.has_value()) {
+                return writability;
+            }
+            return self.doWrite(value);
+        });
+    }
+
+    /**
+     * Check the writability once, and get a handle to write the pin without further checks.
+     *
+     * @returns the handle, or the reason why the pin is not writable.
+     */
+    std::expected<Writer, IoFailureReason> acquireWriter() noexcept {
+        std::expected<void, IoFailureReason> writability = static_cast<Derived&>(*this).checkWritability();
+        if (!writability.has_value()) {
+            return std::unexpected(writability.error());
+        }
+        return Writer(*this);
+    }
+
+  private:
+    uint8_t id;
+    [[no_unique_address]] Instrumentation instrumentation;
+
+    void writeUnchecked(const S value) noexcept { static_cast<Derived&>(*this).doWrite(value); }
+};
+
+/**
+ * Specialization of static output pins using a single bit (`bool`) to represent its values.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticBinaryOutputPin = StaticOutputPin<Derived, bool, Instrumentation>;
+
+/**
+ * Specialization of static output pins using an 8 bits wide integer (`uint8_t`) to represent its values.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticAnalogOutputPin8 = StaticOutputPin<Derived, uint8_t, Instrumentation>;
+
+/**
+ * Specialization of static output pins using a 16 bits wide integer (`uint16_t`) to represent its values.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticAnalogOutputPin16 = StaticOutputPin<Derived, uint16_t, Instrumentation>;
+
+/**
+ * Specialization of static output pins using a 32 bits wide integer (`uint32_t`) to represent its values.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticAnalogOutputPin32 = StaticOutputPin<Derived, uint32_t, Instrumentation>;
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
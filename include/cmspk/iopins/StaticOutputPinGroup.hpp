@@ -0,0 +1,231 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for output pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__STATIC_OUTPUT_PIN_GROUP__HPP
+#define CMSPK__IOPINS__STATIC_OUTPUT_PIN_GROUP__HPP
+
+// standard includes
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+
+// dependencies includes
+#include "cmspk/ucdev.hpp"
+
+// project includes
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/PinInstrumentation.hpp"
+#include "cmspk/iopins/StaticPinHandles.hpp"
+#include "cmspk/ucdev/ReadWriteAssertions.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * An abstraction of a group of digital (true/false) output pins of a given size, that is written all at once, whose
+ * hooks are resolved at compile time.
+ *
+ * This is the static dispatch counterpart of `OutputPinGroup` : the implementation `Derived` provides the non virtual
+ * hooks `checkWritability()` and `doWrite(std::bitset<N>)`, that MUST be accessible from this class (e.g. by
+ * befriending it).
+ *
+ * Like `StaticOutputPin`, `acquireWriter()` gives a handle to write the group without further checks ; likewise,
+ * `writeSequence()` checks the writability once for the whole sequence.
+ *
+ * @param Derived the implementation class, deriving from this class.
+ * @param N the size of the group.
+ * @param Instrumentation **optionnal**, the instrumentation policy of the operations, see `NoInstrumentation` and
+ *   `CountingInstrumentation` ; the handles are not instrumented.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, std::size_t N, typename Instrumentation = NoInstrumentation>
+class StaticOutputPinGroup : public cmspk::ucdev::SimpleWritableDeviceAssertions, public CapabilityEpoch {
+    friend StaticPinWriter<StaticOutputPinGroup, std::bitset<N>>;
+
+  public:
+    /**
+     * Type of the handle given by `acquireWriter()`.
+     */
+    using Writer = StaticPinWriter<StaticOutputPinGroup, std::bitset<N>>;
+
+    /**
+     * Function called after each sample of a sequence, to pace it, with the context given along with it ; none means
+     * as fast as possible.
+     */
+    using Pacing = void (*)(void* context);
+
+    ~StaticOutputPinGroup() noexcept {}
+
+    /**
+     * Fully define an output pin group.
+     *
+     * @param ids the N native identification numbers of the pins.
+     */
+    StaticOutputPinGroup(std::array<uint8_t, N> ids) noexcept : ids(ids) {}
+
+    /**
+     * Get the pin ids for the underlying microcontroller/board.
+     */
+    std::array<uint8_t, N> getPinIds() const noexcept { return ids; }
+
+    /**
+     * Access to the instrumentation policy, e.g. to register its statistics.
+     */
+    Instrumentation& getInstrumentation() noexcept { return instrumentation; }
+
+    /**
+     * Write operation, the group MUST be writable to be able to succeed.
+     *
+     * @param value the values to write to the I/O pins.
+     *
+     * @returns the result of the write operation.
+     */
+    std::expected<void, IoFailureReason> write(const std::bitset<N> value) noexcept {
+        return instrumentOperation(instrumentation, PIN_OPERATION_WRITE, [&]() noexcept -> std::expected<void, IoFailureReason> {
+            Derived& self = static_cast<Derived&>(*this);
+            std::expected<void, IoFailureReason> writability = self.checkWritability();
+            if (!writability.has_value()) {
+                return writability;
+            }
+            return self.doWrite(value);
+        });
+    }
+
+    /**
+     * Write a sequence of samples, e.g. to output a waveform, the writability is checked once.
+     *
+     * @param values the samples to write, in order.
+     * @param pacing **optionnal**, the function called after each sample.
+     * @param context **optionnal**, the context given to the pacing function.
+     * @returns the result of the output, that stops at the first failure.
+     */
+    std::expected<void, IoFailureReason> writeSequence(std::span<const std::bitset<N>> values, Pacing pacing = nullptr, void* context = nullptr) noexcept {
+        return instrumentOperation(instrumentation, PIN_OPERATION_WRITE_BURST, [&]() noexcept -> std::expected<void, IoFailureReason> {
+            Derived& self = static_cast<Derived&>(*this);
+            std::expected<void, IoFailureReason> writability = self.checkWritability();
+            if (!writability.has_value()) {
+                return writability;
+            }
+            for (const std::bitset<N>& value : values) {
+                std::expected<void, IoFailureReason> result = self.doWrite(value);
+                if (!result.has_value()) {
+                    return result;
+                }
+                if (nullptr != pacing) {
+                    pacing(context);
+                }
+            }
+            return std::expected<void, IoFailureReason>();
+        });
+    }
+
+    /**
+     * Check the writability once, and get a handle to write the group without further checks.
+     *
+     * @returns the handle, or the reason why the group is not writable.
+     */
+    std::expected<Writer, IoFailureReason> acquireWriter() noexcept {
+        std::expected<void, IoFailureReason> writability = static_cast<Derived&>(*this).checkWritability();
+        if (!writability.has_value()) {
+            return std::unexpected(writability.error());
+        }
+        return Writer(*this);
+    }
+
+  private:
+    std::array<uint8_t, N> ids;
+    [[no_unique_address]] Instrumentation instrumentation;
+
+    void writeUnchecked(const std::bitset<N> value) noexcept { static_cast<Derived&>(*this).doWrite(value); }
+};
+
+/**
+ * Alias for a static group of pins with 2 members.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticOutputPinPair = StaticOutputPinGroup<Derived, 2, Instrumentation>;
+
+/**
+ * Alias for a static group of pins with 3 members.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticOutputPinTrio = StaticOutputPinGroup<Derived, 3, Instrumentation>;
+
+/**
+ * Alias for a static group of pins with 4 members.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticOutputPinQuartet = StaticOutputPinGroup<Derived, 4, Instrumentation>;
+
+/**
+ * Alias for a static group of pins with 5 members.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticOutputPinQuintet = StaticOutputPinGroup<Derived, 5, Instrumentation>;
+
+/**
+ * Alias for a static group of pins with 6 members.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticOutputPinSextet = StaticOutputPinGroup<Derived, 6, Instrumentation>;
+
+/**
+ * Alias for a static group of pins with 7 members.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticOutputPinSeptet = StaticOutputPinGroup<Derived, 7, Instrumentation>;
+
+/**
+ * Alias for a static group of pins with 8 members.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Derived, typename Instrumentation = NoInstrumentation>
+using StaticOutputPinOctet = StaticOutputPinGroup<Derived, 8, Instrumentation>;
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,212 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__STATIC_PIN_HANDLES__HPP
+#define CMSPK__IOPINS__STATIC_PIN_HANDLES__HPP
+
+// standard includes
+#include <cstdint>
+
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Counter of the changes of capability of a pin (direction, logic setting, etc.), that invalidates the handles
+ * acquired before the change.
+ *
+ * The counter wraps around after 65536 changes, a handle kept through exactly that many changes would be seen as
+ * valid again.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class CapabilityEpoch {
+  public:
+    ~CapabilityEpoch() noexcept {}
+
+    /**
+     * Get the current epoch.
+     */
+    uint16_t getCapabilityEpoch() const noexcept { return epoch; }
+
+  protected:
+    /**
+     * Invalidate all the handles acquired so far, to be called by the implementation when the direction of the pin
+     * changes.
+     */
+    void invalidateCapabilities() noexcept { ++epoch; }
+
+  private:
+    uint16_t epoch = 0;
+};
+
+/**
+ * Handle to a readable static pin or pin group, whose readability has been checked once at acquisition, see
+ * `StaticInputPin::acquireReader()`.
+ *
+ * `readRaw()` calls the `doRead()` hook of the pin directly, without checking the readability nor propagating a
+ * failure : the handle is meant for inner loops where the failure path is known to be dead, the value read after a
+ * failure of `doRead()` is a default value. The caller SHOULD check `isValid()` whenever the capability of the pin may
+ * have changed since the acquisition.
+ *
+ * @param Pin the static base class of the pin.
+ * @param S the type of the value.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Pin, typename S>
+class StaticPinReader {
+    friend Pin;
+
+  public:
+    /**
+     * Tells whether the capability of the pin did not change since the acquisition.
+     */
+    bool isValid() const noexcept { return pin->getCapabilityEpoch() == epoch; }
+
+    /**
+     * Read the pin without any check.
+     */
+    S readRaw() noexcept { return pin->readUnchecked(); }
+
+  private:
+    Pin* pin;
+    uint16_t epoch;
+
+    StaticPinReader(Pin& pin) noexcept : pin(&pin), epoch(pin.getCapabilityEpoch()) {}
+};
+
+/**
+ * Handle to a writable static pin or pin group, whose writability has been checked once at acquisition, see
+ * `StaticOutputPin::acquireWriter()`.
+ *
+ * `writeRaw()` calls the `doWrite()` hook of the pin directly, without checking the writability nor propagating a
+ * failure, see `StaticPinReader`.
+ *
+ * @param Pin the static base class of the pin.
+ * @param S the type of the value.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Pin, typename S>
+class StaticPinWriter {
+    friend Pin;
+
+  public:
+    /**
+     * Tells whether the capability of the pin did not change since the acquisition.
+     */
+    bool isValid() const noexcept { return pin->getCapabilityEpoch() == epoch; }
+
+    /**
+     * Write the pin without any check.
+     */
+    void writeRaw(const S value) noexcept { pin->writeUnchecked(value); }
+
+  private:
+    Pin* pin;
+    uint16_t epoch;
+
+    StaticPinWriter(Pin& pin) noexcept : pin(&pin), epoch(pin.getCapabilityEpoch()) {}
+};
+
+/**
+ * Handle to a readable static logic pin, with the logic setting captured at acquisition, see
+ * `StaticLogicInputPin::acquireLogicReader()` ; changing the logic setting invalidates the handle.
+ *
+ * @param Reader the raw reader type.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Reader>
+class StaticLogicPinReader {
+  public:
+    /**
+     * Fully define a logic reader.
+     *
+     * @param reader the raw reader.
+     * @param activeLow `true` when the logic setting is `ACTIVE_LOW`.
+     */
+    StaticLogicPinReader(Reader reader, bool activeLow) noexcept : reader(reader), activeLow(activeLow) {}
+
+    /**
+     * Tells whether the capability of the pin did not change since the acquisition.
+     */
+    bool isValid() const noexcept { return reader.isValid(); }
+
+    /**
+     * Read the pin without any check.
+     */
+    bool readRaw() noexcept { return reader.readRaw(); }
+
+    /**
+     * Read the logic value of the pin without any check.
+     */
+    bool readLogicRaw() noexcept { return reader.readRaw() != activeLow; }
+
+  private:
+    Reader reader;
+    bool activeLow;
+};
+
+/**
+ * Handle to a writable static logic pin, with the logic setting captured at acquisition, see
+ * `StaticLogicOutputPin::acquireLogicWriter()` ; changing the logic setting invalidates the handle.
+ *
+ * @param Writer the raw writer type.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <typename Writer>
+class StaticLogicPinWriter {
+  public:
+    /**
+     * Fully define a logic writer.
+     *
+     * @param writer the raw writer.
+     * @param activeLow `true` when the logic setting is `ACTIVE_LOW`.
+     */
+    StaticLogicPinWriter(Writer writer, bool activeLow) noexcept : writer(writer), activeLow(activeLow) {}
+
+    /**
+     * Tells whether the capability of the pin did not change since the acquisition.
+     */
+    bool isValid() const noexcept { return writer.isValid(); }
+
+    /**
+     * Write the pin without any check.
+     */
+    void writeRaw(const bool value) noexcept { writer.writeRaw(value); }
+
+    /**
+     * Write the logic value of the pin without any check.
+     */
+    void writeLogicRaw(const bool value) noexcept { writer.writeRaw(value != activeLow); }
+
+  private:
+    Writer writer;
+    bool activeLow;
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,106 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__VERTICAL_COUNTER_DEBOUNCER__HPP
+#define CMSPK__IOPINS__VERTICAL_COUNTER_DEBOUNCER__HPP
+
+// standard includes
+#include <array>
+#include <bit>
+#include <bitset>
+#include <cstddef>
+
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Debouncing engine for N binary channels at once, using vertical counters.
+ *
+ * Each channel has a counter of consecutive samples differing from its debounced state ; the counters are stored as
+ * bit planes (plane `k` holds the bit `k` of every counter), so that a sample is processed with a few bitwise
+ * operations per plane, whatever the number of channels (as long as they fit in a machine word).
+ *
+ * The debounced state of a channel changes after `Samples` consecutive samples differing from it.
+ *
+ * @param N the number of channels.
+ * @param Samples the number of consecutive samples required to accept a change, MUST be at least 1.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N, std::size_t Samples>
+class VerticalCounterDebouncer {
+    static_assert(Samples >= 1, "Samples MUST be at least 1");
+
+  public:
+    /**
+     * Number of bit planes of the counters.
+     */
+    static constexpr std::size_t PLANES = std::bit_width(Samples);
+
+    /**
+     * Fully define a debouncer.
+     *
+     * @param initialState **optionnal**, the initial debounced state of the channels.
+     */
+    VerticalCounterDebouncer(std::bitset<N> initialState = std::bitset<N>()) noexcept : state(initialState) {}
+
+    /**
+     * Process a new sample of all the channels.
+     *
+     * @param raw the raw values of the channels.
+     *
+     * @returns the debounced state of the channels.
+     */
+    std::bitset<N> sample(const std::bitset<N> raw) noexcept {
+        std::bitset<N> pending = raw ^ state;
+
+        // increment the counters of pending channels, reset the others
+        std::bitset<N> carry = pending;
+        for (std::size_t k = 0; k < PLANES; ++k) {
+            std::bitset<N> plane = planes[k];
+            planes[k] = (plane ^ carry) & pending;
+            carry &= plane;
+        }
+
+        // accept the channels whose counter reached the number of samples
+        std::bitset<N> reached = pending;
+        for (std::size_t k = 0; k < PLANES; ++k) {
+            reached &= ((Samples >> k) & 1u) ? planes[k] : ~planes[k];
+        }
+        state ^= reached;
+        for (std::size_t k = 0; k < PLANES; ++k) {
+            planes[k] &= ~reached;
+        }
+        return state;
+    }
+
+    /**
+     * Get the debounced state of the channels.
+     */
+    std::bitset<N> getState() const noexcept { return state; }
+
+    /**
+     * Force the debounced state of the channels, and clear the counters.
+     *
+     * @param newState the new debounced state.
+     */
+    void reset(std::bitset<N> newState = std::bitset<N>()) noexcept {
+        state = newState;
+        planes = {};
+    }
+
+  private:
+    std::bitset<N> state;
+    std::array<std::bitset<N>, PLANES> planes{};
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,38 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SIM__HPP
+#define CMSPK__IOPINS__SIM__HPP
+// ================[ CODE BEGINS ]================
+
+// Simulators of I/O pins, ports and devices, to run the code using I/O pins on a host computer, e.g. for unit tests ;
+// and other helpers for the host, like `SteadyInstrumentationClock`.
+//
+// They need a hosted environment (e.g. `std::vector`, `std::chrono::steady_clock`), hence `cmspk/iopins.hpp`, that
+// firmwares include, does NOT include them.
+
+#include "cmspk/iopins/sim/SimulatedChangeNotifyingInputPin.hpp"
+#include "cmspk/iopins/sim/SimulatedI2cTarget.hpp"
+#include "cmspk/iopins/sim/SimulatedInputPin.hpp"
+#include "cmspk/iopins/sim/SimulatedInputPinGroup.hpp"
+#include "cmspk/iopins/sim/SimulatedIoPin.hpp"
+#include "cmspk/iopins/sim/SimulatedIoPinGroup.hpp"
+#include "cmspk/iopins/sim/SimulatedLogicInputPin.hpp"
+#include "cmspk/iopins/sim/SimulatedLogicOutputPin.hpp"
+#include "cmspk/iopins/sim/SimulatedMultiPortInputPinGroup.hpp"
+#include "cmspk/iopins/sim/SimulatedMultiPortOutputPinGroup.hpp"
+#include "cmspk/iopins/sim/SimulatedOpenDrainPin.hpp"
+#include "cmspk/iopins/sim/SimulatedOutputPin.hpp"
+#include "cmspk/iopins/sim/SimulatedOutputPinGroup.hpp"
+#include "cmspk/iopins/sim/SimulatedOutputPort.hpp"
+#include "cmspk/iopins/sim/SimulatedPinBank.hpp"
+#include "cmspk/iopins/sim/SimulatedPortExpander.hpp"
+#include "cmspk/iopins/sim/SteadyInstrumentationClock.hpp"
+// ================[ END OF CODE ]================
+#endif
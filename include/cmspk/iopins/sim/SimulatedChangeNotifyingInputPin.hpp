@@ -0,0 +1,76 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SIM__SIMULATED_CHANGE_NOTIFYING_INPUT_PIN__HPP
+#define CMSPK__IOPINS__SIM__SIMULATED_CHANGE_NOTIFYING_INPUT_PIN__HPP
+
+// standard includes
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/ChangeNotifyingInputPin.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Change notifying input pin driven by the outside world, for host-side tests and benchmarks.
+ *
+ * The thread calling `drive()` plays the role of the interrupt context : when the level changes, it notifies the edge
+ * like an interrupt handler would ; e.g. a dedicated thread simulates an interrupt source, while the main thread
+ * dispatches the events or polls the pin. All the pins sharing a queue MUST be driven from the same thread.
+ *
+ * @param Capacity the capacity of the queue.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t Capacity>
+class SimulatedChangeNotifyingInputPin final : public ChangeNotifyingInputPin<Capacity> {
+  public:
+    ~SimulatedChangeNotifyingInputPin() noexcept {}
+
+    /**
+     * Fully define a simulated change notifying input pin, initially low.
+     *
+     * @param id the native identification number of the pin.
+     * @param queue the queue receiving the events.
+     * @param channel the channel of the pin, given in the events.
+     */
+    SimulatedChangeNotifyingInputPin(uint8_t id, EdgeEventQueue<Capacity>& queue, uint8_t channel) noexcept
+        : ChangeNotifyingInputPin<Capacity>(id, queue, channel) {}
+
+    /**
+     * Drive the level of the pin, and notify the edge when it changed, **interrupt context only**.
+     *
+     * @param level the new level.
+     * @param timestamp the time of the change.
+     * @returns `false` when the level changed but the event has been dropped because the queue was full.
+     */
+    bool drive(bool level, uint32_t timestamp) noexcept {
+        if (level == this->level.exchange(level, std::memory_order_release)) {
+            return true;
+        }
+        return this->notifyEdge(level, timestamp);
+    }
+
+  private:
+    std::atomic<bool> level{false};
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<bool, IoFailureReason> doRead() noexcept { return level.load(std::memory_order_acquire); }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
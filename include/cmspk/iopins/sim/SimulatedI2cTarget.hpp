@@ -0,0 +1,273 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SIM__SIMULATED_I2C_TARGET__HPP
+#define CMSPK__IOPINS__SIM__SIMULATED_I2C_TARGET__HPP
+
+// standard includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// project includes
+#include "cmspk/iopins/sim/SimulatedPinBank.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * I2C target with a file of 256 registers, wired to two pins of a port of a `SimulatedPinBank` as a device of the
+ * outside world.
+ *
+ * The target registers itself as the listener of the bank, so that it follows the lines at each access of the
+ * micro-controller ; it only pulls the lines low or releases them, the pull-up resistors of the bus are modelled by the
+ * pull-up of both pins.
+ *
+ * Protocol : a write transaction sends the register address then the values to write ; a read transaction sends the
+ * values starting from the current register address. The register address is incremented after each value and wraps
+ * around.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class SimulatedI2cTarget {
+  public:
+    /**
+     * Unregister the target from the bank.
+     */
+    ~SimulatedI2cTarget() noexcept { bank.setListener(nullptr, nullptr); }
+
+    /**
+     * Fully define a target, and register it as the listener of the bank.
+     *
+     * @param bank the simulated bank.
+     * @param port the port of the lines.
+     * @param sclBit the position of the clock line inside the port.
+     * @param sdaBit the position of the data line inside the port.
+     * @param address the 7-bits address of the target.
+     */
+    SimulatedI2cTarget(SimulatedPinBank& bank, std::size_t port, uint8_t sclBit, uint8_t sdaBit, uint8_t address) noexcept
+        : bank(bank), port(port), sclMask(SimulatedPinBank::bitOf(sclBit)), sdaMask(SimulatedPinBank::bitOf(sdaBit)), address(address) {
+        bank.setPull(port, sclBit, SimulatedPull::PULL_UP);
+        bank.setPull(port, sdaBit, SimulatedPull::PULL_UP);
+        SimulatedPinBank::Word levels = bank.getLevels(port);
+        lastScl = levels & sclMask;
+        lastSda = levels & sdaMask;
+        bank.setListener(&SimulatedI2cTarget::onAccess, this);
+    }
+
+    SimulatedI2cTarget(const SimulatedI2cTarget&) = delete;
+    SimulatedI2cTarget& operator=(const SimulatedI2cTarget&) = delete;
+
+    /**
+     * Get the value of a register.
+     */
+    uint8_t getRegister(uint8_t index) const noexcept { return registers[index]; }
+
+    /**
+     * Change the value of a register.
+     */
+    void setRegister(uint8_t index, uint8_t value) noexcept { registers[index] = value; }
+
+    /**
+     * Make the target hold the clock line low after each received byte, for the given duration.
+     *
+     * @param ticks the duration in ticks of the clock of the bank, 0 to disable the stretching.
+     */
+    void setClockStretching(uint64_t ticks) noexcept { stretchTicks = ticks; }
+
+    /**
+     * Get the number of start conditions seen, including the repeated starts.
+     */
+    uint32_t getStartCount() const noexcept { return starts; }
+
+    /**
+     * Get the number of stop conditions seen.
+     */
+    uint32_t getStopCount() const noexcept { return stops; }
+
+    /**
+     * Get the number of times the clock line has been stretched.
+     */
+    uint32_t getStretchCount() const noexcept { return stretches; }
+
+  private:
+    enum Phase { IDLE, RECEIVE, ACKNOWLEDGE, TRANSMIT, WAIT_ACKNOWLEDGE };
+    enum ByteRole { ADDRESS, REGISTER, DATA };
+
+    SimulatedPinBank& bank;
+    std::size_t port;
+    SimulatedPinBank::Word sclMask;
+    SimulatedPinBank::Word sdaMask;
+    uint8_t address;
+    std::array<uint8_t, 256> registers{};
+    uint8_t pointer = 0;
+
+    bool lastScl;
+    bool lastSda;
+    Phase phase = IDLE;
+    ByteRole role = ADDRESS;
+    bool reading = false;
+    bool masterAcknowledged = false;
+    uint8_t shift = 0;
+    int bits = 0;
+
+    uint64_t stretchTicks = 0;
+    uint64_t stretchUntil = 0;
+    bool stretching = false;
+
+    uint32_t starts = 0;
+    uint32_t stops = 0;
+    uint32_t stretches = 0;
+
+    static void onAccess(void* context) noexcept { static_cast<SimulatedI2cTarget*>(context)->update(); }
+
+    void update() noexcept {
+        if (stretching && bank.now() >= stretchUntil) {
+            bank.release(port, sclMask);
+            stretching = false;
+        }
+        SimulatedPinBank::Word levels = bank.getLevels(port);
+        bool scl = levels & sclMask;
+        bool sda = levels & sdaMask;
+        if (scl && lastScl) {
+            if (lastSda && !sda) {
+                onStart();
+            } else if (!lastSda && sda) {
+                onStop();
+            }
+        } else if (scl) {
+            onRisingEdge(sda);
+        } else if (lastScl) {
+            onFallingEdge();
+        }
+        // the lines as they are after the reaction of the target
+        levels = bank.getLevels(port);
+        lastScl = levels & sclMask;
+        lastSda = levels & sdaMask;
+    }
+
+    void onStart() noexcept {
+        ++starts;
+        phase = RECEIVE;
+        role = ADDRESS;
+        shift = 0;
+        bits = 0;
+        releaseData();
+    }
+
+    void onStop() noexcept {
+        ++stops;
+        phase = IDLE;
+        releaseData();
+    }
+
+    void onRisingEdge(bool sda) noexcept {
+        if (RECEIVE == phase) {
+            shift = static_cast<uint8_t>((shift << 1) | static_cast<uint8_t>(sda));
+            ++bits;
+        } else if (WAIT_ACKNOWLEDGE == phase) {
+            masterAcknowledged = !sda;
+        }
+    }
+
+    void onFallingEdge() noexcept {
+        switch (phase) {
+            case RECEIVE:
+                if (8 == bits) {
+                    if (accept(shift)) {
+                        bank.drive(port, sdaMask, 0);
+                        phase = ACKNOWLEDGE;
+                        stretch();
+                    } else {
+                        phase = IDLE;
+                    }
+                }
+                break;
+            case ACKNOWLEDGE:
+                releaseData();
+                if (reading) {
+                    startTransmit();
+                } else {
+                    phase = RECEIVE;
+                    shift = 0;
+                    bits = 0;
+                }
+                break;
+            case TRANSMIT:
+                ++bits;
+                if (bits < 8) {
+                    driveData((shift >> (7 - bits)) & 1u);
+                } else {
+                    releaseData();
+                    phase = WAIT_ACKNOWLEDGE;
+                }
+                break;
+            case WAIT_ACKNOWLEDGE:
+                if (masterAcknowledged) {
+                    startTransmit();
+                } else {
+                    phase = IDLE;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    bool accept(uint8_t value) noexcept {
+        switch (role) {
+            case ADDRESS:
+                if ((value >> 1) != address) {
+                    return false;
+                }
+                reading = value & 1u;
+                role = REGISTER;
+                return true;
+            case REGISTER:
+                pointer = value;
+                role = DATA;
+                return true;
+            default:
+                registers[pointer++] = value;
+                return true;
+        }
+    }
+
+    void startTransmit() noexcept {
+        phase = TRANSMIT;
+        shift = registers[pointer++];
+        bits = 0;
+        driveData(shift >> 7);
+    }
+
+    void stretch() noexcept {
+        if (0 == stretchTicks) {
+            return;
+        }
+        bank.drive(port, sclMask, 0);
+        stretchUntil = bank.now() + stretchTicks;
+        stretching = true;
+        ++stretches;
+    }
+
+    void driveData(bool level) noexcept {
+        if (level) {
+            releaseData();
+        } else {
+            bank.drive(port, sdaMask, 0);
+        }
+    }
+
+    void releaseData() noexcept { bank.release(port, sdaMask); }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
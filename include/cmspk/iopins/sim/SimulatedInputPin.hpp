@@ -0,0 +1,69 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SIM__SIMULATED_INPUT_PIN__HPP
+#define CMSPK__IOPINS__SIM__SIMULATED_INPUT_PIN__HPP
+
+// standard includes
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/InputPin.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/sim/SimulatedPinBank.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Binary input pin bound to a pin of a `SimulatedPinBank`, the pin id is the position of the pin inside its port.
+ *
+ * The pin is readable only when the simulated pin has the `READ` direction.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class SimulatedInputPin final : public BinaryInputPin {
+  public:
+    ~SimulatedInputPin() noexcept {}
+
+    /**
+     * Fully define a simulated input pin.
+     *
+     * @param bank the simulated bank.
+     * @param port the port of the pin.
+     * @param bit the position of the pin inside its port, also the pin id ; a pin beyond the width of the port is never
+     * readable.
+     */
+    SimulatedInputPin(SimulatedPinBank& bank, std::size_t port, uint8_t bit) noexcept
+        : BinaryInputPin(bit), bank(bank), port(port), mask(SimulatedPinBank::bitOf(bit)) {}
+
+    /**
+     * Get the port of the pin.
+     */
+    std::size_t getPort() const noexcept { return port; }
+
+  private:
+    SimulatedPinBank& bank;
+    std::size_t port;
+    SimulatedPinBank::Word mask;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept {
+        if (0 == mask) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+        }
+        return bank.checkReadable(port, mask);
+    }
+    virtual std::expected<bool, IoFailureReason> doRead() noexcept { return 0 != (bank.readPort(port) & mask); }
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
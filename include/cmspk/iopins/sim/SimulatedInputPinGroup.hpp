@@ -0,0 +1,77 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SIM__SIMULATED_INPUT_PIN_GROUP__HPP
+#define CMSPK__IOPINS__SIM__SIMULATED_INPUT_PIN_GROUP__HPP
+
+// standard includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/BitGatherPlan.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/PortInputPinGroup.hpp"
+#include "cmspk/iopins/sim/SimulatedPinBank.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Group of input pins bound to pins of the same port of a `SimulatedPinBank`, the pin ids are the positions of the
+ * pins inside the port. The port is read once per `read()`.
+ *
+ * @param N the size of the group.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N>
+class SimulatedInputPinGroup final : public PortInputPinGroup<N, SimulatedPinBank::Word> {
+  public:
+    ~SimulatedInputPinGroup() noexcept {}
+
+    /**
+     * Fully define a simulated input pin group.
+     *
+     * @param bank the simulated bank.
+     * @param port the port of the pins.
+     * @param ids the positions of the pins inside the port.
+     */
+    SimulatedInputPinGroup(SimulatedPinBank& bank, std::size_t port, std::array<uint8_t, N> ids) noexcept
+        : PortInputPinGroup<N, SimulatedPinBank::Word>(ids), bank(bank), port(port) {}
+
+    /**
+     * Fully define a simulated input pin group with a precomputed plan, e.g. from a `BoardPinGroup`.
+     *
+     * @param bank the simulated bank.
+     * @param port the port of the pins.
+     * @param ids the positions of the pins inside the port.
+     * @param plan the gather plan of the pins.
+     */
+    SimulatedInputPinGroup(SimulatedPinBank& bank, std::size_t port, std::array<uint8_t, N> ids, const BitGatherPlan<N, SimulatedPinBank::Word>& plan) noexcept
+        : PortInputPinGroup<N, SimulatedPinBank::Word>(ids, plan), bank(bank), port(port) {}
+
+    /**
+     * Get the port of the pins.
+     */
+    std::size_t getPort() const noexcept { return port; }
+
+  private:
+    SimulatedPinBank& bank;
+    std::size_t port;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return bank.checkReadable(port, this->getGatherPlan().getMask()); }
+    virtual std::expected<SimulatedPinBank::Word, IoFailureReason> doReadPort() noexcept { return bank.readPort(port); }
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,73 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SIM__SIMULATED_IO_PIN__HPP
+#define CMSPK__IOPINS__SIM__SIMULATED_IO_PIN__HPP
+
+// standard includes
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/IoDirection.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/IoPin.hpp"
+#include "cmspk/iopins/sim/SimulatedPinBank.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Bidirectional pin bound to a pin of a `SimulatedPinBank`, the pin id is the position of the pin inside its port.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class SimulatedIoPin final : public BinaryIoPin {
+  public:
+    ~SimulatedIoPin() noexcept {}
+
+    /**
+     * Fully define a simulated bidirectional pin.
+     *
+     * @param bank the simulated bank.
+     * @param port the port of the pin.
+     * @param bit the position of the pin inside its port, also the pin id ; a pin beyond the width of the port is never
+     * readable nor writable.
+     */
+    SimulatedIoPin(SimulatedPinBank& bank, std::size_t port, uint8_t bit) noexcept
+        : BinaryIoPin(bit), bank(bank), port(port), mask(SimulatedPinBank::bitOf(bit)) {}
+
+    /**
+     * Get the port of the pin.
+     */
+    std::size_t getPort() const noexcept { return port; }
+
+  private:
+    SimulatedPinBank& bank;
+    std::size_t port;
+    SimulatedPinBank::Word mask;
+
+    virtual std::expected<void, IoFailureReason> doSetDirection(IoDirection value) noexcept {
+        if (0 == mask && IoDirection::HIGH_Z != value) {
+            return std::unexpected(IoDirection::READ == value ? IoFailureReason::FAILURE_PIN_IS_NOT_READABLE : IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+        }
+        bank.setDirection(port, getPinId(), value);
+        return std::expected<void, IoFailureReason>();
+    }
+    virtual std::expected<bool, IoFailureReason> doRead() noexcept { return 0 != (bank.readPort(port) & mask); }
+    virtual std::expected<void, IoFailureReason> doWrite(const bool value) noexcept {
+        bank.writePort(port, mask, value ? mask : 0);
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
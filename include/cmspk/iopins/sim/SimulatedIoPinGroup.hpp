@@ -0,0 +1,76 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SIM__SIMULATED_IO_PIN_GROUP__HPP
+#define CMSPK__IOPINS__SIM__SIMULATED_IO_PIN_GROUP__HPP
+
+// standard includes
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/BitGatherPlan.hpp"
+#include "cmspk/iopins/IoDirection.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/IoPinGroup.hpp"
+#include "cmspk/iopins/sim/SimulatedPinBank.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Group of bidirectional pins bound to pins of the same port of a `SimulatedPinBank`, the pin ids are the positions of
+ * the pins inside the port. The port is accessed once per `read()`, `write()` or change of direction.
+ *
+ * @param N the size of the group.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N>
+class SimulatedIoPinGroup final : public IoPinGroup<N> {
+  public:
+    ~SimulatedIoPinGroup() noexcept {}
+
+    /**
+     * Fully define a simulated bidirectional pin group.
+     *
+     * @param bank the simulated bank.
+     * @param port the port of the pins.
+     * @param ids the positions of the pins inside the port.
+     */
+    SimulatedIoPinGroup(SimulatedPinBank& bank, std::size_t port, std::array<uint8_t, N> ids) noexcept
+        : IoPinGroup<N>(ids), bank(bank), port(port), plan(ids) {}
+
+    /**
+     * Get the port of the pins.
+     */
+    std::size_t getPort() const noexcept { return port; }
+
+  private:
+    SimulatedPinBank& bank;
+    std::size_t port;
+    BitGatherPlan<N, SimulatedPinBank::Word> plan;
+
+    virtual std::expected<void, IoFailureReason> doSetDirection(IoDirection value) noexcept {
+        bank.setDirections(port, plan.getMask(), value);
+        return std::expected<void, IoFailureReason>();
+    }
+    virtual std::expected<std::bitset<N>, IoFailureReason> doRead() noexcept { return std::bitset<N>(plan.gather(bank.readPort(port))); }
+    virtual std::expected<void, IoFailureReason> doWrite(const std::bitset<N> value) noexcept {
+        bank.writePort(port, plan.getMask(), plan.scatter(static_cast<SimulatedPinBank::Word>(value.to_ullong())));
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,68 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SIM__SIMULATED_MULTI_PORT_INPUT_PIN_GROUP__HPP
+#define CMSPK__IOPINS__SIM__SIMULATED_MULTI_PORT_INPUT_PIN_GROUP__HPP
+
+// standard includes
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/MultiPortInputPinGroup.hpp"
+#include "cmspk/iopins/PortSlice.hpp"
+#include "cmspk/iopins/sim/SimulatedPinBank.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Group of input pins spanning several ports of a `SimulatedPinBank`, see `MultiPortInputPinGroup`. Each port is read
+ * once per `read()`.
+ *
+ * @param N the size of the group.
+ * @param Ports the number of slices.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N, std::size_t Ports>
+class SimulatedMultiPortInputPinGroup final : public MultiPortInputPinGroup<N, Ports, SimulatedPinBank::Word> {
+  public:
+    ~SimulatedMultiPortInputPinGroup() noexcept {}
+
+    /**
+     * Fully define a simulated multi-port input pin group.
+     *
+     * @param bank the simulated bank.
+     * @param layout the slices of the group, the counts of the slices MUST add up to N and the slices MUST fit inside the
+     * port register word.
+     */
+    SimulatedMultiPortInputPinGroup(SimulatedPinBank& bank, const PortSliceLayout<N, Ports, SimulatedPinBank::Word>& layout) noexcept
+        : MultiPortInputPinGroup<N, Ports, SimulatedPinBank::Word>(layout), bank(bank) {}
+
+  private:
+    SimulatedPinBank& bank;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept {
+        for (std::size_t s = 0; s < Ports; ++s) {
+            std::expected<void, IoFailureReason> result = bank.checkReadable(this->getLayout().getSlice(s).port, this->getLayout().getMask(s));
+            if (!result.has_value()) {
+                return result;
+            }
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+    virtual std::expected<SimulatedPinBank::Word, IoFailureReason> doReadPort(uint8_t port) noexcept { return bank.readPort(port); }
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,71 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SIM__SIMULATED_MULTI_PORT_OUTPUT_PIN_GROUP__HPP
+#define CMSPK__IOPINS__SIM__SIMULATED_MULTI_PORT_OUTPUT_PIN_GROUP__HPP
+
+// standard includes
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/MultiPortOutputPinGroup.hpp"
+#include "cmspk/iopins/PortSlice.hpp"
+#include "cmspk/iopins/sim/SimulatedPinBank.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Group of output pins spanning several ports of a `SimulatedPinBank`, see `MultiPortOutputPinGroup`. Each port is
+ * written once per `write()`.
+ *
+ * @param N the size of the group.
+ * @param Ports the number of slices.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N, std::size_t Ports>
+class SimulatedMultiPortOutputPinGroup final : public MultiPortOutputPinGroup<N, Ports, SimulatedPinBank::Word> {
+  public:
+    ~SimulatedMultiPortOutputPinGroup() noexcept {}
+
+    /**
+     * Fully define a simulated multi-port output pin group.
+     *
+     * @param bank the simulated bank.
+     * @param layout the slices of the group, the counts of the slices MUST add up to N and the slices MUST fit inside the
+     * port register word.
+     */
+    SimulatedMultiPortOutputPinGroup(SimulatedPinBank& bank, const PortSliceLayout<N, Ports, SimulatedPinBank::Word>& layout) noexcept
+        : MultiPortOutputPinGroup<N, Ports, SimulatedPinBank::Word>(layout), bank(bank) {}
+
+  private:
+    SimulatedPinBank& bank;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept {
+        for (std::size_t s = 0; s < Ports; ++s) {
+            std::expected<void, IoFailureReason> result = bank.checkWritable(this->getLayout().getSlice(s).port, this->getLayout().getMask(s));
+            if (!result.has_value()) {
+                return result;
+            }
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+    virtual std::expected<void, IoFailureReason> doWritePort(uint8_t port, SimulatedPinBank::Word mask, SimulatedPinBank::Word values) noexcept {
+        bank.writePort(port, mask, values);
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,80 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SIM__SIMULATED_OPEN_DRAIN_PIN__HPP
+#define CMSPK__IOPINS__SIM__SIMULATED_OPEN_DRAIN_PIN__HPP
+
+// standard includes
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/IoDirection.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/OpenDrainPin.hpp"
+#include "cmspk/iopins/sim/SimulatedPinBank.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Open-drain pin bound to a pin of a `SimulatedPinBank`, the pin id is the position of the pin inside its port.
+ *
+ * The line is high only when released and pulled up, i.e. the simulated pin SHOULD have a pull-up, and when no other
+ * device of the outside world drives it low.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class SimulatedOpenDrainPin final : public OpenDrainPin {
+  public:
+    ~SimulatedOpenDrainPin() noexcept {}
+
+    /**
+     * Fully define a simulated open-drain pin.
+     *
+     * @param bank the simulated bank.
+     * @param port the port of the pin.
+     * @param bit the position of the pin inside its port, also the pin id ; a pin beyond the width of the port is never
+     * readable nor writable.
+     */
+    SimulatedOpenDrainPin(SimulatedPinBank& bank, std::size_t port, uint8_t bit) noexcept
+        : OpenDrainPin(bit), bank(bank), port(port), mask(SimulatedPinBank::bitOf(bit)) {}
+
+    /**
+     * Get the port of the pin.
+     */
+    std::size_t getPort() const noexcept { return port; }
+
+  private:
+    SimulatedPinBank& bank;
+    std::size_t port;
+    SimulatedPinBank::Word mask;
+
+    virtual std::expected<void, IoFailureReason> doSetDirection(IoDirection value) noexcept {
+        if (0 == mask && IoDirection::HIGH_Z != value) {
+            return std::unexpected(IoDirection::READ == value ? IoFailureReason::FAILURE_PIN_IS_NOT_READABLE : IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+        }
+        if (IoDirection::WRITE == value && 0 != (bank.getLatch(port) & mask)) {
+            bank.writePort(port, mask, 0);
+        }
+        bank.setDirection(port, getPinId(), value);
+        return std::expected<void, IoFailureReason>();
+    }
+    virtual std::expected<bool, IoFailureReason> doRead() noexcept {
+        if (0 == mask) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+        }
+        return 0 != (bank.readPort(port) & mask);
+    }
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,72 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SIM__SIMULATED_OUTPUT_PIN__HPP
+#define CMSPK__IOPINS__SIM__SIMULATED_OUTPUT_PIN__HPP
+
+// standard includes
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/OutputPin.hpp"
+#include "cmspk/iopins/sim/SimulatedPinBank.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Binary output pin bound to a pin of a `SimulatedPinBank`, the pin id is the position of the pin inside its port.
+ *
+ * The pin is writable only when the simulated pin has the `WRITE` direction.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class SimulatedOutputPin final : public BinaryOutputPin {
+  public:
+    ~SimulatedOutputPin() noexcept {}
+
+    /**
+     * Fully define a simulated output pin.
+     *
+     * @param bank the simulated bank.
+     * @param port the port of the pin.
+     * @param bit the position of the pin inside its port, also the pin id ; a pin beyond the width of the port is never
+     * writable.
+     */
+    SimulatedOutputPin(SimulatedPinBank& bank, std::size_t port, uint8_t bit) noexcept
+        : BinaryOutputPin(bit), bank(bank), port(port), mask(SimulatedPinBank::bitOf(bit)) {}
+
+    /**
+     * Get the port of the pin.
+     */
+    std::size_t getPort() const noexcept { return port; }
+
+  private:
+    SimulatedPinBank& bank;
+    std::size_t port;
+    SimulatedPinBank::Word mask;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept {
+        if (0 == mask) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+        }
+        return bank.checkWritable(port, mask);
+    }
+    virtual std::expected<void, IoFailureReason> doWrite(const bool value) noexcept {
+        bank.writePort(port, mask, value ? mask : 0);
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
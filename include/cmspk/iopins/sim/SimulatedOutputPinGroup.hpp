@@ -0,0 +1,97 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SIM__SIMULATED_OUTPUT_PIN_GROUP__HPP
+#define CMSPK__IOPINS__SIM__SIMULATED_OUTPUT_PIN_GROUP__HPP
+
+// standard includes
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+
+// project includes
+#include "cmspk/iopins/BitGatherPlan.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/OutputPinGroup.hpp"
+#include "cmspk/iopins/sim/SimulatedPinBank.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Group of output pins bound to pins of the same port of a `SimulatedPinBank`, the pin ids are the positions of the
+ * pins inside the port. The port is written once per `write()`, and once per sample of `writeSequence()`, whose
+ * writability is checked once, like a DMA transfer.
+ *
+ * @param N the size of the group.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+template <std::size_t N>
+class SimulatedOutputPinGroup final : public OutputPinGroup<N> {
+  public:
+    ~SimulatedOutputPinGroup() noexcept {}
+
+    /**
+     * Fully define a simulated output pin group.
+     *
+     * @param bank the simulated bank.
+     * @param port the port of the pins.
+     * @param ids the positions of the pins inside the port.
+     */
+    SimulatedOutputPinGroup(SimulatedPinBank& bank, std::size_t port, std::array<uint8_t, N> ids) noexcept
+        : OutputPinGroup<N>(ids), bank(bank), port(port), plan(ids) {}
+
+    /**
+     * Fully define a simulated output pin group with a precomputed plan, e.g. from a `BoardPinGroup`.
+     *
+     * @param bank the simulated bank.
+     * @param port the port of the pins.
+     * @param ids the positions of the pins inside the port.
+     * @param plan the scatter plan of the pins.
+     */
+    SimulatedOutputPinGroup(SimulatedPinBank& bank, std::size_t port, std::array<uint8_t, N> ids, const BitGatherPlan<N, SimulatedPinBank::Word>& plan) noexcept
+        : OutputPinGroup<N>(ids), bank(bank), port(port), plan(plan) {}
+
+    /**
+     * Get the port of the pins.
+     */
+    std::size_t getPort() const noexcept { return port; }
+
+  private:
+    SimulatedPinBank& bank;
+    std::size_t port;
+    BitGatherPlan<N, SimulatedPinBank::Word> plan;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept { return bank.checkWritable(port, plan.getMask()); }
+    virtual std::expected<void, IoFailureReason> doWrite(const std::bitset<N> value) noexcept {
+        bank.writePort(port, plan.getMask(), plan.scatter(static_cast<SimulatedPinBank::Word>(value.to_ullong())));
+        return std::expected<void, IoFailureReason>();
+    }
+    virtual std::expected<void, IoFailureReason> doWriteSequence(std::span<const std::bitset<N>> values, typename OutputPinGroup<N>::Pacing pacing, void* context) noexcept {
+        std::expected<void, IoFailureReason> writability = checkWritability();
+        if (!writability.has_value()) {
+            return writability;
+        }
+        for (const std::bitset<N>& value : values) {
+            bank.writePort(port, plan.getMask(), plan.scatter(static_cast<SimulatedPinBank::Word>(value.to_ullong())));
+            if (nullptr != pacing) {
+                pacing(context);
+            }
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,60 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SIM__SIMULATED_OUTPUT_PORT__HPP
+#define CMSPK__IOPINS__SIM__SIMULATED_OUTPUT_PORT__HPP
+
+// standard includes
+#include <cstdint>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/OutputTransaction.hpp"
+#include "cmspk/iopins/sim/SimulatedPinBank.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Output port bound to a port of a `SimulatedPinBank`, each masked write being one set/reset write of the port (see
+ * `SimulatedPinBank::writeMasks()`), counted by the bank.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class SimulatedOutputPort final : public OutputPort {
+  public:
+    ~SimulatedOutputPort() noexcept {}
+
+    /**
+     * Fully define a simulated output port.
+     *
+     * @param bank the bank.
+     * @param port the port of the bank, also the index of the output port.
+     */
+    SimulatedOutputPort(SimulatedPinBank& bank, uint8_t port) noexcept : OutputPort(port), bank(bank) {}
+
+  private:
+    SimulatedPinBank& bank;
+
+    virtual std::expected<void, IoFailureReason> doCheckWritable(Word mask) const noexcept { return bank.checkWritable(getIndex(), mask); }
+    virtual std::expected<void, IoFailureReason> doWriteMasked(Word mask, Word values) noexcept {
+        std::expected<void, IoFailureReason> writability = bank.checkWritable(getIndex(), mask);
+        if (!writability.has_value()) {
+            return writability;
+        }
+        bank.writeMasks(getIndex(), values & mask, ~values & mask);
+        return std::expected<void, IoFailureReason>();
+    }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,333 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SIM__SIMULATED_PIN_BANK__HPP
+#define CMSPK__IOPINS__SIM__SIMULATED_PIN_BANK__HPP
+
+// standard includes
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <vector>
+
+// project includes
+#include "cmspk/iopins/IoDirection.hpp"
+#include "cmspk/iopins/IoFailureReason.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Pull resistor setting of a simulated pin.
+ */
+enum SimulatedPull {
+    /**
+     * The pin is floating when not driven, and reads low.
+     */
+    PULL_NONE = 0,
+    /**
+     * The pin reads high when not driven.
+     */
+    PULL_UP,
+    /**
+     * The pin reads low when not driven.
+     */
+    PULL_DOWN
+};
+
+/**
+ * In-memory model of the pin registers of a micro-controller, made of ports of 32 pins, for host-side tests and
+ * benchmarks.
+ *
+ * Each pin has a direction (`IoDirection`), a pull setting, an output latch, and may be driven by the outside world.
+ * The level of a pin is :
+ *
+ * * the output latch when the pin has the `WRITE` direction ;
+ * * otherwise the level driven by the outside world, if any ;
+ * * otherwise the level given by the pull setting.
+ *
+ * The bank has a logical clock that advances by one tick at each port access done by the pins, and can be advanced
+ * explicitly, so that simulations are deterministic. The port accesses are counted.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class SimulatedPinBank {
+  public:
+    /**
+     * Type of a port register word.
+     */
+    using Word = uint32_t;
+
+    /**
+     * Number of pins of a port.
+     */
+    static constexpr std::size_t PORT_WIDTH = 32;
+
+    /**
+     * Get the mask of a pin of a port, 0 when the position is beyond the width of the port.
+     */
+    static constexpr Word bitOf(uint8_t bit) noexcept { return (bit < PORT_WIDTH) ? Word(Word(1) << bit) : Word(0); }
+
+    /**
+     * Function called after each access from the micro-controller side, with the context given at registration.
+     */
+    using Listener = void (*)(void* context);
+
+    ~SimulatedPinBank() noexcept {}
+
+    /**
+     * Fully define a bank, all the pins are floating inputs (`READ` direction, no pull).
+     *
+     * @param portCount the number of ports.
+     */
+    SimulatedPinBank(std::size_t portCount) : ports(portCount) {}
+
+    /**
+     * Get the number of ports.
+     */
+    std::size_t getPortCount() const noexcept { return ports.size(); }
+
+    // ---[ configuration ]---
+
+    /**
+     * Change the direction of a pin.
+     */
+    void setDirection(std::size_t port, uint8_t bit, IoDirection direction) noexcept { setDirections(port, bitOf(bit), direction); }
+
+    /**
+     * Change the direction of several pins of a port.
+     *
+     * @param port the port.
+     * @param mask the pins to change.
+     * @param direction the new direction.
+     */
+    void setDirections(std::size_t port, Word mask, IoDirection direction) noexcept {
+        Port& p = ports[port];
+        p.writeMask = (IoDirection::WRITE == direction) ? (p.writeMask | mask) : (p.writeMask & ~mask);
+        p.disabledMask = (IoDirection::HIGH_Z == direction) ? (p.disabledMask | mask) : (p.disabledMask & ~mask);
+        notify();
+    }
+
+    /**
+     * Get the direction of a pin.
+     */
+    IoDirection getDirection(std::size_t port, uint8_t bit) const noexcept {
+        const Port& p = ports[port];
+        return (p.writeMask & bitOf(bit)) ? IoDirection::WRITE : (p.disabledMask & bitOf(bit)) ? IoDirection::HIGH_Z : IoDirection::READ;
+    }
+
+    /**
+     * Change the pull setting of a pin.
+     */
+    void setPull(std::size_t port, uint8_t bit, SimulatedPull pull) noexcept {
+        Port& p = ports[port];
+        p.pullUpMask = (SimulatedPull::PULL_UP == pull) ? (p.pullUpMask | bitOf(bit)) : (p.pullUpMask & ~bitOf(bit));
+        p.pullDownMask = (SimulatedPull::PULL_DOWN == pull) ? (p.pullDownMask | bitOf(bit)) : (p.pullDownMask & ~bitOf(bit));
+    }
+
+    /**
+     * Get the pull setting of a pin.
+     */
+    SimulatedPull getPull(std::size_t port, uint8_t bit) const noexcept {
+        const Port& p = ports[port];
+        return (p.pullUpMask & bitOf(bit)) ? SimulatedPull::PULL_UP : (p.pullDownMask & bitOf(bit)) ? SimulatedPull::PULL_DOWN : SimulatedPull::PULL_NONE;
+    }
+
+    // ---[ outside world ]---
+
+    /**
+     * Drive some pins of a port from the outside world.
+     *
+     * @param port the port.
+     * @param mask the pins to drive.
+     * @param levels the levels to drive.
+     */
+    void drive(std::size_t port, Word mask, Word levels) noexcept {
+        Port& p = ports[port];
+        p.drivenMask |= mask;
+        p.drivenLevels = (p.drivenLevels & ~mask) | (levels & mask);
+    }
+
+    /**
+     * Drive a pin from the outside world.
+     */
+    void drive(std::size_t port, uint8_t bit, bool level) noexcept { drive(port, bitOf(bit), level ? bitOf(bit) : 0); }
+
+    /**
+     * Stop driving some pins of a port from the outside world.
+     */
+    void release(std::size_t port, Word mask) noexcept { ports[port].drivenMask &= ~mask; }
+
+    /**
+     * Get the levels of the pins of a port, without counting an access nor advancing the clock.
+     */
+    Word getLevels(std::size_t port) const noexcept {
+        const Port& p = ports[port];
+        Word notWritten = ~p.writeMask;
+        return (p.latch & p.writeMask) | (p.drivenLevels & p.drivenMask & notWritten) | (p.pullUpMask & ~p.drivenMask & notWritten);
+    }
+
+    /**
+     * Get the level of a pin, without counting an access nor advancing the clock.
+     */
+    bool getLevel(std::size_t port, uint8_t bit) const noexcept { return getLevels(port) & bitOf(bit); }
+
+    /**
+     * Get the output latch of a port.
+     */
+    Word getLatch(std::size_t port) const noexcept { return ports[port].latch; }
+
+    // ---[ micro-controller side ]---
+
+    /**
+     * Read the levels of the pins of a port, as the micro-controller does.
+     */
+    Word readPort(std::size_t port) noexcept {
+        ++ports[port].reads;
+        ++clock;
+        notify();
+        return getLevels(port);
+    }
+
+    /**
+     * Write the output latch of some pins of a port, as the micro-controller does.
+     *
+     * @param port the port.
+     * @param mask the pins to write.
+     * @param values the values to write.
+     */
+    void writePort(std::size_t port, Word mask, Word values) noexcept {
+        Port& p = ports[port];
+        ++p.writes;
+        ++clock;
+        p.latch = (p.latch & ~mask) | (values & mask);
+        notify();
+    }
+
+    /**
+     * Set and clear some pins of the output latch of a port, like a BSRR register.
+     *
+     * @param port the port.
+     * @param setMask the pins to set.
+     * @param clearMask the pins to clear.
+     */
+    void writeMasks(std::size_t port, Word setMask, Word clearMask) noexcept {
+        Port& p = ports[port];
+        ++p.writes;
+        ++clock;
+        p.latch = (p.latch | setMask) & ~clearMask;
+        notify();
+    }
+
+    /**
+     * Check that all the given pins of a port have the `READ` direction.
+     */
+    std::expected<void, IoFailureReason> checkReadable(std::size_t port, Word mask) const noexcept {
+        const Port& p = ports[port];
+        if (p.disabledMask & mask) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_DISABLED);
+        }
+        if (p.writeMask & mask) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+
+    /**
+     * Check that all the given pins of a port have the `WRITE` direction.
+     */
+    std::expected<void, IoFailureReason> checkWritable(std::size_t port, Word mask) const noexcept {
+        const Port& p = ports[port];
+        if (p.disabledMask & mask) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_DISABLED);
+        }
+        if (~p.writeMask & mask) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+
+    // ---[ simulated devices ]---
+
+    /**
+     * Register the function to call after each access from the micro-controller side (direction change, read or
+     * write), so that a simulated device can react to the lines, e.g. `SimulatedI2cTarget` ; there is at most one
+     * listener.
+     *
+     * The listener MUST only use the outside world and the accessors that do not count an access, i.e. `getLevels()`,
+     * `drive()`, `release()` and `now()`.
+     *
+     * @param listener the function to call, `nullptr` to remove the listener.
+     * @param context the value given to the function.
+     */
+    void setListener(Listener listener, void* context) noexcept {
+        this->listener = listener;
+        listenerContext = context;
+    }
+
+    // ---[ clock and statistics ]---
+
+    /**
+     * Get the current time of the logical clock, in ticks.
+     */
+    uint64_t now() const noexcept { return clock; }
+
+    /**
+     * Advance the logical clock.
+     */
+    void advance(uint64_t ticks = 1) noexcept { clock += ticks; }
+
+    /**
+     * Get the number of reads of a port by the micro-controller.
+     */
+    uint64_t getReadCount(std::size_t port) const noexcept { return ports[port].reads; }
+
+    /**
+     * Get the number of writes to a port by the micro-controller.
+     */
+    uint64_t getWriteCount(std::size_t port) const noexcept { return ports[port].writes; }
+
+    /**
+     * Reset the access counters of all the ports.
+     */
+    void resetCounters() noexcept {
+        for (Port& p : ports) {
+            p.reads = 0;
+            p.writes = 0;
+        }
+    }
+
+  private:
+    struct Port {
+        Word latch = 0;
+        Word writeMask = 0;
+        Word disabledMask = 0;
+        Word pullUpMask = 0;
+        Word pullDownMask = 0;
+        Word drivenMask = 0;
+        Word drivenLevels = 0;
+        uint64_t reads = 0;
+        uint64_t writes = 0;
+    };
+
+    std::vector<Port> ports;
+    uint64_t clock = 0;
+    Listener listener = nullptr;
+    void* listenerContext = nullptr;
+
+    void notify() noexcept {
+        if (nullptr != listener) {
+            listener(listenerContext);
+        }
+    }
+};
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
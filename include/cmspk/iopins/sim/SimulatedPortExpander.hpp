@@ -0,0 +1,121 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SIM__SIMULATED_PORT_EXPANDER__HPP
+#define CMSPK__IOPINS__SIM__SIMULATED_PORT_EXPANDER__HPP
+
+// standard includes
+#include <cstdint>
+#include <expected>
+
+// project includes
+#include "cmspk/iopins/IoFailureReason.hpp"
+#include "cmspk/iopins/PortExpander.hpp"
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * In-memory model of an I/O expander chip, for host-side tests and benchmarks : it has a direction register, an
+ * output register and input levels driven by the outside world, and counts the bus transactions.
+ *
+ * The input register reads the output register for the output pins, and the driven levels for the input pins.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+class SimulatedPortExpander final : public PortExpander {
+  public:
+    ~SimulatedPortExpander() noexcept {}
+
+    SimulatedPortExpander() noexcept {}
+
+    // ---[ outside world ]---
+
+    /**
+     * Drive the levels of the input pins.
+     */
+    void drive(Word levels) noexcept { drivenLevels = levels; }
+
+    /**
+     * Get the output register of the chip, i.e. what was actually transferred.
+     */
+    Word getOutputRegister() const noexcept { return outputRegister; }
+
+    /**
+     * Get the direction register of the chip, the bits set are outputs.
+     */
+    Word getDirectionRegister() const noexcept { return directionRegister; }
+
+    /**
+     * Make the next bus transactions fail (e.g. no acknowledge), or succeed again.
+     */
+    void setFailing(bool failing) noexcept { this->failing = failing; }
+
+    // ---[ statistics ]---
+
+    /**
+     * Get the number of bus transactions, failed ones included.
+     */
+    uint64_t getTransactionCount() const noexcept { return writes + reads; }
+
+    /**
+     * Get the number of bus transactions that wrote a register.
+     */
+    uint64_t getWriteCount() const noexcept { return writes; }
+
+    /**
+     * Get the number of bus transactions that read the input register.
+     */
+    uint64_t getReadCount() const noexcept { return reads; }
+
+    /**
+     * Reset the transaction counters.
+     */
+    void resetCounters() noexcept {
+        writes = 0;
+        reads = 0;
+    }
+
+  private:
+    Word directionRegister = 0;
+    Word outputRegister = 0;
+    Word drivenLevels = 0;
+    uint64_t writes = 0;
+    uint64_t reads = 0;
+    bool failing = false;
+
+    virtual std::expected<void, IoFailureReason> doWriteOutputs(Word image) noexcept {
+        ++writes;
+        if (failing) {
+            return std::unexpected(IoFailureReason::FAILURE_NO_ACKNOWLEDGE);
+        }
+        outputRegister = image;
+        return std::expected<void, IoFailureReason>();
+    }
+    virtual std::expected<Word, IoFailureReason> doReadInputs() noexcept {
+        ++reads;
+        if (failing) {
+            return std::unexpected(IoFailureReason::FAILURE_NO_ACKNOWLEDGE);
+        }
+        return static_cast<Word>((outputRegister & directionRegister) | (drivenLevels & ~directionRegister));
+    }
+    virtual std::expected<void, IoFailureReason> doWriteDirections(Word outputMask) noexcept {
+        ++writes;
+        if (failing) {
+            return std::unexpected(IoFailureReason::FAILURE_NO_ACKNOWLEDGE);
+        }
+        directionRegister = outputMask;
+        return std::expected<void, IoFailureReason>();
+    }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
@@ -0,0 +1,35 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__SIM__STEADY_INSTRUMENTATION_CLOCK__HPP
+#define CMSPK__IOPINS__SIM__STEADY_INSTRUMENTATION_CLOCK__HPP
+
+// standard includes
+#include <chrono>
+#include <cstdint>
+
+namespace cmspk::iopins {
+// ================[ CODE BEGINS ]================
+/**
+ * Clock of the host for `CountingInstrumentation`, in nanoseconds.
+ *
+ * > This is part of **I/O pins**.
+ * >
+ * > **Copyright** (C) 2025~2025 David SPORN.
+ * > **Licence** GPL 3.0 or later.
+ */
+struct SteadyInstrumentationClock {
+    static uint32_t now() noexcept {
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+};
+
+// ================[ END OF CODE ]================
+};  // namespace cmspk::iopins
+#endif
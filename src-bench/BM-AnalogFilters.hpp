@@ -0,0 +1,102 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Filtering of 4096 samples of 16 bits, in samples per second : one `push()` per sample against `filter()` on the whole
+// buffer, that uses the vector unit (SSE2/NEON) when available ; and decimation by 16, against a plain loop.
+
+static constexpr std::size_t ANALOG_BENCH_SAMPLES = 4096;
+
+static std::vector<uint16_t> makeAnalogBenchSamples() {
+    std::vector<uint16_t> samples(ANALOG_BENCH_SAMPLES);
+    uint32_t seed = 1;
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        samples[i] = static_cast<uint16_t>(seed >> 20) + 30000;
+    }
+    return samples;
+}
+
+template <typename Filter>
+static void benchAnalogPushLoop(bench::State& state) {
+    Filter filter;
+    std::vector<uint16_t> samples = makeAnalogBenchSamples();
+    std::vector<uint16_t> output(samples.size());
+    state.measure(
+        [&] {
+            const uint16_t* in = bench::opaque<const uint16_t>(samples.data());
+            for (std::size_t i = 0; i < ANALOG_BENCH_SAMPLES; ++i) {
+                output[i] = filter.push(in[i]);
+            }
+            bench::doNotOptimize(output);
+        },
+        1u << 10);
+    state.setItemsPerCall(ANALOG_BENCH_SAMPLES);
+}
+
+template <typename Filter>
+static void benchAnalogBulk(bench::State& state) {
+    Filter filter;
+    std::vector<uint16_t> samples = makeAnalogBenchSamples();
+    std::vector<uint16_t> output(samples.size());
+    state.measure(
+        [&] {
+            filter.filter(std::span<const uint16_t>(bench::opaque<const uint16_t>(samples.data()), ANALOG_BENCH_SAMPLES), output);
+            bench::doNotOptimize(output);
+        },
+        1u << 10);
+    state.setItemsPerCall(ANALOG_BENCH_SAMPLES);
+}
+
+Bench(AnalogFilters, moving_average_16_push_4096) { benchAnalogPushLoop<cmspk::iopins::MovingAverage<uint16_t, 16>>(state); }
+
+Bench(AnalogFilters, moving_average_16_filter_4096) { benchAnalogBulk<cmspk::iopins::MovingAverage<uint16_t, 16>>(state); }
+
+Bench(AnalogFilters, median_3_push_4096) { benchAnalogPushLoop<cmspk::iopins::MedianFilter<uint16_t, 3>>(state); }
+
+Bench(AnalogFilters, median_3_filter_4096) { benchAnalogBulk<cmspk::iopins::MedianFilter<uint16_t, 3>>(state); }
+
+Bench(AnalogFilters, median_5_push_4096) { benchAnalogPushLoop<cmspk::iopins::MedianFilter<uint16_t, 5>>(state); }
+
+Bench(AnalogFilters, median_5_filter_4096) { benchAnalogBulk<cmspk::iopins::MedianFilter<uint16_t, 5>>(state); }
+
+Bench(AnalogFilters, iir_4_push_4096) { benchAnalogPushLoop<cmspk::iopins::IirFilter<uint16_t, 4>>(state); }
+
+Bench(AnalogFilters, iir_4_filter_4096) { benchAnalogBulk<cmspk::iopins::IirFilter<uint16_t, 4>>(state); }
+
+Bench(AnalogFilters, decimate_16_scalar_4096) {
+    std::vector<uint16_t> samples = makeAnalogBenchSamples();
+    std::vector<uint16_t> output(samples.size() / 16);
+    state.measure(
+        [&] {
+            const uint16_t* in = bench::opaque<const uint16_t>(samples.data());
+            for (std::size_t o = 0; o < output.size(); ++o) {
+                uint32_t sum = 0;
+                for (std::size_t i = 0; i < 16; ++i) {
+                    sum += in[o * 16 + i];
+                }
+                output[o] = static_cast<uint16_t>(sum >> 4);
+            }
+            bench::doNotOptimize(output);
+        },
+        1u << 10);
+    state.setItemsPerCall(ANALOG_BENCH_SAMPLES);
+}
+
+Bench(AnalogFilters, decimate_16_4096) {
+    std::vector<uint16_t> samples = makeAnalogBenchSamples();
+    std::vector<uint16_t> output(samples.size() / 16);
+    state.measure(
+        [&] {
+            bench::doNotOptimize(cmspk::iopins::decimate<uint16_t>(std::span<const uint16_t>(bench::opaque<const uint16_t>(samples.data()), ANALOG_BENCH_SAMPLES), output, 16, 4));
+            bench::doNotOptimize(output);
+        },
+        1u << 10);
+    state.setItemsPerCall(ANALOG_BENCH_SAMPLES);
+}
@@ -0,0 +1,56 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Cost of the binary code modulation scheduler : a tick stays constant whatever the number of channels, a duty cycle
+// change costs one bit flip per changing bit plane.
+
+// ================[BEGIN typical specialization]==================
+template <std::size_t N>
+class FrameSinkOutputPinGroup final : public cmspk::iopins::OutputPinGroup<N> {
+  public:
+    FrameSinkOutputPinGroup() : cmspk::iopins::OutputPinGroup<N>({}) {}
+    std::bitset<N> value;
+
+  private:
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<void, IoFailureReason> doWrite(const std::bitset<N> v) noexcept {
+        value = v;
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[END typical specialization]==================
+
+template <std::size_t N>
+void benchBcmTick(bench::State& state) {
+    FrameSinkOutputPinGroup<N> group;
+    cmspk::iopins::BcmScheduler<N, 8> scheduler(*bench::opaque(&group));
+    for (std::size_t i = 0; i < N; ++i) {
+        scheduler.setDuty(i, static_cast<uint8_t>(i * 37));
+    }
+    state.measure([&] { bench::doNotOptimize(scheduler.tick()); });
+    bench::doNotOptimize(group.value);
+}
+
+Bench(BcmScheduler, tick_8) { benchBcmTick<8>(state); }
+
+Bench(BcmScheduler, tick_64) { benchBcmTick<64>(state); }
+
+Bench(BcmScheduler, tick_256) { benchBcmTick<256>(state); }
+
+Bench(BcmScheduler, setDuty_256) {
+    FrameSinkOutputPinGroup<256> group;
+    cmspk::iopins::BcmScheduler<256, 8> scheduler(group);
+    uint32_t i = 0;
+    state.measure([&] {
+        scheduler.setDuty(i & 0xff, static_cast<uint8_t>(i * 37));
+        ++i;
+    });
+    bench::doNotOptimize(scheduler.getFrame(0));
+}
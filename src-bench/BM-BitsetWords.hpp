@@ -0,0 +1,137 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Compare the conversions between `std::bitset<N>` and native words of `toWords()`/`fromWords()` with a bit by bit
+// conversion, at each width ; the bitset changes at each call.
+
+template <typename W, std::size_t N>
+static std::array<W, cmspk::iopins::bitsetWordCount<W, N>> toWordsBitByBit(const std::bitset<N>& bits) {
+    constexpr std::size_t WIDTH = std::numeric_limits<W>::digits;
+    std::array<W, cmspk::iopins::bitsetWordCount<W, N>> words{};
+    for (std::size_t i = 0; i < N; ++i) {
+        if (bits[i]) {
+            words[i / WIDTH] |= W(1) << (i % WIDTH);
+        }
+    }
+    return words;
+}
+
+template <std::size_t N, typename W, std::size_t K>
+static std::bitset<N> fromWordsBitByBit(const std::array<W, K>& words) {
+    constexpr std::size_t WIDTH = std::numeric_limits<W>::digits;
+    std::bitset<N> bits;
+    for (std::size_t i = 0; i < N; ++i) {
+        bits[i] = (words[i / WIDTH] >> (i % WIDTH)) & 1u;
+    }
+    return bits;
+}
+
+template <std::size_t N>
+static void nextBits(std::bitset<N>& bits, uint64_t& seed) {
+    seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+    bits ^= std::bitset<N>(seed);
+    bits = (bits << 1) | (bits >> (N - 1));
+}
+
+template <typename W, std::size_t N, bool BIT_BY_BIT>
+static void measureToWords(bench::State& state) {
+    std::bitset<N> bits;
+    uint64_t seed = 1;
+    state.measure([&] {
+        nextBits(bits, seed);
+        if constexpr (BIT_BY_BIT) {
+            bench::doNotOptimize(toWordsBitByBit<W>(*bench::opaque(&bits)));
+        } else {
+            bench::doNotOptimize(cmspk::iopins::toWords<W>(*bench::opaque(&bits)));
+        }
+    });
+    state.setItemsPerCall(N);
+}
+
+template <typename W, std::size_t N, bool BIT_BY_BIT>
+static void measureFromWords(bench::State& state) {
+    std::array<W, cmspk::iopins::bitsetWordCount<W, N>> words{};
+    W seed = 1;
+    state.measure([&] {
+        for (W& word : words) {
+            word = static_cast<W>(word * 2654435761u + seed++);
+        }
+        if constexpr (BIT_BY_BIT) {
+            bench::doNotOptimize(fromWordsBitByBit<N>(*bench::opaque(&words)));
+        } else {
+            bench::doNotOptimize(cmspk::iopins::fromWords<N>(*bench::opaque(&words)));
+        }
+    });
+    state.setItemsPerCall(N);
+}
+
+Bench(BitsetWords, to_words32_8) { measureToWords<uint32_t, 8, false>(state); }
+
+Bench(BitsetWords, to_words64_8) { measureToWords<uint64_t, 8, false>(state); }
+
+Bench(BitsetWords, to_bit_by_bit_8) { measureToWords<uint32_t, 8, true>(state); }
+
+Bench(BitsetWords, from_words32_8) { measureFromWords<uint32_t, 8, false>(state); }
+
+Bench(BitsetWords, from_words64_8) { measureFromWords<uint64_t, 8, false>(state); }
+
+Bench(BitsetWords, from_bit_by_bit_8) { measureFromWords<uint32_t, 8, true>(state); }
+
+
+Bench(BitsetWords, to_words32_16) { measureToWords<uint32_t, 16, false>(state); }
+
+Bench(BitsetWords, to_words64_16) { measureToWords<uint64_t, 16, false>(state); }
+
+Bench(BitsetWords, to_bit_by_bit_16) { measureToWords<uint32_t, 16, true>(state); }
+
+Bench(BitsetWords, from_words32_16) { measureFromWords<uint32_t, 16, false>(state); }
+
+Bench(BitsetWords, from_words64_16) { measureFromWords<uint64_t, 16, false>(state); }
+
+Bench(BitsetWords, from_bit_by_bit_16) { measureFromWords<uint32_t, 16, true>(state); }
+
+
+Bench(BitsetWords, to_words32_32) { measureToWords<uint32_t, 32, false>(state); }
+
+Bench(BitsetWords, to_words64_32) { measureToWords<uint64_t, 32, false>(state); }
+
+Bench(BitsetWords, to_bit_by_bit_32) { measureToWords<uint32_t, 32, true>(state); }
+
+Bench(BitsetWords, from_words32_32) { measureFromWords<uint32_t, 32, false>(state); }
+
+Bench(BitsetWords, from_words64_32) { measureFromWords<uint64_t, 32, false>(state); }
+
+Bench(BitsetWords, from_bit_by_bit_32) { measureFromWords<uint32_t, 32, true>(state); }
+
+
+Bench(BitsetWords, to_words32_64) { measureToWords<uint32_t, 64, false>(state); }
+
+Bench(BitsetWords, to_words64_64) { measureToWords<uint64_t, 64, false>(state); }
+
+Bench(BitsetWords, to_bit_by_bit_64) { measureToWords<uint32_t, 64, true>(state); }
+
+Bench(BitsetWords, from_words32_64) { measureFromWords<uint32_t, 64, false>(state); }
+
+Bench(BitsetWords, from_words64_64) { measureFromWords<uint64_t, 64, false>(state); }
+
+Bench(BitsetWords, from_bit_by_bit_64) { measureFromWords<uint32_t, 64, true>(state); }
+
+
+Bench(BitsetWords, to_words32_128) { measureToWords<uint32_t, 128, false>(state); }
+
+Bench(BitsetWords, to_words64_128) { measureToWords<uint64_t, 128, false>(state); }
+
+Bench(BitsetWords, to_bit_by_bit_128) { measureToWords<uint32_t, 128, true>(state); }
+
+Bench(BitsetWords, from_words32_128) { measureFromWords<uint32_t, 128, false>(state); }
+
+Bench(BitsetWords, from_words64_128) { measureFromWords<uint64_t, 128, false>(state); }
+
+Bench(BitsetWords, from_bit_by_bit_128) { measureFromWords<uint32_t, 128, true>(state); }
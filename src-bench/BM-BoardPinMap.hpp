@@ -0,0 +1,74 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Read a group of scattered pins named on a board : with the gather plan resolved at compile time and static dispatch,
+// the read is the register access plus the constant gather steps ; compared with a gather plan held at runtime.
+
+// ================[BEGIN specializations]==================
+struct BenchBoard {
+    using Word = uint32_t;
+    static constexpr std::array<cmspk::iopins::BoardPin, 8> PINS{{
+        {"D0", 0, 0},
+        {"D1", 0, 1},
+        {"D2", 0, 2},
+        {"D3", 0, 5},
+        {"D4", 0, 6},
+        {"D5", 0, 12},
+        {"D6", 0, 13},
+        {"D7", 0, 31},
+    }};
+};
+
+using BenchDataBus = cmspk::iopins::BoardPinGroup<BenchBoard, "D0", "D1", "D2", "D3", "D4", "D5", "D6", "D7">;
+
+template <typename Group>
+class BoardBenchInputPinGroup final : public cmspk::iopins::StaticInputPinGroup<BoardBenchInputPinGroup<Group>, Group::N> {
+    friend cmspk::iopins::StaticInputPinGroup<BoardBenchInputPinGroup<Group>, Group::N>;
+
+  public:
+    BoardBenchInputPinGroup(const uint32_t* port) : cmspk::iopins::StaticInputPinGroup<BoardBenchInputPinGroup<Group>, Group::N>(Group::IDS), port(port) {}
+
+  private:
+    const uint32_t* port;
+
+    std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    std::expected<std::bitset<Group::N>, IoFailureReason> doRead() noexcept { return std::bitset<Group::N>(Group::PLAN.gather(*port)); }
+};
+
+class RuntimePlanBenchInputPinGroup final : public cmspk::iopins::PortInputPinGroup<8> {
+  public:
+    RuntimePlanBenchInputPinGroup(const uint32_t* port) : cmspk::iopins::PortInputPinGroup<8>(BenchDataBus::IDS), port(port) {}
+
+  private:
+    const uint32_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<uint32_t, IoFailureReason> doReadPort() noexcept { return *port; }
+};
+// ================[END specializations]==================
+
+Bench(BoardPinMap, runtime_plan_read_8) {
+    uint32_t port = 0xa5a5a5a5u;
+    RuntimePlanBenchInputPinGroup group(&port);
+    cmspk::iopins::InputPinOctet* g = bench::opaque<cmspk::iopins::InputPinOctet>(&group);
+    state.measure([&] {
+        port = port * 1664525u + 1013904223u;
+        bench::doNotOptimize(g->read());
+    });
+}
+
+Bench(BoardPinMap, compile_time_plan_read_8) {
+    uint32_t port = 0xa5a5a5a5u;
+    BoardBenchInputPinGroup<BenchDataBus> group(bench::opaque(&port));
+    state.measure([&] {
+        port = port * 1664525u + 1013904223u;
+        bench::doNotOptimize(group.read());
+    });
+}
@@ -0,0 +1,80 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Output and capture of bursts of 1024 samples on an 8-pin group of the simulated bank, in samples per second : one
+// `write()`/`read()` per sample against `writeSequence()`/`readSamples()`, that check the pins once per burst.
+
+static constexpr std::size_t BURST_BENCH_SAMPLES = 1024;
+
+static std::array<std::bitset<8>, BURST_BENCH_SAMPLES> makeBurstBenchWaveform() {
+    std::array<std::bitset<8>, BURST_BENCH_SAMPLES> waveform;
+    for (std::size_t i = 0; i < waveform.size(); ++i) {
+        waveform[i] = std::bitset<8>(i * 7);
+    }
+    return waveform;
+}
+
+Bench(BurstStreaming, write_loop_1024) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    bank.setDirections(0, 0xff00u, IoDirection::WRITE);
+    cmspk::iopins::SimulatedOutputPinGroup<8> group(bank, 0, {8, 9, 10, 11, 12, 13, 14, 15});
+    cmspk::iopins::OutputPinOctet* g = bench::opaque<cmspk::iopins::OutputPinOctet>(&group);
+    std::array<std::bitset<8>, BURST_BENCH_SAMPLES> waveform = makeBurstBenchWaveform();
+    state.measure(
+        [&] {
+            for (const std::bitset<8>& value : waveform) {
+                bench::doNotOptimize(g->write(value));
+            }
+        },
+        1u << 12);
+    state.setItemsPerCall(BURST_BENCH_SAMPLES);
+}
+
+Bench(BurstStreaming, writeSequence_1024) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    bank.setDirections(0, 0xff00u, IoDirection::WRITE);
+    cmspk::iopins::SimulatedOutputPinGroup<8> group(bank, 0, {8, 9, 10, 11, 12, 13, 14, 15});
+    cmspk::iopins::OutputPinOctet* g = bench::opaque<cmspk::iopins::OutputPinOctet>(&group);
+    std::array<std::bitset<8>, BURST_BENCH_SAMPLES> waveform = makeBurstBenchWaveform();
+    state.measure([&] { bench::doNotOptimize(g->writeSequence(waveform)); }, 1u << 12);
+    state.setItemsPerCall(BURST_BENCH_SAMPLES);
+}
+
+Bench(BurstStreaming, read_loop_1024) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    bank.drive(0, 0xff00u, 0x5a00u);
+    cmspk::iopins::SimulatedInputPinGroup<8> group(bank, 0, {8, 9, 10, 11, 12, 13, 14, 15});
+    cmspk::iopins::InputPinOctet* g = bench::opaque<cmspk::iopins::InputPinOctet>(&group);
+    std::array<std::bitset<8>, BURST_BENCH_SAMPLES> samples;
+    state.measure(
+        [&] {
+            for (std::bitset<8>& sample : samples) {
+                sample = g->read().value_or(std::bitset<8>());
+            }
+            bench::doNotOptimize(samples);
+        },
+        1u << 12);
+    state.setItemsPerCall(BURST_BENCH_SAMPLES);
+}
+
+Bench(BurstStreaming, readSamples_1024) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    bank.drive(0, 0xff00u, 0x5a00u);
+    cmspk::iopins::SimulatedInputPinGroup<8> group(bank, 0, {8, 9, 10, 11, 12, 13, 14, 15});
+    cmspk::iopins::InputPinOctet* g = bench::opaque<cmspk::iopins::InputPinOctet>(&group);
+    std::array<std::bitset<8>, BURST_BENCH_SAMPLES> samples;
+    state.measure(
+        [&] {
+            bench::doNotOptimize(g->readSamples(samples));
+            bench::doNotOptimize(samples);
+        },
+        1u << 12);
+    state.setItemsPerCall(BURST_BENCH_SAMPLES);
+}
@@ -0,0 +1,130 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Conversion of 4096 readings of a 12 bits converter into tenths of degree through an 8 points thermistor calibration,
+// and back, in conversions per second : runtime float interpolation against the compile-time tables.
+
+// ================[BEGIN specializations]==================
+struct BenchThermistorCalibration {
+    using Value = int16_t;
+    static constexpr std::array<cmspk::iopins::CalibrationPoint<int16_t>, 8> POINTS{
+        {{0, 1500}, {400, 1000}, {900, 700}, {1600, 450}, {2300, 250}, {3000, 50}, {3600, -150}, {4095, -400}}};
+};
+
+using BenchThermistorInterpolation = cmspk::iopins::PiecewiseLinearTable<BenchThermistorCalibration, uint16_t>;
+using BenchThermistorLookup = cmspk::iopins::LookupTable<BenchThermistorCalibration, uint16_t, 12>;
+
+// the usual runtime conversion, with the points loaded as floats
+struct FloatBenchCalibration {
+    std::array<float, 8> raws;
+    std::array<float, 8> values;
+
+    FloatBenchCalibration() {
+        for (std::size_t i = 0; i < 8; ++i) {
+            raws[i] = static_cast<float>(BenchThermistorCalibration::POINTS[i].raw);
+            values[i] = static_cast<float>(BenchThermistorCalibration::POINTS[i].value);
+        }
+    }
+
+    int16_t toValue(uint16_t raw) const {
+        float r = static_cast<float>(raw);
+        std::size_t i = 0;
+        while (i < 6 && r > raws[i + 1]) {
+            ++i;
+        }
+        float v = values[i] + (r - raws[i]) * (values[i + 1] - values[i]) / (raws[i + 1] - raws[i]);
+        return static_cast<int16_t>(std::lround(v));
+    }
+
+    uint16_t toRaw(int16_t value) const {
+        float v = std::clamp(static_cast<float>(value), values[7], values[0]);
+        std::size_t i = 0;
+        while (i < 6 && v < values[i + 1]) {
+            ++i;
+        }
+        float r = raws[i] + (v - values[i]) * (raws[i + 1] - raws[i]) / (values[i + 1] - values[i]);
+        return static_cast<uint16_t>(std::lround(r));
+    }
+};
+// ================[END specializations]==================
+
+static constexpr std::size_t CALIBRATION_BENCH_SAMPLES = 4096;
+
+static std::vector<uint16_t> makeCalibrationBenchReadings() {
+    std::vector<uint16_t> readings(CALIBRATION_BENCH_SAMPLES);
+    uint32_t seed = 7;
+    for (uint16_t& reading : readings) {
+        seed = seed * 1664525u + 1013904223u;
+        reading = static_cast<uint16_t>(seed >> 20);
+    }
+    return readings;
+}
+
+static std::vector<int16_t> makeCalibrationBenchValues() {
+    std::vector<int16_t> values(CALIBRATION_BENCH_SAMPLES);
+    uint32_t seed = 11;
+    for (int16_t& value : values) {
+        seed = seed * 1664525u + 1013904223u;
+        value = static_cast<int16_t>(static_cast<int32_t>(seed >> 21) - 400);
+    }
+    return values;
+}
+
+template <typename Convert>
+static void benchCalibrationToValue(bench::State& state, Convert convert) {
+    std::vector<uint16_t> readings = makeCalibrationBenchReadings();
+    std::vector<int16_t> values(readings.size());
+    state.measure(
+        [&] {
+            const uint16_t* in = bench::opaque<const uint16_t>(readings.data());
+            for (std::size_t i = 0; i < CALIBRATION_BENCH_SAMPLES; ++i) {
+                values[i] = convert(in[i]);
+            }
+            bench::doNotOptimize(values);
+        },
+        1u << 10);
+    state.setItemsPerCall(CALIBRATION_BENCH_SAMPLES);
+}
+
+template <typename Convert>
+static void benchCalibrationToRaw(bench::State& state, Convert convert) {
+    std::vector<int16_t> values = makeCalibrationBenchValues();
+    std::vector<uint16_t> readings(values.size());
+    state.measure(
+        [&] {
+            const int16_t* in = bench::opaque<const int16_t>(values.data());
+            for (std::size_t i = 0; i < CALIBRATION_BENCH_SAMPLES; ++i) {
+                readings[i] = convert(in[i]);
+            }
+            bench::doNotOptimize(readings);
+        },
+        1u << 10);
+    state.setItemsPerCall(CALIBRATION_BENCH_SAMPLES);
+}
+
+Bench(CalibrationTables, toValue_float_4096) {
+    FloatBenchCalibration calibration;
+    FloatBenchCalibration* c = bench::opaque<FloatBenchCalibration>(&calibration);
+    benchCalibrationToValue(state, [c](uint16_t raw) { return c->toValue(raw); });
+}
+
+Bench(CalibrationTables, toValue_piecewise_4096) { benchCalibrationToValue(state, [](uint16_t raw) { return BenchThermistorInterpolation::toValue(raw); }); }
+
+Bench(CalibrationTables, toValue_lookup_4096) { benchCalibrationToValue(state, [](uint16_t raw) { return BenchThermistorLookup::toValue(raw); }); }
+
+Bench(CalibrationTables, toRaw_float_4096) {
+    FloatBenchCalibration calibration;
+    FloatBenchCalibration* c = bench::opaque<FloatBenchCalibration>(&calibration);
+    benchCalibrationToRaw(state, [c](int16_t value) { return c->toRaw(value); });
+}
+
+Bench(CalibrationTables, toRaw_piecewise_4096) { benchCalibrationToRaw(state, [](int16_t value) { return BenchThermistorInterpolation::toRaw(value); }); }
+
+Bench(CalibrationTables, toRaw_lookup_4096) { benchCalibrationToRaw(state, [](int16_t value) { return BenchThermistorLookup::toRaw(value); }); }
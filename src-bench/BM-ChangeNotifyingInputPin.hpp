@@ -0,0 +1,167 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Compare the interrupt style delivery of edges (a thread simulating the interrupt source drives a
+// `SimulatedChangeNotifyingInputPin`, the main thread dispatches the queue) with the polling of the same pin : latency
+// between the edge and its handling, and edges actually observed when the source is faster than the consumer.
+
+// ================[BEGIN specializations]==================
+static constexpr std::size_t EDGE_BENCH_CAPACITY = 256;
+using EdgeBenchQueue = cmspk::iopins::EdgeEventQueue<EDGE_BENCH_CAPACITY>;
+using EdgeBenchPin = cmspk::iopins::SimulatedChangeNotifyingInputPin<EDGE_BENCH_CAPACITY>;
+using EdgeBenchDispatcher = cmspk::iopins::EdgeDispatcher<1, EDGE_BENCH_CAPACITY>;
+
+static uint32_t benchEdgeClock() {
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+struct EdgeLatencyProbe {
+    uint64_t edges = 0;
+    double totalLatency = 0;
+
+    static void onEdge(void* context, const cmspk::iopins::EdgeEvent& event) {
+        EdgeLatencyProbe* probe = static_cast<EdgeLatencyProbe*>(context);
+        probe->totalLatency += static_cast<uint32_t>(benchEdgeClock() - event.timestamp);
+        ++probe->edges;
+    }
+};
+
+// wait about the given duration between two edges, leaving the processor to the main thread
+static void spinEdgeBenchFor(uint32_t nanoseconds) {
+    uint32_t start = benchEdgeClock();
+    while (static_cast<uint32_t>(benchEdgeClock() - start) < nanoseconds) {
+        std::this_thread::yield();
+    }
+}
+// ================[END specializations]==================
+
+static constexpr uint32_t EDGE_BENCH_SPACED_EDGES = 1u << 12;
+static constexpr uint32_t EDGE_BENCH_SPACING_NS = 20000;
+
+Bench(ChangeNotifyingInputPin, latency_interrupt_dispatch) {
+    static EdgeBenchQueue queue;
+    static EdgeBenchPin pin(0, queue, 0);
+    EdgeBenchDispatcher dispatcher(queue);
+    EdgeLatencyProbe probe;
+    dispatcher.setHandler(0, EdgeLatencyProbe::onEdge, &probe);
+    std::atomic<bool> done{false};
+    std::thread interruptSource([&] {
+        for (uint32_t i = 1; i <= EDGE_BENCH_SPACED_EDGES; ++i) {
+            pin.drive(1 == (i & 1), benchEdgeClock());
+            spinEdgeBenchFor(EDGE_BENCH_SPACING_NS);
+        }
+        done.store(true, std::memory_order_release);
+    });
+    while (!done.load(std::memory_order_acquire)) {
+        if (0 == dispatcher.dispatch()) {
+            std::this_thread::yield();
+        }
+    }
+    interruptSource.join();
+    dispatcher.dispatch();
+    state.record(probe.edges, probe.totalLatency);
+}
+
+Bench(ChangeNotifyingInputPin, latency_polling) {
+    static EdgeBenchQueue queue;
+    static EdgeBenchPin pin(0, queue, 0);
+    std::atomic<uint32_t> lastEdge{0};
+    std::atomic<bool> done{false};
+    std::thread interruptSource([&] {
+        for (uint32_t i = 1; i <= EDGE_BENCH_SPACED_EDGES; ++i) {
+            lastEdge.store(benchEdgeClock(), std::memory_order_relaxed);
+            pin.drive(1 == (i & 1), 0);
+            spinEdgeBenchFor(EDGE_BENCH_SPACING_NS);
+        }
+        done.store(true, std::memory_order_release);
+    });
+    uint64_t edges = 0;
+    double totalLatency = 0;
+    bool level = false;
+    while (!done.load(std::memory_order_acquire)) {
+        bool current = pin.read().value();
+        if (current != level) {
+            totalLatency += static_cast<uint32_t>(benchEdgeClock() - lastEdge.load(std::memory_order_relaxed));
+            ++edges;
+            level = current;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    interruptSource.join();
+    state.record(edges, totalLatency);
+}
+
+// Under overflow : the source toggles the pin as fast as possible, the items per second are the edges observed by the
+// main thread, the others are counted as overflows by the queue, or simply missed by the polling.
+static constexpr uint32_t EDGE_BENCH_BURST_EDGES = 1u << 18;
+
+Bench(ChangeNotifyingInputPin, overflow_interrupt_dispatch) {
+    static EdgeBenchQueue queue;
+    static EdgeBenchPin pin(0, queue, 0);
+    EdgeBenchDispatcher dispatcher(queue);
+    EdgeLatencyProbe probe;
+    dispatcher.setHandler(0, EdgeLatencyProbe::onEdge, &probe);
+    std::atomic<bool> done{false};
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::thread interruptSource([&] {
+        for (uint32_t i = 1; i <= EDGE_BENCH_BURST_EDGES; ++i) {
+            pin.drive(1 == (i & 1), 0);
+        }
+        done.store(true, std::memory_order_release);
+    });
+    uint64_t observed = 0;
+    while (!done.load(std::memory_order_acquire)) {
+        observed += dispatcher.dispatch();
+    }
+    interruptSource.join();
+    observed += dispatcher.dispatch();
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    state.record(EDGE_BENCH_BURST_EDGES, std::chrono::duration<double, std::nano>(end - start).count());
+    state.setItemsPerCall(static_cast<double>(observed) / EDGE_BENCH_BURST_EDGES);
+}
+
+Bench(ChangeNotifyingInputPin, overflow_polling) {
+    static EdgeBenchQueue queue;
+    static EdgeBenchPin pin(0, queue, 0);
+    std::atomic<bool> done{false};
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::thread interruptSource([&] {
+        for (uint32_t i = 1; i <= EDGE_BENCH_BURST_EDGES; ++i) {
+            pin.drive(1 == (i & 1), 0);
+        }
+        done.store(true, std::memory_order_release);
+    });
+    uint64_t observed = 0;
+    bool level = false;
+    while (!done.load(std::memory_order_acquire)) {
+        bool current = pin.read().value();
+        observed += current != level;
+        level = current;
+    }
+    interruptSource.join();
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    state.record(EDGE_BENCH_BURST_EDGES, std::chrono::duration<double, std::nano>(end - start).count());
+    state.setItemsPerCall(static_cast<double>(observed) / EDGE_BENCH_BURST_EDGES);
+}
+
+Bench(ChangeNotifyingInputPin, notify_and_dispatch_same_thread) {
+    EdgeBenchQueue queue;
+    EdgeBenchPin pin(0, queue, 0);
+    EdgeBenchDispatcher dispatcher(queue);
+    uint32_t edges = 0;
+    dispatcher.setHandler(0, [](void* context, const cmspk::iopins::EdgeEvent&) { ++*static_cast<uint32_t*>(context); }, &edges);
+    bool level = false;
+    state.measure([&] {
+        level = !level;
+        pin.drive(level, 0);
+        bench::doNotOptimize(dispatcher.dispatch());
+    });
+}
@@ -0,0 +1,56 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Compare the vertical counters debouncing with one counter per channel, at several group sizes.
+
+/**
+ * Reference debouncer, with one counter per channel.
+ */
+template <std::size_t N, std::size_t Samples>
+class PerChannelDebouncer {
+  public:
+    std::bitset<N> sample(const std::bitset<N> raw) noexcept {
+        for (std::size_t c = 0; c < N; ++c) {
+            counters[c] = (raw[c] != state[c]) ? counters[c] + 1 : 0;
+            if (counters[c] == Samples) {
+                state.flip(c);
+                counters[c] = 0;
+            }
+        }
+        return state;
+    }
+
+  private:
+    std::bitset<N> state;
+    std::array<uint8_t, N> counters{};
+};
+
+template <std::size_t N, typename Debouncer>
+static void measureDebouncer(bench::State& state) {
+    Debouncer debouncer;
+    uint64_t noise = 0x0123456789abcdefull;
+    state.measure([&] {
+        noise = noise * 6364136223846793005ull + 1442695040888963407ull;
+        bench::doNotOptimize(debouncer.sample(std::bitset<N>(noise & (noise >> 3))));
+    });
+    state.setItemsPerCall(N);
+}
+
+Bench(Debouncing, per_channel_8) { measureDebouncer<8, PerChannelDebouncer<8, 4>>(state); }
+
+Bench(Debouncing, vertical_8) { measureDebouncer<8, cmspk::iopins::VerticalCounterDebouncer<8, 4>>(state); }
+
+Bench(Debouncing, per_channel_32) { measureDebouncer<32, PerChannelDebouncer<32, 4>>(state); }
+
+Bench(Debouncing, vertical_32) { measureDebouncer<32, cmspk::iopins::VerticalCounterDebouncer<32, 4>>(state); }
+
+Bench(Debouncing, per_channel_64) { measureDebouncer<64, PerChannelDebouncer<64, 4>>(state); }
+
+Bench(Debouncing, vertical_64) { measureDebouncer<64, cmspk::iopins::VerticalCounterDebouncer<64, 4>>(state); }
@@ -0,0 +1,61 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Compare the iteration over the changed pins of a 64 pins group, bit by bit and with `SetBitRange`, for a given
+// number of edges per read.
+
+// ================[BEGIN specializations]==================
+class IdleBenchInputPinGroup final : public cmspk::iopins::InputPinGroup<64> {
+  public:
+    IdleBenchInputPinGroup() : cmspk::iopins::InputPinGroup<64>({}) {}
+
+  private:
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<std::bitset<64>, IoFailureReason> doRead() noexcept { return std::bitset<64>(); }
+};
+// ================[END specializations]==================
+
+template <bool UseSetBitRange>
+static void measureEdgeIteration(bench::State& state, uint64_t edges) {
+    IdleBenchInputPinGroup source;
+    cmspk::iopins::EdgeTracker<64> tracker(source);
+    uint64_t value = 0;
+    std::size_t sum = 0;
+    state.measure([&] {
+        value ^= edges;
+        cmspk::iopins::InputEdges<64> result = tracker.track(value);
+        if (result.hasChanged()) {
+            if constexpr (UseSetBitRange) {
+                for (std::size_t index : result.changedIndices()) {
+                    sum += index;
+                }
+            } else {
+                for (std::size_t index = 0; index < 64; ++index) {
+                    if (result.changed[index]) {
+                        sum += index;
+                    }
+                }
+            }
+        }
+        bench::doNotOptimize(sum);
+    });
+}
+
+Bench(EdgeTracker, bit_by_bit_no_edge_64) { measureEdgeIteration<false>(state, 0); }
+
+Bench(EdgeTracker, set_bit_range_no_edge_64) { measureEdgeIteration<true>(state, 0); }
+
+Bench(EdgeTracker, bit_by_bit_2_edges_64) { measureEdgeIteration<false>(state, 0x0000100000000100ull); }
+
+Bench(EdgeTracker, set_bit_range_2_edges_64) { measureEdgeIteration<true>(state, 0x0000100000000100ull); }
+
+Bench(EdgeTracker, bit_by_bit_16_edges_64) { measureEdgeIteration<false>(state, 0x1111111111111111ull); }
+
+Bench(EdgeTracker, set_bit_range_16_edges_64) { measureEdgeIteration<true>(state, 0x1111111111111111ull); }
@@ -0,0 +1,69 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Turn around a shared 8-bit data bus (write a byte, then read the answer), with the direction remembered against
+// reconfiguring the pins at each access, and the per-pin reconfiguration of the same bus.
+
+static constexpr std::array<uint8_t, 8> IO_BENCH_BUS{16, 17, 18, 19, 20, 21, 22, 23};
+
+Bench(IoPinGroup, turnaround_write_read) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    cmspk::iopins::SimulatedIoPinGroup<8> bus(bank, 0, IO_BENCH_BUS);
+    uint8_t value = 0;
+    state.measure([&] {
+        bus.setDirection(IoDirection::WRITE);
+        bus.write(++value);
+        bus.setDirection(IoDirection::READ);
+        bench::doNotOptimize(bus.read());
+    });
+}
+
+Bench(IoPinGroup, write_burst_redundant_direction) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    cmspk::iopins::SimulatedIoPinGroup<8> bus(bank, 0, IO_BENCH_BUS);
+    uint8_t value = 0;
+    state.measure([&] {
+        bus.setDirection(IoDirection::WRITE);
+        bench::doNotOptimize(bus.write(++value));
+    });
+}
+
+Bench(IoPinGroup, write_burst_uncached_direction) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    cmspk::iopins::SimulatedIoPinGroup<8> bus(bank, 0, IO_BENCH_BUS);
+    uint8_t value = 0;
+    state.measure([&] {
+        bus.invalidateDirection();
+        bus.setDirection(IoDirection::WRITE);
+        bench::doNotOptimize(bus.write(++value));
+    });
+}
+
+Bench(IoPinGroup, turnaround_per_pin) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    std::array<cmspk::iopins::SimulatedIoPin, 8> pins{
+        cmspk::iopins::SimulatedIoPin(bank, 0, 16), cmspk::iopins::SimulatedIoPin(bank, 0, 17), cmspk::iopins::SimulatedIoPin(bank, 0, 18),
+        cmspk::iopins::SimulatedIoPin(bank, 0, 19), cmspk::iopins::SimulatedIoPin(bank, 0, 20), cmspk::iopins::SimulatedIoPin(bank, 0, 21),
+        cmspk::iopins::SimulatedIoPin(bank, 0, 22), cmspk::iopins::SimulatedIoPin(bank, 0, 23)};
+    uint8_t value = 0;
+    state.measure([&] {
+        ++value;
+        for (std::size_t i = 0; i < pins.size(); ++i) {
+            pins[i].setDirection(IoDirection::WRITE);
+            pins[i].write((value >> i) & 1u);
+        }
+        uint8_t answer = 0;
+        for (std::size_t i = 0; i < pins.size(); ++i) {
+            pins[i].setDirection(IoDirection::READ);
+            answer |= static_cast<uint8_t>(pins[i].read().value_or(false) << i);
+        }
+        bench::doNotOptimize(answer);
+    });
+}
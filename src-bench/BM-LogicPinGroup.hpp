@@ -0,0 +1,114 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Logic groups convert with a single XOR against the polarity mask, compared with translating each bit of a raw group
+// value according to the logic setting of its pin.
+
+// ================[BEGIN typical specialization]==================
+template <std::size_t N>
+class MemoryBenchLogicInputPinGroup final : public cmspk::iopins::LogicInputPinGroup<N> {
+  public:
+    MemoryBenchLogicInputPinGroup(const std::array<LogicIoPinSetting, N>& settings, const uint64_t* port)
+        : cmspk::iopins::LogicInputPinGroup<N>({}, settings), port(port) {}
+
+  private:
+    const uint64_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<std::bitset<N>, IoFailureReason> doRead() noexcept { return std::bitset<N>(*port); }
+};
+
+template <std::size_t N>
+class MemoryBenchLogicOutputPinGroup final : public cmspk::iopins::LogicOutputPinGroup<N> {
+  public:
+    MemoryBenchLogicOutputPinGroup(const std::array<LogicIoPinSetting, N>& settings, uint64_t* port)
+        : cmspk::iopins::LogicOutputPinGroup<N>({}, settings), port(port) {}
+
+  private:
+    uint64_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<void, IoFailureReason> doWrite(const std::bitset<N> value) noexcept {
+        *port = value.to_ullong();
+        return std::expected<void, IoFailureReason>();
+    }
+};
+
+template <std::size_t N>
+std::array<LogicIoPinSetting, N> alternatingLogicSettings() {
+    std::array<LogicIoPinSetting, N> settings{};
+    for (std::size_t i = 0; i < N; ++i) {
+        settings[i] = (i % 3 == 0) ? LogicIoPinSetting::ACTIVE_LOW : LogicIoPinSetting::ACTIVE_HIGH;
+    }
+    return settings;
+}
+// ================[END typical specialization]==================
+
+template <std::size_t N>
+void benchLogicGroupReadPerBit(bench::State& state) {
+    uint64_t port = 0x5a5a5a5a5a5a5a5aull;
+    const std::array<LogicIoPinSetting, N> settings = alternatingLogicSettings<N>();
+    MemoryBenchLogicInputPinGroup<N> group(settings, &port);
+    cmspk::iopins::InputPinGroup<N>* g = bench::opaque<cmspk::iopins::InputPinGroup<N>>(&group);
+    const std::array<LogicIoPinSetting, N>* s = bench::opaque(&settings);
+    state.measure([&] {
+        std::bitset<N> raw = g->read().value();
+        std::bitset<N> logic;
+        for (std::size_t i = 0; i < N; ++i) {
+            logic[i] = (LogicIoPinSetting::ACTIVE_HIGH == (*s)[i]) ? raw[i] : !raw[i];
+        }
+        bench::doNotOptimize(logic);
+    });
+    state.setItemsPerCall(N);
+}
+
+template <std::size_t N>
+void benchLogicGroupReadLogic(bench::State& state) {
+    uint64_t port = 0x5a5a5a5a5a5a5a5aull;
+    MemoryBenchLogicInputPinGroup<N> group(alternatingLogicSettings<N>(), &port);
+    cmspk::iopins::LogicInputPinGroup<N>* g = bench::opaque<cmspk::iopins::LogicInputPinGroup<N>>(&group);
+    state.measure([&] { bench::doNotOptimize(g->readLogic()); });
+    state.setItemsPerCall(N);
+}
+
+Bench(LogicPinGroup, per_bit_translation_8) { benchLogicGroupReadPerBit<8>(state); }
+
+Bench(LogicPinGroup, readLogic_8) { benchLogicGroupReadLogic<8>(state); }
+
+Bench(LogicPinGroup, per_bit_translation_32) { benchLogicGroupReadPerBit<32>(state); }
+
+Bench(LogicPinGroup, readLogic_32) { benchLogicGroupReadLogic<32>(state); }
+
+Bench(LogicPinGroup, isAsserted_32) {
+    uint64_t port = 0x5a5a5a5a5a5a5a5aull;
+    MemoryBenchLogicInputPinGroup<32> group(alternatingLogicSettings<32>(), &port);
+    cmspk::iopins::LogicInputPinGroup<32>* g = bench::opaque<cmspk::iopins::LogicInputPinGroup<32>>(&group);
+    const std::bitset<32> mask(0x00ff00ffu);
+    state.measure([&] { bench::doNotOptimize(g->isAsserted(mask)); });
+    state.setItemsPerCall(32);
+}
+
+Bench(LogicPinGroup, writeLogic_32) {
+    uint64_t port = 0;
+    MemoryBenchLogicOutputPinGroup<32> group(alternatingLogicSettings<32>(), &port);
+    cmspk::iopins::LogicOutputPinGroup<32>* g = bench::opaque<cmspk::iopins::LogicOutputPinGroup<32>>(&group);
+    uint32_t value = 0;
+    state.measure([&] { bench::doNotOptimize(g->writeLogic(std::bitset<32>(++value))); });
+    state.setItemsPerCall(32);
+}
+
+Bench(LogicPinGroup, assertMask_32) {
+    uint64_t port = 0;
+    MemoryBenchLogicOutputPinGroup<32> group(alternatingLogicSettings<32>(), &port);
+    cmspk::iopins::LogicOutputPinGroup<32>* g = bench::opaque<cmspk::iopins::LogicOutputPinGroup<32>>(&group);
+    uint32_t value = 0;
+    state.measure([&] { bench::doNotOptimize(g->assertMask(std::bitset<32>(1u << (++value & 31)))); });
+    state.setItemsPerCall(32);
+}
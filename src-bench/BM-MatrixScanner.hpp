@@ -0,0 +1,71 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Measure the time to scan a frame of a 16x16 keyboard matrix, with a fake backend (with diodes) ; at 1 kHz, a frame
+// MUST take far less than 1 ms.
+
+// ================[BEGIN specializations]==================
+struct BenchKeyboardMatrix {
+    std::array<uint16_t, 16> pressed{};
+    uint16_t rowLevels = 0xffff;
+};
+
+class BenchMatrixRows final : public cmspk::iopins::OutputPinGroup<16> {
+  public:
+    BenchMatrixRows(BenchKeyboardMatrix* matrix) : cmspk::iopins::OutputPinGroup<16>({}), matrix(matrix) {}
+
+  private:
+    BenchKeyboardMatrix* matrix;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<void, IoFailureReason> doWrite(std::bitset<16> value) noexcept {
+        matrix->rowLevels = static_cast<uint16_t>(value.to_ulong());
+        return std::expected<void, IoFailureReason>();
+    }
+};
+
+class BenchMatrixColumns final : public cmspk::iopins::InputPinGroup<16> {
+  public:
+    BenchMatrixColumns(BenchKeyboardMatrix* matrix) : cmspk::iopins::InputPinGroup<16>({}), matrix(matrix) {}
+
+  private:
+    BenchKeyboardMatrix* matrix;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<std::bitset<16>, IoFailureReason> doRead() noexcept {
+        uint16_t connected = 0;
+        uint16_t selected = static_cast<uint16_t>(~matrix->rowLevels);
+        for (std::size_t r = 0; r < 16; ++r) {
+            connected |= ((selected >> r) & 1u) ? matrix->pressed[r] : 0;
+        }
+        return std::bitset<16>(static_cast<uint16_t>(~connected));
+    }
+};
+// ================[END specializations]==================
+
+Bench(MatrixScanner, scan_frame_16x16) {
+    BenchKeyboardMatrix matrix;
+    BenchMatrixRows rows(&matrix);
+    BenchMatrixColumns columns(&matrix);
+    cmspk::iopins::MatrixScanner<16, 16> scanner(rows, columns);
+    uint32_t frame = 0;
+    state.measure(
+        [&] {
+            // typing : a key changes every 8 frames
+            if (0 == (++frame & 7)) {
+                matrix.pressed[(frame >> 3) & 15] ^= static_cast<uint16_t>(1u << ((frame >> 7) & 15));
+            }
+            bench::doNotOptimize(scanner.scan());
+            while (scanner.pollEvent().has_value()) {
+            }
+        },
+        1u << 16);
+    state.setItemsPerCall(1);
+}
@@ -0,0 +1,86 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Read and write wide buses spanning several ports of a `SimulatedPinBank` : one access per port with the multi-port
+// groups, against one access per pin ; the 128 pins bus has slices straddling the 64 bits words.
+
+// ================[BEGIN specializations]==================
+template <std::size_t N, std::size_t Ports>
+class PerPinBenchInputPinGroup final : public cmspk::iopins::InputPinGroup<N> {
+  public:
+    PerPinBenchInputPinGroup(cmspk::iopins::SimulatedPinBank& bank, const cmspk::iopins::PortSliceLayout<N, Ports>& layout)
+        : cmspk::iopins::InputPinGroup<N>(layout.getPinIds()), bank(bank) {
+        for (std::size_t s = 0; s < Ports; ++s) {
+            for (std::size_t i = 0; i < layout.getSlice(s).count; ++i) {
+                ports[layout.getOffset(s) + i] = layout.getSlice(s).port;
+            }
+        }
+    }
+
+  private:
+    cmspk::iopins::SimulatedPinBank& bank;
+    std::array<uint8_t, N> ports{};
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<std::bitset<N>, IoFailureReason> doRead() noexcept {
+        std::bitset<N> result;
+        const std::array<uint8_t, N> ids = this->getPinIds();
+        for (std::size_t i = 0; i < N; ++i) {
+            result[i] = (bank.readPort(ports[i]) >> ids[i]) & 1u;
+        }
+        return result;
+    }
+};
+// ================[END specializations]==================
+
+static constexpr cmspk::iopins::PortSliceLayout<64, 2> BUS_64({{0, 0, 32}, {1, 0, 32}});
+static constexpr cmspk::iopins::PortSliceLayout<128, 5> BUS_128({{0, 8, 24}, {1, 0, 32}, {2, 0, 32}, {3, 0, 32}, {4, 4, 8}});
+
+template <typename Group, std::size_t N, std::size_t Ports>
+static void measureBusRead(bench::State& state, const cmspk::iopins::PortSliceLayout<N, Ports>& layout) {
+    cmspk::iopins::SimulatedPinBank bank(Ports);
+    Group group(bank, layout);
+    cmspk::iopins::InputPinGroup<N>* g = bench::opaque<cmspk::iopins::InputPinGroup<N>>(&group);
+    uint32_t levels = 0xa5a5a5a5u;
+    state.measure([&] {
+        levels = levels * 1664525u + 1013904223u;
+        bank.drive(0, 0xffffffffu, levels);
+        bench::doNotOptimize(g->read());
+    });
+    state.setItemsPerCall(N);
+}
+
+template <std::size_t N, std::size_t Ports>
+static void measureBusWrite(bench::State& state, const cmspk::iopins::PortSliceLayout<N, Ports>& layout) {
+    cmspk::iopins::SimulatedPinBank bank(Ports);
+    for (std::size_t port = 0; port < Ports; ++port) {
+        bank.setDirections(port, 0xffffffffu, IoDirection::WRITE);
+    }
+    cmspk::iopins::SimulatedMultiPortOutputPinGroup<N, Ports> group(bank, layout);
+    cmspk::iopins::OutputPinGroup<N>* g = bench::opaque<cmspk::iopins::OutputPinGroup<N>>(&group);
+    std::bitset<N> value(0x0123456789abcdefull);
+    state.measure([&] {
+        value = (value << 1) | (value >> (N - 1));
+        bench::doNotOptimize(g->write(value));
+    });
+    state.setItemsPerCall(N);
+}
+
+Bench(MultiPortPinGroup, per_pin_read_64) { measureBusRead<PerPinBenchInputPinGroup<64, 2>, 64>(state, BUS_64); }
+
+Bench(MultiPortPinGroup, multi_port_read_64) { measureBusRead<cmspk::iopins::SimulatedMultiPortInputPinGroup<64, 2>, 64>(state, BUS_64); }
+
+Bench(MultiPortPinGroup, per_pin_read_128) { measureBusRead<PerPinBenchInputPinGroup<128, 5>, 128>(state, BUS_128); }
+
+Bench(MultiPortPinGroup, multi_port_read_128) { measureBusRead<cmspk::iopins::SimulatedMultiPortInputPinGroup<128, 5>, 128>(state, BUS_128); }
+
+Bench(MultiPortPinGroup, multi_port_write_64) { measureBusWrite<64>(state, BUS_64); }
+
+Bench(MultiPortPinGroup, multi_port_write_128) { measureBusWrite<128>(state, BUS_128); }
@@ -0,0 +1,101 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Memory footprint of the pin types, reported along the measurements to catch layout regressions.
+
+// The static pins are measured without any state of their own, thanks to a derived type that is only declared.
+class SizeProbe;
+
+BenchSizeOf(cmspk::iopins::BinaryInputPin);
+BenchSizeOf(cmspk::iopins::AnalogInputPin8);
+BenchSizeOf(cmspk::iopins::AnalogInputPin16);
+BenchSizeOf(cmspk::iopins::AnalogInputPin32);
+BenchSizeOf(cmspk::iopins::BinaryOutputPin);
+BenchSizeOf(cmspk::iopins::AnalogOutputPin8);
+BenchSizeOf(cmspk::iopins::AnalogOutputPin16);
+BenchSizeOf(cmspk::iopins::AnalogOutputPin32);
+BenchSizeOf(cmspk::iopins::LogicInputPin);
+BenchSizeOf(cmspk::iopins::LogicOutputPin);
+BenchSizeOf(cmspk::iopins::DebouncedLogicInputPin<4>);
+BenchSizeOf(cmspk::iopins::OversampledInputPin<uint16_t, 16, 2>);
+BenchSizeOf(cmspk::iopins::CalibratedInputPin<uint16_t, BenchThermistorLookup>);
+BenchSizeOf(cmspk::iopins::CalibratedOutputPin<uint16_t, BenchThermistorInterpolation>);
+BenchSizeOf(cmspk::iopins::FilteredInputPin<uint16_t, cmspk::iopins::MovingAverage<uint16_t, 16>>);
+BenchSizeOf(cmspk::iopins::OpenDrainPin);
+BenchSizeOf(cmspk::iopins::BinaryIoPin);
+BenchSizeOf(cmspk::iopins::IoPinOctet);
+BenchSizeOf(cmspk::iopins::ExpanderOutputPin);
+BenchSizeOf(cmspk::iopins::ExpanderLogicOutputPin);
+BenchSizeOf(cmspk::iopins::PortOutputPin);
+BenchSizeOf(cmspk::iopins::PortLogicOutputPin);
+
+BenchSizeOf(cmspk::iopins::InputPinPair);
+BenchSizeOf(cmspk::iopins::InputPinOctet);
+BenchSizeOf(cmspk::iopins::InputPinGroup<16>);
+BenchSizeOf(cmspk::iopins::InputPinGroup<32>);
+BenchSizeOf(cmspk::iopins::InputPinGroup<64>);
+BenchSizeOf(cmspk::iopins::OutputPinPair);
+BenchSizeOf(cmspk::iopins::OutputPinOctet);
+BenchSizeOf(cmspk::iopins::OutputPinGroup<16>);
+BenchSizeOf(cmspk::iopins::OutputPinGroup<32>);
+BenchSizeOf(cmspk::iopins::OutputPinGroup<64>);
+BenchSizeOf(cmspk::iopins::LogicInputPinGroup<8>);
+BenchSizeOf(cmspk::iopins::LogicInputPinGroup<32>);
+BenchSizeOf(cmspk::iopins::LogicOutputPinGroup<8>);
+BenchSizeOf(cmspk::iopins::LogicOutputPinGroup<32>);
+BenchSizeOf(cmspk::iopins::PortInputPinGroup<8>);
+BenchSizeOf(cmspk::iopins::PortInputPinGroup<32>);
+BenchSizeOf(cmspk::iopins::ShadowedOutputPinGroup<8>);
+BenchSizeOf(cmspk::iopins::ShadowedOutputPinGroup<32>);
+BenchSizeOf(cmspk::iopins::DebouncedInputPinGroup<8, 4>);
+BenchSizeOf(cmspk::iopins::DebouncedInputPinGroup<32, 4>);
+
+BenchSizeOf(cmspk::iopins::StaticBinaryInputPin<SizeProbe>);
+BenchSizeOf(cmspk::iopins::StaticBinaryOutputPin<SizeProbe>);
+BenchSizeOf(cmspk::iopins::StaticLogicInputPin<SizeProbe>);
+BenchSizeOf(cmspk::iopins::StaticLogicOutputPin<SizeProbe>);
+BenchSizeOf(cmspk::iopins::StaticInputPinOctet<SizeProbe>);
+BenchSizeOf(cmspk::iopins::StaticOutputPinOctet<SizeProbe>);
+BenchSizeOf(cmspk::iopins::StaticBinaryInputPin<SizeProbe>::Reader);
+BenchSizeOf(cmspk::iopins::StaticLogicOutputPin<SizeProbe>::LogicWriter);
+BenchSizeOf(cmspk::iopins::StaticBinaryInputPin<SizeProbe, cmspk::iopins::NoInstrumentation>);
+BenchSizeOf(cmspk::iopins::StaticBinaryInputPin<SizeProbe, cmspk::iopins::CountingInstrumentation<cmspk::iopins::SteadyInstrumentationClock>>);
+BenchSizeOf(cmspk::iopins::InstrumentedInputPin<bool, cmspk::iopins::CountingInstrumentation<cmspk::iopins::SteadyInstrumentationClock>>);
+BenchSizeOf(cmspk::iopins::PinStatistics);
+
+BenchSizeOf(cmspk::iopins::SimulatedInputPin);
+BenchSizeOf(cmspk::iopins::SimulatedOutputPin);
+BenchSizeOf(cmspk::iopins::SimulatedLogicInputPin);
+BenchSizeOf(cmspk::iopins::SimulatedLogicOutputPin);
+BenchSizeOf(cmspk::iopins::SimulatedOpenDrainPin);
+BenchSizeOf(cmspk::iopins::SimulatedIoPin);
+BenchSizeOf(cmspk::iopins::SimulatedIoPinGroup<8>);
+BenchSizeOf(cmspk::iopins::SimulatedPortExpander);
+BenchSizeOf(cmspk::iopins::SimulatedOutputPort);
+BenchSizeOf(cmspk::iopins::SimulatedInputPinGroup<8>);
+BenchSizeOf(cmspk::iopins::SimulatedOutputPinGroup<8>);
+BenchSizeOf(cmspk::iopins::SimulatedMultiPortInputPinGroup<128, 5>);
+BenchSizeOf(cmspk::iopins::SimulatedMultiPortOutputPinGroup<128, 5>);
+BenchSizeOf(cmspk::iopins::SimulatedChangeNotifyingInputPin<256>);
+
+BenchSizeOf(cmspk::iopins::MovingAverage<uint16_t, 16>);
+BenchSizeOf(cmspk::iopins::MedianFilter<uint16_t, 5>);
+BenchSizeOf(cmspk::iopins::IirFilter<uint16_t, 4>);
+BenchSizeOf(cmspk::iopins::BcmScheduler<64, 8>);
+BenchSizeOf(cmspk::iopins::BcmOutputPin<64, 8>);
+BenchSizeOf(cmspk::iopins::SoftI2cMaster);
+BenchSizeOf(cmspk::iopins::OutputTransaction);
+BenchSizeOf(cmspk::iopins::EdgeEvent);
+BenchSizeOf(cmspk::iopins::EdgeEventQueue<256>);
+BenchSizeOf(cmspk::iopins::EdgeDispatcher<8, 256>);
+BenchSizeOf(cmspk::iopins::SoftSpiMaster<cmspk::iopins::SpiSeparateLines>);
+BenchSizeOf(cmspk::iopins::SoftSpiMaster<cmspk::iopins::SpiSharedPortLines>);
+BenchSizeOf(cmspk::iopins::ParallelBusWriter<cmspk::iopins::ParallelSeparateLines>);
+BenchSizeOf(cmspk::iopins::ParallelBusWriter<cmspk::iopins::ParallelSharedPortLines>);
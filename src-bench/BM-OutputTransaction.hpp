@@ -0,0 +1,73 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// A step of a state machine updating 8 pins spread over 3 ports of the simulated bank, one pin pulsing and 2 pins
+// keeping their value, in steps per second : one port write per pin write against an `OutputTransaction` committing
+// one write per changed port.
+
+struct TransactionBenchPins {
+    cmspk::iopins::SimulatedPinBank bank{3};
+    cmspk::iopins::SimulatedOutputPort port0{bank, 0};
+    cmspk::iopins::SimulatedOutputPort port1{bank, 1};
+    cmspk::iopins::SimulatedOutputPort port2{bank, 2};
+    cmspk::iopins::PortOutputPin a{port0, 0};
+    cmspk::iopins::PortOutputPin b{port0, 5};
+    cmspk::iopins::PortLogicOutputPin c{port0, 9, LogicIoPinSetting::ACTIVE_LOW};
+    cmspk::iopins::PortOutputPin d{port1, 1};
+    cmspk::iopins::PortOutputPin e{port1, 2};
+    cmspk::iopins::PortLogicOutputPin f{port1, 3};
+    cmspk::iopins::PortOutputPin g{port2, 7};
+    cmspk::iopins::PortOutputPin h{port2, 8};
+
+    TransactionBenchPins() {
+        for (std::size_t port = 0; port < 3; ++port) {
+            bank.setDirections(port, 0xffffu, IoDirection::WRITE);
+        }
+    }
+
+    void step(bool phase) {
+        cmspk::iopins::BinaryOutputPin* pins[] = {&a, &b, &c, &d, &e, &f, &g, &h};
+        cmspk::iopins::BinaryOutputPin** p = bench::opaque<cmspk::iopins::BinaryOutputPin*>(pins);
+        p[0]->write(phase);
+        p[1]->write(!phase);
+        p[2]->write(phase);
+        p[3]->write(true);
+        p[4]->write(phase);
+        // a strobe pulse
+        p[5]->write(true);
+        p[5]->write(false);
+        p[6]->write(false);
+        p[7]->write(!phase);
+    }
+};
+
+Bench(OutputTransaction, direct_writes_8_pins_3_ports) {
+    TransactionBenchPins pins;
+    bool phase = false;
+    state.measure(
+        [&] {
+            phase = !phase;
+            pins.step(phase);
+        },
+        1u << 16);
+}
+
+Bench(OutputTransaction, transaction_8_pins_3_ports) {
+    TransactionBenchPins pins;
+    cmspk::iopins::OutputTransaction transaction{pins.port0, pins.port1, pins.port2};
+    bool phase = false;
+    state.measure(
+        [&] {
+            phase = !phase;
+            pins.step(phase);
+            bench::doNotOptimize(transaction.commit());
+        },
+        1u << 16);
+}
@@ -0,0 +1,78 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Throughput of a frame push to an 8080 style parallel display on the simulated bank, in bytes per second : the
+// straightforward loop writing every line for each byte, the separate lines and the shared port writers, and a fill.
+
+static constexpr std::size_t PARALLEL_BENCH_FRAME = 4096;
+
+static std::array<uint8_t, PARALLEL_BENCH_FRAME> makeParallelBenchFrame() {
+    std::array<uint8_t, PARALLEL_BENCH_FRAME> frame{};
+    for (std::size_t i = 0; i < frame.size(); ++i) {
+        frame[i] = static_cast<uint8_t>(i * 29);
+    }
+    return frame;
+}
+
+Bench(ParallelBusWriter, frame_4096_every_line) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    bank.setDirections(0, 0x3ffu, IoDirection::WRITE);
+    cmspk::iopins::SimulatedOutputPinGroup<8> data(bank, 0, {0, 1, 2, 3, 4, 5, 6, 7});
+    cmspk::iopins::SimulatedOutputPin dc(bank, 0, 8);
+    cmspk::iopins::SimulatedOutputPin wr(bank, 0, 9);
+    cmspk::iopins::OutputPinOctet& dataLines = data;
+    cmspk::iopins::BinaryOutputPin& dcLine = dc;
+    cmspk::iopins::BinaryOutputPin& wrLine = wr;
+    std::array<uint8_t, PARALLEL_BENCH_FRAME> frame = makeParallelBenchFrame();
+    state.measure(
+        [&] {
+            for (uint8_t value : frame) {
+                dataLines.write(std::bitset<8>(value));
+                dcLine.write(true);
+                wrLine.write(false);
+                wrLine.write(true);
+            }
+        },
+        1u << 8);
+    state.setItemsPerCall(PARALLEL_BENCH_FRAME);
+}
+
+Bench(ParallelBusWriter, frame_4096_separate_lines) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    bank.setDirections(0, 0x3ffu, IoDirection::WRITE);
+    cmspk::iopins::SimulatedOutputPinGroup<8> data(bank, 0, {0, 1, 2, 3, 4, 5, 6, 7});
+    cmspk::iopins::SimulatedOutputPin dc(bank, 0, 8);
+    cmspk::iopins::SimulatedOutputPin wr(bank, 0, 9);
+    cmspk::iopins::ParallelBusWriter<cmspk::iopins::ParallelSeparateLines> bus{cmspk::iopins::ParallelSeparateLines(data, dc, wr)};
+    std::array<uint8_t, PARALLEL_BENCH_FRAME> frame = makeParallelBenchFrame();
+    state.measure([&] { bench::doNotOptimize(bus.writeData(frame)); }, 1u << 8);
+    state.setItemsPerCall(PARALLEL_BENCH_FRAME);
+}
+
+Bench(ParallelBusWriter, frame_4096_shared_port) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    bank.setDirections(0, 0x3ffu, IoDirection::WRITE);
+    cmspk::iopins::SimulatedOutputPinGroup<10> lines(bank, 0, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    cmspk::iopins::ParallelBusWriter<cmspk::iopins::ParallelSharedPortLines> bus{cmspk::iopins::ParallelSharedPortLines(lines)};
+    std::array<uint8_t, PARALLEL_BENCH_FRAME> frame = makeParallelBenchFrame();
+    state.measure([&] { bench::doNotOptimize(bus.writeData(frame)); }, 1u << 8);
+    state.setItemsPerCall(PARALLEL_BENCH_FRAME);
+}
+
+Bench(ParallelBusWriter, fill_4096_separate_lines) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    bank.setDirections(0, 0x3ffu, IoDirection::WRITE);
+    cmspk::iopins::SimulatedOutputPinGroup<8> data(bank, 0, {0, 1, 2, 3, 4, 5, 6, 7});
+    cmspk::iopins::SimulatedOutputPin dc(bank, 0, 8);
+    cmspk::iopins::SimulatedOutputPin wr(bank, 0, 9);
+    cmspk::iopins::ParallelBusWriter<cmspk::iopins::ParallelSeparateLines> bus{cmspk::iopins::ParallelSeparateLines(data, dc, wr)};
+    state.measure([&] { bench::doNotOptimize(bus.fill(0x00, PARALLEL_BENCH_FRAME)); }, 1u << 8);
+    state.setItemsPerCall(PARALLEL_BENCH_FRAME);
+}
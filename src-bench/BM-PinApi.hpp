@@ -0,0 +1,193 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Per-call latency of the public API of the virtual pins and pin groups, backed by a plain memory "register" ; group
+// throughputs are reported in pins per second.
+
+// ================[BEGIN typical specialization]==================
+template <typename S>
+class MemoryBenchInputPin final : public cmspk::iopins::InputPin<S> {
+  public:
+    MemoryBenchInputPin(uint8_t id, const uint32_t* port) : cmspk::iopins::InputPin<S>(id), port(port) {}
+
+  private:
+    const uint32_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<S, IoFailureReason> doRead() noexcept { return static_cast<S>((*port) >> this->getPinId()); }
+};
+
+template <typename S>
+class MemoryBenchOutputPin final : public cmspk::iopins::OutputPin<S> {
+  public:
+    MemoryBenchOutputPin(uint8_t id, uint32_t* port) : cmspk::iopins::OutputPin<S>(id), port(port) {}
+
+  private:
+    uint32_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<void, IoFailureReason> doWrite(const S value) noexcept {
+        *port = static_cast<uint32_t>(value) << this->getPinId();
+        return std::expected<void, IoFailureReason>();
+    }
+};
+
+class MemoryBenchLogicInputPin final : public LogicInputPin {
+  public:
+    MemoryBenchLogicInputPin(uint8_t id, const uint32_t* port) : LogicInputPin(id, LogicIoPinSetting::ACTIVE_LOW), port(port) {}
+
+  private:
+    const uint32_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<bool, IoFailureReason> doRead() noexcept { return ((*port) >> getPinId()) & 1u; }
+};
+
+class MemoryBenchLogicOutputPin final : public LogicOutputPin {
+  public:
+    MemoryBenchLogicOutputPin(uint8_t id, uint32_t* port) : LogicOutputPin(id, LogicIoPinSetting::ACTIVE_LOW), port(port) {}
+
+  private:
+    uint32_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<void, IoFailureReason> doWrite(const bool value) noexcept {
+        *port = ((*port) & ~(1u << getPinId())) | (static_cast<uint32_t>(value) << getPinId());
+        return std::expected<void, IoFailureReason>();
+    }
+};
+
+template <std::size_t N>
+std::array<uint8_t, N> memoryBenchPinIds() {
+    std::array<uint8_t, N> ids{};
+    for (std::size_t i = 0; i < N; ++i) {
+        ids[i] = static_cast<uint8_t>(i);
+    }
+    return ids;
+}
+
+template <std::size_t N>
+class MemoryBenchInputPinGroup final : public cmspk::iopins::InputPinGroup<N> {
+  public:
+    MemoryBenchInputPinGroup(const uint64_t* port) : cmspk::iopins::InputPinGroup<N>(memoryBenchPinIds<N>()), port(port) {}
+
+  private:
+    const uint64_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<std::bitset<N>, IoFailureReason> doRead() noexcept { return std::bitset<N>(*port); }
+};
+
+template <std::size_t N>
+class MemoryBenchOutputPinGroup final : public cmspk::iopins::OutputPinGroup<N> {
+  public:
+    MemoryBenchOutputPinGroup(uint64_t* port) : cmspk::iopins::OutputPinGroup<N>(memoryBenchPinIds<N>()), port(port) {}
+
+  private:
+    uint64_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<void, IoFailureReason> doWrite(const std::bitset<N> value) noexcept {
+        *port = value.to_ullong();
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[END typical specialization]==================
+
+template <typename S>
+void benchPinRead(bench::State& state) {
+    uint32_t port = 0x5a5a5a5a;
+    MemoryBenchInputPin<S> pin(3, &port);
+    cmspk::iopins::InputPin<S>* p = bench::opaque<cmspk::iopins::InputPin<S>>(&pin);
+    state.measure([&] { bench::doNotOptimize(p->read()); });
+    state.setItemsPerCall(1);
+}
+
+template <typename S>
+void benchPinWrite(bench::State& state) {
+    uint32_t port = 0;
+    MemoryBenchOutputPin<S> pin(3, &port);
+    cmspk::iopins::OutputPin<S>* p = bench::opaque<cmspk::iopins::OutputPin<S>>(&pin);
+    S value{};
+    state.measure([&] { bench::doNotOptimize(p->write(value = static_cast<S>(!value))); });
+    state.setItemsPerCall(1);
+}
+
+template <std::size_t N>
+void benchGroupRead(bench::State& state) {
+    uint64_t port = 0x5a5a5a5a5a5a5a5aull;
+    MemoryBenchInputPinGroup<N> group(&port);
+    cmspk::iopins::InputPinGroup<N>* g = bench::opaque<cmspk::iopins::InputPinGroup<N>>(&group);
+    state.measure([&] { bench::doNotOptimize(g->read()); });
+    state.setItemsPerCall(N);
+}
+
+template <std::size_t N>
+void benchGroupWrite(bench::State& state) {
+    uint64_t port = 0;
+    MemoryBenchOutputPinGroup<N> group(&port);
+    cmspk::iopins::OutputPinGroup<N>* g = bench::opaque<cmspk::iopins::OutputPinGroup<N>>(&group);
+    uint64_t value = 0;
+    state.measure([&] { bench::doNotOptimize(g->write(std::bitset<N>(++value))); });
+    state.setItemsPerCall(N);
+}
+
+Bench(PinApi, read) { benchPinRead<bool>(state); }
+
+Bench(PinApi, read_analog_16) { benchPinRead<uint16_t>(state); }
+
+Bench(PinApi, write) { benchPinWrite<bool>(state); }
+
+Bench(PinApi, write_analog_16) { benchPinWrite<uint16_t>(state); }
+
+Bench(PinApi, readLogic) {
+    uint32_t port = 0x5a;
+    MemoryBenchLogicInputPin pin(3, &port);
+    LogicInputPin* p = bench::opaque<LogicInputPin>(&pin);
+    state.measure([&] { bench::doNotOptimize(p->readLogic()); });
+    state.setItemsPerCall(1);
+}
+
+Bench(PinApi, isAsserted) {
+    uint32_t port = 0x5a;
+    MemoryBenchLogicInputPin pin(3, &port);
+    LogicInputPin* p = bench::opaque<LogicInputPin>(&pin);
+    state.measure([&] { bench::doNotOptimize(p->isAsserted()); });
+    state.setItemsPerCall(1);
+}
+
+Bench(PinApi, writeLogic) {
+    uint32_t port = 0;
+    MemoryBenchLogicOutputPin pin(3, &port);
+    LogicOutputPin* p = bench::opaque<LogicOutputPin>(&pin);
+    bool value = false;
+    state.measure([&] { bench::doNotOptimize(p->writeLogic(value = !value)); });
+    state.setItemsPerCall(1);
+}
+
+Bench(PinApi, group_read_2) { benchGroupRead<2>(state); }
+
+Bench(PinApi, group_read_8) { benchGroupRead<8>(state); }
+
+Bench(PinApi, group_read_16) { benchGroupRead<16>(state); }
+
+Bench(PinApi, group_read_32) { benchGroupRead<32>(state); }
+
+Bench(PinApi, group_read_64) { benchGroupRead<64>(state); }
+
+Bench(PinApi, group_write_2) { benchGroupWrite<2>(state); }
+
+Bench(PinApi, group_write_8) { benchGroupWrite<8>(state); }
+
+Bench(PinApi, group_write_16) { benchGroupWrite<16>(state); }
+
+Bench(PinApi, group_write_32) { benchGroupWrite<32>(state); }
+
+Bench(PinApi, group_write_64) { benchGroupWrite<64>(state); }
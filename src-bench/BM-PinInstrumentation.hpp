@@ -0,0 +1,72 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Cost of the instrumentation policies on the read of a pin backed by a plain memory "register" : without policy the
+// read MUST cost the same as the bare hooks (the handle), with counting it costs the clock readings and the counters.
+
+// ================[BEGIN specializations]==================
+// a free running counter register, like the cycle counter of a Cortex-M
+struct RegisterBenchClock {
+    static inline volatile uint32_t counter = 0;
+    static uint32_t now() noexcept { return counter; }
+};
+
+template <typename Instrumentation>
+class InstrumentationBenchInputPin final : public cmspk::iopins::StaticBinaryInputPin<InstrumentationBenchInputPin<Instrumentation>, Instrumentation> {
+    friend cmspk::iopins::StaticBinaryInputPin<InstrumentationBenchInputPin<Instrumentation>, Instrumentation>;
+
+  public:
+    InstrumentationBenchInputPin(uint8_t id, const uint32_t* port)
+        : cmspk::iopins::StaticBinaryInputPin<InstrumentationBenchInputPin<Instrumentation>, Instrumentation>(id), port(port) {}
+
+  private:
+    const uint32_t* port;
+
+    std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    std::expected<bool, IoFailureReason> doRead() noexcept { return ((*port) >> this->getPinId()) & 1u; }
+};
+// ================[END specializations]==================
+
+template <typename Instrumentation>
+static void benchInstrumentedStaticRead(bench::State& state) {
+    uint32_t port = 0x5a;
+    InstrumentationBenchInputPin<Instrumentation> pin(3, bench::opaque(&port));
+    state.measure([&] { bench::doNotOptimize(pin.read()); });
+}
+
+Bench(PinInstrumentation, static_reader_readRaw) {
+    uint32_t port = 0x5a;
+    InstrumentationBenchInputPin<cmspk::iopins::NoInstrumentation> pin(3, bench::opaque(&port));
+    auto reader = pin.acquireReader().value();
+    state.measure([&] { bench::doNotOptimize(reader.readRaw()); });
+}
+
+Bench(PinInstrumentation, static_read_no_instrumentation) { benchInstrumentedStaticRead<cmspk::iopins::NoInstrumentation>(state); }
+
+Bench(PinInstrumentation, static_read_counting_register_clock) {
+    benchInstrumentedStaticRead<cmspk::iopins::CountingInstrumentation<RegisterBenchClock>>(state);
+}
+
+Bench(PinInstrumentation, static_read_counting_steady_clock) { benchInstrumentedStaticRead<cmspk::iopins::CountingInstrumentation<cmspk::iopins::SteadyInstrumentationClock>>(state); }
+
+Bench(PinInstrumentation, virtual_read) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    cmspk::iopins::SimulatedInputPin pin(bank, 0, 3);
+    BinaryInputPin* p = bench::opaque<BinaryInputPin>(&pin);
+    state.measure([&] { bench::doNotOptimize(p->read()); });
+}
+
+Bench(PinInstrumentation, virtual_read_counting_register_clock) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    cmspk::iopins::SimulatedInputPin pin(bank, 0, 3);
+    cmspk::iopins::InstrumentedInputPin<bool, cmspk::iopins::CountingInstrumentation<RegisterBenchClock>> instrumented(pin);
+    BinaryInputPin* p = bench::opaque<BinaryInputPin>(&instrumented);
+    state.measure([&] { bench::doNotOptimize(p->read()); });
+}
@@ -0,0 +1,105 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Pins behind an I2C port expander (registers laid out like a MCP23017 : IODIR at 0x00, GPIO at 0x12, OLAT at 0x14),
+// reached through the bit-banged I2C master and a simulated target ; a call updates or reads the 16 pins of the chip,
+// pin by pin or inside one batch.
+
+// ================[BEGIN specializations]==================
+class I2cBenchPortExpander final : public cmspk::iopins::PortExpander {
+  public:
+    I2cBenchPortExpander(cmspk::iopins::SoftI2cMaster& i2c, uint8_t address) : i2c(i2c), address(address) {}
+
+  private:
+    cmspk::iopins::SoftI2cMaster& i2c;
+    uint8_t address;
+
+    std::expected<void, IoFailureReason> writeWord(uint8_t firstRegister, Word value) noexcept {
+        const std::array<uint8_t, 2> bytes{static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8)};
+        return i2c.writeRegisters(address, firstRegister, bytes);
+    }
+
+    virtual std::expected<void, IoFailureReason> doWriteOutputs(Word image) noexcept { return writeWord(0x14, image); }
+    virtual std::expected<Word, IoFailureReason> doReadInputs() noexcept {
+        std::array<uint8_t, 2> bytes{};
+        std::expected<void, IoFailureReason> result = i2c.readRegisters(address, 0x12, bytes);
+        if (!result.has_value()) {
+            return std::unexpected(result.error());
+        }
+        return static_cast<Word>(bytes[0] | (bytes[1] << 8));
+    }
+    // IODIR bits set are inputs
+    virtual std::expected<void, IoFailureReason> doWriteDirections(Word outputMask) noexcept { return writeWord(0x00, static_cast<Word>(~outputMask)); }
+};
+
+struct I2cBenchRig {
+    cmspk::iopins::SimulatedPinBank bank{1};
+    cmspk::iopins::SimulatedI2cTarget target{bank, 0, 0, 1, 0x20};
+    cmspk::iopins::SimulatedOpenDrainPin scl{bank, 0, 0};
+    cmspk::iopins::SimulatedOpenDrainPin sda{bank, 0, 1};
+    cmspk::iopins::SoftI2cMaster i2c{scl, sda};
+    I2cBenchPortExpander expander{i2c, 0x20};
+};
+// ================[END specializations]==================
+
+static void measureExpanderWrites(bench::State& state, bool batched) {
+    I2cBenchRig rig;
+    rig.expander.setOutputMask(0xffff);
+    std::vector<cmspk::iopins::ExpanderOutputPin> pins;
+    for (uint8_t bit = 0; bit < 16; ++bit) {
+        pins.emplace_back(rig.expander, bit);
+    }
+    uint16_t value = 0;
+    state.measure(
+        [&] {
+            ++value;
+            if (batched) {
+                rig.expander.beginBatch();
+            }
+            for (std::size_t i = 0; i < pins.size(); ++i) {
+                bench::doNotOptimize(bench::opaque<BinaryOutputPin>(&pins[i])->write((value >> i) & 1u));
+            }
+            if (batched) {
+                bench::doNotOptimize(rig.expander.commit());
+            }
+        },
+        1u << 10);
+    state.setItemsPerCall(16);
+}
+
+static void measureExpanderReads(bench::State& state, bool batched) {
+    I2cBenchRig rig;
+    std::vector<cmspk::iopins::ExpanderInputPin> pins;
+    for (uint8_t bit = 0; bit < 16; ++bit) {
+        pins.emplace_back(rig.expander, bit);
+    }
+    state.measure(
+        [&] {
+            if (batched) {
+                rig.expander.beginBatch();
+            }
+            for (cmspk::iopins::ExpanderInputPin& pin : pins) {
+                bench::doNotOptimize(bench::opaque<BinaryInputPin>(&pin)->read());
+            }
+            if (batched) {
+                bench::doNotOptimize(rig.expander.commit());
+            }
+        },
+        1u << 10);
+    state.setItemsPerCall(16);
+}
+
+Bench(PortExpander, pin_by_pin_write_16) { measureExpanderWrites(state, false); }
+
+Bench(PortExpander, batched_write_16) { measureExpanderWrites(state, true); }
+
+Bench(PortExpander, pin_by_pin_read_16) { measureExpanderReads(state, false); }
+
+Bench(PortExpander, batched_read_16) { measureExpanderReads(state, true); }
@@ -0,0 +1,72 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Compare the bit by bit gathering of a group with the precomputed gather plan of `PortInputPinGroup`.
+
+// ================[BEGIN specializations]==================
+template <std::size_t N>
+class BitByBitBenchInputPinGroup final : public cmspk::iopins::InputPinGroup<N> {
+  public:
+    BitByBitBenchInputPinGroup(std::array<uint8_t, N> ids, const uint32_t* port) : cmspk::iopins::InputPinGroup<N>(ids), port(port) {}
+
+  private:
+    const uint32_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<std::bitset<N>, IoFailureReason> doRead() noexcept {
+        std::bitset<N> result;
+        uint32_t word = *port;
+        std::array<uint8_t, N> ids = this->getPinIds();
+        for (std::size_t i = 0; i < N; ++i) {
+            result[i] = (word >> ids[i]) & 1u;
+        }
+        return result;
+    }
+};
+
+template <std::size_t N>
+class PlannedBenchInputPinGroup final : public cmspk::iopins::PortInputPinGroup<N> {
+  public:
+    PlannedBenchInputPinGroup(std::array<uint8_t, N> ids, const uint32_t* port) : cmspk::iopins::PortInputPinGroup<N>(ids), port(port) {}
+
+  private:
+    const uint32_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<uint32_t, IoFailureReason> doReadPort() noexcept { return *port; }
+};
+// ================[END specializations]==================
+
+static constexpr std::array<uint8_t, 8> CONTIGUOUS_OCTET{8, 9, 10, 11, 12, 13, 14, 15};
+static constexpr std::array<uint8_t, 8> SCATTERED_OCTET{0, 1, 2, 5, 6, 12, 13, 31};
+static constexpr std::array<uint8_t, 8> SHUFFLED_OCTET{31, 4, 5, 6, 17, 0, 1, 9};
+
+template <typename Group>
+static void measureGroupRead(bench::State& state, const std::array<uint8_t, 8>& ids) {
+    uint32_t port = 0xa5a5a5a5u;
+    Group group(ids, &port);
+    cmspk::iopins::InputPinOctet* g = bench::opaque<cmspk::iopins::InputPinOctet>(&group);
+    state.measure([&] {
+        port = port * 1664525u + 1013904223u;
+        bench::doNotOptimize(g->read());
+    });
+}
+
+Bench(PortInputPinGroup, bit_by_bit_contiguous_8) { measureGroupRead<BitByBitBenchInputPinGroup<8>>(state, CONTIGUOUS_OCTET); }
+
+Bench(PortInputPinGroup, planned_contiguous_8) { measureGroupRead<PlannedBenchInputPinGroup<8>>(state, CONTIGUOUS_OCTET); }
+
+Bench(PortInputPinGroup, bit_by_bit_scattered_8) { measureGroupRead<BitByBitBenchInputPinGroup<8>>(state, SCATTERED_OCTET); }
+
+Bench(PortInputPinGroup, planned_scattered_8) { measureGroupRead<PlannedBenchInputPinGroup<8>>(state, SCATTERED_OCTET); }
+
+Bench(PortInputPinGroup, bit_by_bit_shuffled_8) { measureGroupRead<BitByBitBenchInputPinGroup<8>>(state, SHUFFLED_OCTET); }
+
+Bench(PortInputPinGroup, planned_shuffled_8) { measureGroupRead<PlannedBenchInputPinGroup<8>>(state, SHUFFLED_OCTET); }
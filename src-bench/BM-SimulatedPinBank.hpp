@@ -0,0 +1,47 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Simulate a whole board of 4096 pins (128 ports of 32 pins) : each port has an octet of inputs copied to an octet of
+// outputs by the "firmware" ; a call is a pass over the whole board.
+
+Bench(SimulatedPinBank, board_pass_4096_pins) {
+    constexpr std::size_t PORTS = 128;
+    cmspk::iopins::SimulatedPinBank bank(PORTS);
+    std::vector<cmspk::iopins::SimulatedInputPinGroup<8>> inputs;
+    std::vector<cmspk::iopins::SimulatedOutputPinGroup<8>> outputs;
+    inputs.reserve(PORTS);
+    outputs.reserve(PORTS);
+    for (std::size_t port = 0; port < PORTS; ++port) {
+        inputs.emplace_back(bank, port, std::array<uint8_t, 8>{0, 1, 2, 3, 4, 5, 6, 7});
+        outputs.emplace_back(bank, port, std::array<uint8_t, 8>{16, 17, 18, 19, 20, 21, 22, 23});
+        bank.setDirections(port, 0x00ff0000u, IoDirection::WRITE);
+        bank.drive(port, 0xffu, static_cast<uint32_t>(port));
+    }
+    state.measure(
+        [&] {
+            for (std::size_t port = 0; port < PORTS; ++port) {
+                std::expected<std::bitset<8>, IoFailureReason> value = inputs[port].read();
+                outputs[port].write(value.value_or(std::bitset<8>()));
+            }
+            bench::doNotOptimize(bank.now());
+        },
+        1u << 14);
+    state.setItemsPerCall(PORTS * 16);
+}
+
+Bench(SimulatedPinBank, single_pin_toggle) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    cmspk::iopins::SimulatedOutputPin pin(bank, 0, 12);
+    bank.setDirection(0, 12, IoDirection::WRITE);
+    BinaryOutputPin* p = bench::opaque<BinaryOutputPin>(&pin);
+    bool value = false;
+    state.measure([&] { bench::doNotOptimize(p->write(value = !value)); });
+    state.setItemsPerCall(1);
+}
@@ -0,0 +1,54 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Throughput of the bit-banged I2C master against a simulated target, in payload bytes per second ; each byte takes
+// 9 clock cycles on the bus, plus the addressing and the start/stop conditions of the transaction.
+
+static constexpr std::size_t I2C_BENCH_BYTES = 16;
+
+Bench(SoftI2cMaster, writeRegisters_16) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    cmspk::iopins::SimulatedI2cTarget target(bank, 0, 0, 1, 0x42);
+    cmspk::iopins::SimulatedOpenDrainPin scl(bank, 0, 0);
+    cmspk::iopins::SimulatedOpenDrainPin sda(bank, 0, 1);
+    cmspk::iopins::SoftI2cMaster i2c(scl, sda);
+    std::array<uint8_t, I2C_BENCH_BYTES> values{};
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<uint8_t>(i * 37);
+    }
+    state.measure([&] { bench::doNotOptimize(i2c.writeRegisters(0x42, 0x00, values)); }, 1u << 14);
+    state.setItemsPerCall(I2C_BENCH_BYTES);
+}
+
+Bench(SoftI2cMaster, readRegisters_16) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    cmspk::iopins::SimulatedI2cTarget target(bank, 0, 0, 1, 0x42);
+    cmspk::iopins::SimulatedOpenDrainPin scl(bank, 0, 0);
+    cmspk::iopins::SimulatedOpenDrainPin sda(bank, 0, 1);
+    cmspk::iopins::SoftI2cMaster i2c(scl, sda);
+    for (std::size_t i = 0; i < I2C_BENCH_BYTES; ++i) {
+        target.setRegister(static_cast<uint8_t>(i), static_cast<uint8_t>(i * 37));
+    }
+    std::array<uint8_t, I2C_BENCH_BYTES> values{};
+    state.measure([&] { bench::doNotOptimize(i2c.readRegisters(0x42, 0x00, values)); }, 1u << 14);
+    state.setItemsPerCall(I2C_BENCH_BYTES);
+}
+
+Bench(SoftI2cMaster, writeRegisters_16_stretched) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    cmspk::iopins::SimulatedI2cTarget target(bank, 0, 0, 1, 0x42);
+    cmspk::iopins::SimulatedOpenDrainPin scl(bank, 0, 0);
+    cmspk::iopins::SimulatedOpenDrainPin sda(bank, 0, 1);
+    cmspk::iopins::SoftI2cMaster i2c(scl, sda);
+    target.setClockStretching(8);
+    std::array<uint8_t, I2C_BENCH_BYTES> values{};
+    state.measure([&] { bench::doNotOptimize(i2c.writeRegisters(0x42, 0x00, values)); }, 1u << 14);
+    state.setItemsPerCall(I2C_BENCH_BYTES);
+}
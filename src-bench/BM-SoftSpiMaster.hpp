@@ -0,0 +1,87 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Throughput of the bit-banged SPI master against the simulated backend, in bits per second.
+
+static constexpr std::size_t SPI_BENCH_BYTES = 64;
+
+Bench(SoftSpiMaster, naive_separate_lines) {
+    // reference : every line written at each half period, as a straightforward bit-banging loop would do
+    cmspk::iopins::SimulatedPinBank bank(1);
+    bank.setDirections(0, 0b011u, IoDirection::WRITE);
+    cmspk::iopins::SimulatedOutputPin sck(bank, 0, 0);
+    cmspk::iopins::SimulatedOutputPin mosi(bank, 0, 1);
+    cmspk::iopins::SimulatedInputPin miso(bank, 0, 2);
+    std::array<uint8_t, SPI_BENCH_BYTES> out{};
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = static_cast<uint8_t>(i * 37);
+    }
+    state.measure(
+        [&] {
+            uint8_t received = 0;
+            for (uint8_t byte : out) {
+                for (int bit = 7; bit >= 0; --bit) {
+                    bench::doNotOptimize(mosi.write((byte >> bit) & 1u));
+                    bench::doNotOptimize(sck.write(true));
+                    received = static_cast<uint8_t>((received << 1) | miso.read().value_or(false));
+                    bench::doNotOptimize(sck.write(false));
+                }
+            }
+            bench::doNotOptimize(received);
+        },
+        1u << 12);
+    state.setItemsPerCall(SPI_BENCH_BYTES * 8);
+}
+
+Bench(SoftSpiMaster, separate_lines) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    bank.setDirections(0, 0b011u, IoDirection::WRITE);
+    cmspk::iopins::SimulatedOutputPin sck(bank, 0, 0);
+    cmspk::iopins::SimulatedOutputPin mosi(bank, 0, 1);
+    cmspk::iopins::SimulatedInputPin miso(bank, 0, 2);
+    cmspk::iopins::SoftSpiMaster<cmspk::iopins::SpiSeparateLines> spi(cmspk::iopins::SpiSeparateLines(sck, mosi, miso));
+    std::array<uint8_t, SPI_BENCH_BYTES> out{};
+    std::array<uint8_t, SPI_BENCH_BYTES> in{};
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = static_cast<uint8_t>(i * 37);
+    }
+    state.measure([&] { bench::doNotOptimize(spi.transfer(out, in)); }, 1u << 12);
+    state.setItemsPerCall(SPI_BENCH_BYTES * 8);
+}
+
+Bench(SoftSpiMaster, shared_port_lines) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    bank.setDirections(0, 0b011u, IoDirection::WRITE);
+    cmspk::iopins::SimulatedOutputPinGroup<2> sckMosi(bank, 0, {0, 1});
+    cmspk::iopins::SimulatedInputPin miso(bank, 0, 2);
+    cmspk::iopins::SoftSpiMaster<cmspk::iopins::SpiSharedPortLines> spi(cmspk::iopins::SpiSharedPortLines(sckMosi, miso));
+    std::array<uint8_t, SPI_BENCH_BYTES> out{};
+    std::array<uint8_t, SPI_BENCH_BYTES> in{};
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = static_cast<uint8_t>(i * 37);
+    }
+    state.measure([&] { bench::doNotOptimize(spi.transfer(out, in)); }, 1u << 12);
+    state.setItemsPerCall(SPI_BENCH_BYTES * 8);
+}
+
+Bench(SoftSpiMaster, shared_port_lines_32_bits_words) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    bank.setDirections(0, 0b011u, IoDirection::WRITE);
+    cmspk::iopins::SimulatedOutputPinGroup<2> sckMosi(bank, 0, {0, 1});
+    cmspk::iopins::SimulatedInputPin miso(bank, 0, 2);
+    cmspk::iopins::SoftSpiMaster<cmspk::iopins::SpiSharedPortLines> spi(cmspk::iopins::SpiSharedPortLines(sckMosi, miso));
+    std::array<uint32_t, SPI_BENCH_BYTES / 4> out{};
+    std::array<uint32_t, SPI_BENCH_BYTES / 4> in{};
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = static_cast<uint32_t>(i * 0x9e3779b9u);
+    }
+    state.measure([&] { bench::doNotOptimize(spi.transfer(out, in)); }, 1u << 12);
+    state.setItemsPerCall(SPI_BENCH_BYTES * 8);
+}
@@ -0,0 +1,95 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Stress the transfer of samples between a producer thread and a consumer thread through a `SpscRing`, reporting the
+// achieved samples per second.
+
+// ================[BEGIN specializations]==================
+class CountingBenchInputPinGroup final : public cmspk::iopins::InputPinGroup<32> {
+  public:
+    CountingBenchInputPinGroup() : cmspk::iopins::InputPinGroup<32>({}) {}
+
+  private:
+    uint32_t counter = 0;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<std::bitset<32>, IoFailureReason> doRead() noexcept { return std::bitset<32>(++counter); }
+};
+
+static uint32_t benchSamplerClock(void*) {
+    return static_cast<uint32_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+}
+// ================[END specializations]==================
+
+template <std::size_t ConsumerBatch>
+static void measureSamplerThroughput(bench::State& state) {
+    constexpr uint64_t SAMPLES = 1u << 22;
+    using Sample = cmspk::iopins::TimestampedSample<32>;
+    static cmspk::iopins::SpscRing<Sample, 1024> ring;
+    CountingBenchInputPinGroup source;
+    cmspk::iopins::InputPinGroupSampler<32, 1024> sampler(source, ring, benchSamplerClock);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::thread producer([&] {
+        uint64_t produced = 0;
+        while (produced < SAMPLES) {
+            std::expected<bool, IoFailureReason> pollResult = sampler.poll();
+            if (pollResult.has_value() && pollResult.value()) {
+                ++produced;
+            } else {
+                std::this_thread::yield();  // the ring is full
+            }
+        }
+    });
+    std::array<Sample, ConsumerBatch> batch;
+    uint64_t consumed = 0;
+    uint32_t checksum = 0;
+    while (consumed < SAMPLES) {
+        std::size_t count = ring.popBatch(batch);
+        if (0 == count) {
+            std::this_thread::yield();
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            checksum ^= static_cast<uint32_t>(batch[i].value.to_ulong());
+        }
+        consumed += count;
+    }
+    producer.join();
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    bench::doNotOptimize(checksum);
+    state.record(SAMPLES, std::chrono::duration<double, std::nano>(end - start).count());
+    state.setItemsPerCall(1);
+}
+
+Bench(SpscRing, sampler_to_consumer_pop_1) { measureSamplerThroughput<1>(state); }
+
+Bench(SpscRing, sampler_to_consumer_pop_batch_64) { measureSamplerThroughput<64>(state); }
+
+Bench(SpscRing, push_pop_same_thread) {
+    cmspk::iopins::SpscRing<uint32_t, 1024> ring;
+    uint32_t value = 0;
+    state.measure([&] {
+        ring.push(++value);
+        bench::doNotOptimize(ring.pop());
+    });
+    state.setItemsPerCall(1);
+}
+
+Bench(SpscRing, push_pop_batch_64_same_thread) {
+    cmspk::iopins::SpscRing<uint32_t, 1024> ring;
+    std::array<uint32_t, 64> batch{};
+    state.measure(
+        [&] {
+            ring.pushBatch(batch);
+            bench::doNotOptimize(ring.popBatch(batch));
+        },
+        1u << 18);
+    state.setItemsPerCall(64);
+}
@@ -0,0 +1,350 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// Compare the virtual pins with their static dispatch counterparts, both backed by a plain memory "register".
+
+// ================[BEGIN virtual specializations]==================
+class VirtualBenchInputPin final : public BinaryInputPin {
+  public:
+    VirtualBenchInputPin(uint8_t id, const uint32_t* port) : BinaryInputPin(id), port(port) {}
+
+  private:
+    const uint32_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<bool, IoFailureReason> doRead() noexcept { return ((*port) >> getPinId()) & 1u; }
+};
+
+class VirtualBenchOutputPin final : public BinaryOutputPin {
+  public:
+    VirtualBenchOutputPin(uint8_t id, uint32_t* port) : BinaryOutputPin(id), port(port) {}
+
+  private:
+    uint32_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<void, IoFailureReason> doWrite(const bool value) noexcept {
+        *port = ((*port) & ~(1u << getPinId())) | (static_cast<uint32_t>(value) << getPinId());
+        return std::expected<void, IoFailureReason>();
+    }
+};
+
+class VirtualBenchLogicInputPin final : public LogicInputPin {
+  public:
+    VirtualBenchLogicInputPin(uint8_t id, const uint32_t* port) : LogicInputPin(id, LogicIoPinSetting::ACTIVE_LOW), port(port) {}
+
+  private:
+    const uint32_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<bool, IoFailureReason> doRead() noexcept { return ((*port) >> getPinId()) & 1u; }
+};
+
+class VirtualBenchLogicOutputPin final : public LogicOutputPin {
+  public:
+    VirtualBenchLogicOutputPin(uint8_t id, uint32_t* port) : LogicOutputPin(id, LogicIoPinSetting::ACTIVE_LOW), port(port) {}
+
+  private:
+    uint32_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<void, IoFailureReason> doWrite(const bool value) noexcept {
+        *port = ((*port) & ~(1u << getPinId())) | (static_cast<uint32_t>(value) << getPinId());
+        return std::expected<void, IoFailureReason>();
+    }
+};
+
+class VirtualBenchInputPinOctet final : public cmspk::iopins::InputPinOctet {
+  public:
+    VirtualBenchInputPinOctet(const uint32_t* port) : cmspk::iopins::InputPinOctet({0, 1, 2, 3, 4, 5, 6, 7}), port(port) {}
+
+  private:
+    const uint32_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<std::bitset<8>, IoFailureReason> doRead() noexcept { return std::bitset<8>(*port); }
+};
+
+class VirtualBenchOutputPinOctet final : public cmspk::iopins::OutputPinOctet {
+  public:
+    VirtualBenchOutputPinOctet(uint32_t* port) : cmspk::iopins::OutputPinOctet({0, 1, 2, 3, 4, 5, 6, 7}), port(port) {}
+
+  private:
+    uint32_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<void, IoFailureReason> doWrite(const std::bitset<8> value) noexcept {
+        *port = value.to_ulong();
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[END virtual specializations]==================
+
+// ================[BEGIN static specializations]==================
+class StaticBenchInputPin final : public cmspk::iopins::StaticBinaryInputPin<StaticBenchInputPin> {
+    friend cmspk::iopins::StaticBinaryInputPin<StaticBenchInputPin>;
+
+  public:
+    StaticBenchInputPin(uint8_t id, const uint32_t* port) : cmspk::iopins::StaticBinaryInputPin<StaticBenchInputPin>(id), port(port) {}
+
+  private:
+    const uint32_t* port;
+
+    std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    std::expected<bool, IoFailureReason> doRead() noexcept { return ((*port) >> getPinId()) & 1u; }
+};
+
+class StaticBenchOutputPin final : public cmspk::iopins::StaticBinaryOutputPin<StaticBenchOutputPin> {
+    friend cmspk::iopins::StaticBinaryOutputPin<StaticBenchOutputPin>;
+
+  public:
+    StaticBenchOutputPin(uint8_t id, uint32_t* port) : cmspk::iopins::StaticBinaryOutputPin<StaticBenchOutputPin>(id), port(port) {}
+
+  private:
+    uint32_t* port;
+
+    std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    std::expected<void, IoFailureReason> doWrite(const bool value) noexcept {
+        *port = ((*port) & ~(1u << getPinId())) | (static_cast<uint32_t>(value) << getPinId());
+        return std::expected<void, IoFailureReason>();
+    }
+};
+
+class StaticBenchLogicInputPin final : public cmspk::iopins::StaticLogicInputPin<StaticBenchLogicInputPin> {
+    friend cmspk::iopins::StaticBinaryInputPin<StaticBenchLogicInputPin>;
+
+  public:
+    StaticBenchLogicInputPin(uint8_t id, const uint32_t* port)
+        : cmspk::iopins::StaticLogicInputPin<StaticBenchLogicInputPin>(id, LogicIoPinSetting::ACTIVE_LOW), port(port) {}
+
+  private:
+    const uint32_t* port;
+
+    std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    std::expected<bool, IoFailureReason> doRead() noexcept { return ((*port) >> getPinId()) & 1u; }
+};
+
+class StaticBenchLogicOutputPin final : public cmspk::iopins::StaticLogicOutputPin<StaticBenchLogicOutputPin> {
+    friend cmspk::iopins::StaticBinaryOutputPin<StaticBenchLogicOutputPin>;
+
+  public:
+    StaticBenchLogicOutputPin(uint8_t id, uint32_t* port)
+        : cmspk::iopins::StaticLogicOutputPin<StaticBenchLogicOutputPin>(id, LogicIoPinSetting::ACTIVE_LOW), port(port) {}
+
+  private:
+    uint32_t* port;
+
+    std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    std::expected<void, IoFailureReason> doWrite(const bool value) noexcept {
+        *port = ((*port) & ~(1u << getPinId())) | (static_cast<uint32_t>(value) << getPinId());
+        return std::expected<void, IoFailureReason>();
+    }
+};
+
+class StaticBenchInputPinOctet final : public cmspk::iopins::StaticInputPinOctet<StaticBenchInputPinOctet> {
+    friend cmspk::iopins::StaticInputPinGroup<StaticBenchInputPinOctet, 8>;
+
+  public:
+    StaticBenchInputPinOctet(const uint32_t* port) : cmspk::iopins::StaticInputPinOctet<StaticBenchInputPinOctet>({0, 1, 2, 3, 4, 5, 6, 7}), port(port) {}
+
+  private:
+    const uint32_t* port;
+
+    std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    std::expected<std::bitset<8>, IoFailureReason> doRead() noexcept { return std::bitset<8>(*port); }
+};
+
+class StaticBenchOutputPinOctet final : public cmspk::iopins::StaticOutputPinOctet<StaticBenchOutputPinOctet> {
+    friend cmspk::iopins::StaticOutputPinGroup<StaticBenchOutputPinOctet, 8>;
+
+  public:
+    StaticBenchOutputPinOctet(uint32_t* port) : cmspk::iopins::StaticOutputPinOctet<StaticBenchOutputPinOctet>({0, 1, 2, 3, 4, 5, 6, 7}), port(port) {}
+
+  private:
+    uint32_t* port;
+
+    std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    std::expected<void, IoFailureReason> doWrite(const std::bitset<8> value) noexcept {
+        *port = value.to_ulong();
+        return std::expected<void, IoFailureReason>();
+    }
+};
+
+// writes every sample to the port, like a memory mapped register
+class StaticBenchRegisterOctet final : public cmspk::iopins::StaticOutputPinOctet<StaticBenchRegisterOctet> {
+    friend cmspk::iopins::StaticOutputPinGroup<StaticBenchRegisterOctet, 8>;
+
+  public:
+    StaticBenchRegisterOctet(volatile uint32_t* port) : cmspk::iopins::StaticOutputPinOctet<StaticBenchRegisterOctet>({0, 1, 2, 3, 4, 5, 6, 7}), port(port) {}
+
+  private:
+    volatile uint32_t* port;
+
+    std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    std::expected<void, IoFailureReason> doWrite(const std::bitset<8> value) noexcept {
+        *port = value.to_ulong();
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[END static specializations]==================
+
+Bench(StaticDispatch, virtual_read) {
+    uint32_t port = 0x5a;
+    VirtualBenchInputPin pin(3, &port);
+    BinaryInputPin* p = bench::opaque<BinaryInputPin>(&pin);
+    state.measure([&] { bench::doNotOptimize(p->read()); });
+}
+
+Bench(StaticDispatch, static_read) {
+    uint32_t port = 0x5a;
+    StaticBenchInputPin pin(3, bench::opaque(&port));
+    state.measure([&] { bench::doNotOptimize(pin.read()); });
+}
+
+Bench(StaticDispatch, virtual_write) {
+    uint32_t port = 0;
+    VirtualBenchOutputPin pin(3, &port);
+    BinaryOutputPin* p = bench::opaque<BinaryOutputPin>(&pin);
+    bool value = false;
+    state.measure([&] { bench::doNotOptimize(p->write(value = !value)); });
+}
+
+Bench(StaticDispatch, static_write) {
+    uint32_t port = 0;
+    StaticBenchOutputPin pin(3, bench::opaque(&port));
+    bool value = false;
+    state.measure([&] { bench::doNotOptimize(pin.write(value = !value)); });
+}
+
+Bench(StaticDispatch, virtual_isAsserted) {
+    uint32_t port = 0x5a;
+    VirtualBenchLogicInputPin pin(3, &port);
+    LogicInputPin* p = bench::opaque<LogicInputPin>(&pin);
+    state.measure([&] { bench::doNotOptimize(p->isAsserted()); });
+}
+
+Bench(StaticDispatch, static_isAsserted) {
+    uint32_t port = 0x5a;
+    StaticBenchLogicInputPin pin(3, bench::opaque(&port));
+    state.measure([&] { bench::doNotOptimize(pin.isAsserted()); });
+}
+
+Bench(StaticDispatch, virtual_writeLogic) {
+    uint32_t port = 0;
+    VirtualBenchLogicOutputPin pin(3, &port);
+    LogicOutputPin* p = bench::opaque<LogicOutputPin>(&pin);
+    bool value = false;
+    state.measure([&] { bench::doNotOptimize(p->writeLogic(value = !value)); });
+}
+
+Bench(StaticDispatch, static_writeLogic) {
+    uint32_t port = 0;
+    StaticBenchLogicOutputPin pin(3, bench::opaque(&port));
+    bool value = false;
+    state.measure([&] { bench::doNotOptimize(pin.writeLogic(value = !value)); });
+}
+
+Bench(StaticDispatch, virtual_group_read_8) {
+    uint32_t port = 0x5a;
+    VirtualBenchInputPinOctet group(&port);
+    cmspk::iopins::InputPinOctet* g = bench::opaque<cmspk::iopins::InputPinOctet>(&group);
+    state.measure([&] { bench::doNotOptimize(g->read()); });
+}
+
+Bench(StaticDispatch, static_group_read_8) {
+    uint32_t port = 0x5a;
+    StaticBenchInputPinOctet group(bench::opaque(&port));
+    state.measure([&] { bench::doNotOptimize(group.read()); });
+}
+
+Bench(StaticDispatch, virtual_group_write_8) {
+    uint32_t port = 0;
+    VirtualBenchOutputPinOctet group(&port);
+    cmspk::iopins::OutputPinOctet* g = bench::opaque<cmspk::iopins::OutputPinOctet>(&group);
+    uint8_t value = 0;
+    state.measure([&] { bench::doNotOptimize(g->write(++value)); });
+}
+
+Bench(StaticDispatch, static_group_write_8) {
+    uint32_t port = 0;
+    StaticBenchOutputPinOctet group(bench::opaque(&port));
+    uint8_t value = 0;
+    state.measure([&] { bench::doNotOptimize(group.write(++value)); });
+}
+
+Bench(StaticDispatch, static_reader_readRaw) {
+    uint32_t port = 0x5a;
+    StaticBenchInputPin pin(3, bench::opaque(&port));
+    StaticBenchInputPin::Reader reader = pin.acquireReader().value();
+    state.measure([&] { bench::doNotOptimize(reader.readRaw()); });
+}
+
+Bench(StaticDispatch, static_writer_writeRaw) {
+    uint32_t port = 0;
+    StaticBenchOutputPin pin(3, bench::opaque(&port));
+    StaticBenchOutputPin::Writer writer = pin.acquireWriter().value();
+    bool value = false;
+    state.measure([&] {
+        writer.writeRaw(value = !value);
+        bench::doNotOptimize(port);
+    });
+}
+
+Bench(StaticDispatch, static_logic_reader_readLogicRaw) {
+    uint32_t port = 0x5a;
+    StaticBenchLogicInputPin pin(3, bench::opaque(&port));
+    StaticBenchLogicInputPin::LogicReader reader = pin.acquireLogicReader().value();
+    state.measure([&] { bench::doNotOptimize(reader.readLogicRaw()); });
+}
+
+Bench(StaticDispatch, static_group_reader_readRaw_8) {
+    uint32_t port = 0x5a;
+    StaticBenchInputPinOctet group(bench::opaque(&port));
+    StaticBenchInputPinOctet::Reader reader = group.acquireReader().value();
+    state.measure([&] { bench::doNotOptimize(reader.readRaw()); });
+}
+
+static constexpr std::size_t STATIC_BENCH_BURST = 256;
+
+Bench(StaticDispatch, virtual_group_writeSequence_8) {
+    uint32_t port = 0;
+    VirtualBenchOutputPinOctet group(&port);
+    cmspk::iopins::OutputPinOctet* g = bench::opaque<cmspk::iopins::OutputPinOctet>(&group);
+    std::array<std::bitset<8>, STATIC_BENCH_BURST> values;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = std::bitset<8>(i);
+    }
+    state.measure([&] { bench::doNotOptimize(g->writeSequence(values)); }, 1u << 14);
+    state.setItemsPerCall(STATIC_BENCH_BURST);
+}
+
+Bench(StaticDispatch, static_group_writeSequence_8) {
+    volatile uint32_t port = 0;
+    StaticBenchRegisterOctet group(&port);
+    std::array<std::bitset<8>, STATIC_BENCH_BURST> values;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = std::bitset<8>(i);
+    }
+    state.measure([&] { bench::doNotOptimize(group.writeSequence(values)); }, 1u << 14);
+    state.setItemsPerCall(STATIC_BENCH_BURST);
+}
+
+Bench(StaticDispatch, static_group_readSamples_8) {
+    uint32_t port = 0x5a;
+    StaticBenchInputPinOctet group(bench::opaque(&port));
+    std::array<std::bitset<8>, STATIC_BENCH_BURST> samples;
+    state.measure(
+        [&] {
+            bench::doNotOptimize(group.readSamples(samples));
+            bench::doNotOptimize(samples);
+        },
+        1u << 14);
+    state.setItemsPerCall(STATIC_BENCH_BURST);
+}
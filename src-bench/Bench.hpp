@@ -0,0 +1,154 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#ifndef CMSPK__IOPINS__BENCH__HPP
+#define CMSPK__IOPINS__BENCH__HPP
+
+// standard includes
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ================[ CODE BEGINS ]================
+/**
+ * Minimal benchmark harness, the benchmarks are declared with `Bench(suite, name)` and perform their measurements
+ * through the given `bench::State`.
+ */
+namespace bench {
+/**
+ * Prevent the compiler from optimizing away the computation of the given value.
+ */
+template <typename T>
+inline void doNotOptimize(T const& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * Hide the value of the given pointer from the compiler, typically to prevent devirtualization of calls.
+ */
+template <typename T>
+inline T* opaque(T* pointer) {
+    asm volatile("" : "+r"(pointer));
+    return pointer;
+}
+
+/**
+ * Outcome of a benchmark.
+ */
+struct Result {
+    const char* suite;
+    const char* name;
+    uint64_t iterations;
+    double nsPerCall;
+    /**
+     * Number of processed items (bits, samples,...) per call, to compute a throughput ; 0 when not relevant.
+     */
+    double itemsPerCall;
+};
+
+/**
+ * Measurement context given to each benchmark.
+ */
+class State {
+  public:
+    /**
+     * Repeatedly call the given operation and record the average duration of a call.
+     *
+     * @param operation the operation to measure.
+     * @param iterations the number of calls to perform.
+     */
+    template <typename Operation>
+    void measure(Operation&& operation, uint64_t iterations = DEFAULT_ITERATIONS) {
+        for (uint64_t i = 0; i < iterations / 16; ++i) {
+            operation();
+        }
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < iterations; ++i) {
+            operation();
+        }
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        result.iterations = iterations;
+        result.nsPerCall = std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(iterations);
+    }
+
+    /**
+     * Record a measurement performed by the benchmark itself, e.g. involving several threads.
+     *
+     * @param iterations the number of performed calls.
+     * @param nanoseconds the total duration of the calls.
+     */
+    void record(uint64_t iterations, double nanoseconds) noexcept {
+        result.iterations = iterations;
+        result.nsPerCall = nanoseconds / static_cast<double>(iterations);
+    }
+
+    /**
+     * Declare how many items are processed by each call, to report a throughput.
+     */
+    void setItemsPerCall(double items) noexcept { result.itemsPerCall = items; }
+
+    Result result{};
+    static constexpr uint64_t DEFAULT_ITERATIONS = 1u << 22;
+};
+
+using BenchFunction = void (*)(State&);
+
+struct Registration {
+    const char* suite;
+    const char* name;
+    BenchFunction function;
+};
+
+inline std::vector<Registration>& registry() {
+    static std::vector<Registration> registrations;
+    return registrations;
+}
+
+struct Registrar {
+    Registrar(const char* suite, const char* name, BenchFunction function) { registry().push_back({suite, name, function}); }
+};
+
+/**
+ * Memory footprint of a type, reported along the measurements.
+ */
+struct SizeRecord {
+    const char* type;
+    std::size_t size;
+    std::size_t alignment;
+};
+
+inline std::vector<SizeRecord>& sizeRegistry() {
+    static std::vector<SizeRecord> records;
+    return records;
+}
+
+struct SizeRegistrar {
+    SizeRegistrar(const char* type, std::size_t size, std::size_t alignment) { sizeRegistry().push_back({type, size, alignment}); }
+};
+};  // namespace bench
+
+/**
+ * Declare a benchmark, the body has access to the `bench::State& state`.
+ */
+#define Bench(suite, name)                                                                 \
+    static void bench_##suite##_##name(bench::State& state);                               \
+    static bench::Registrar bench_registrar_##suite##_##name(#suite, #name, bench_##suite##_##name); \
+    static void bench_##suite##_##name(bench::State& state)
+
+#define BENCH_CONCAT_IMPL(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_IMPL(a, b)
+
+/**
+ * Record the size of the given type, that may be a template instance with several arguments.
+ */
+#define BenchSizeOf(...) \
+    static bench::SizeRegistrar BENCH_CONCAT(bench_size_registrar_, __COUNTER__)(#__VA_ARGS__, sizeof(__VA_ARGS__), alignof(__VA_ARGS__))
+// ================[ END OF CODE ]================
+#endif
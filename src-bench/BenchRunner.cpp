@@ -0,0 +1,156 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "Bench.hpp"
+#include "cmspk/iopins.hpp"
+#include "cmspk/iopins/sim.hpp"
+
+using cmspk::iopins::BinaryInputPin;
+using cmspk::iopins::BinaryOutputPin;
+using cmspk::iopins::IoDirection;
+using cmspk::iopins::IoFailureReason;
+using cmspk::iopins::LogicInputPin;
+using cmspk::iopins::LogicIoPinSetting;
+using cmspk::iopins::LogicOutputPin;
+
+#include "BM-AnalogFilters.hpp"
+#include "BM-BcmScheduler.hpp"
+#include "BM-BitsetWords.hpp"
+#include "BM-BoardPinMap.hpp"
+#include "BM-BurstStreaming.hpp"
+#include "BM-CalibrationTables.hpp"
+#include "BM-ChangeNotifyingInputPin.hpp"
+#include "BM-Debouncing.hpp"
+#include "BM-EdgeTracker.hpp"
+#include "BM-IoPinGroup.hpp"
+#include "BM-LogicPinGroup.hpp"
+#include "BM-MatrixScanner.hpp"
+#include "BM-MultiPortPinGroup.hpp"
+#include "BM-ObjectSizes.hpp"
+#include "BM-OutputTransaction.hpp"
+#include "BM-ParallelBusWriter.hpp"
+#include "BM-PinApi.hpp"
+#include "BM-PinInstrumentation.hpp"
+#include "BM-PortExpander.hpp"
+#include "BM-PortInputPinGroup.hpp"
+#include "BM-SimulatedPinBank.hpp"
+#include "BM-SoftI2cMaster.hpp"
+#include "BM-SoftSpiMaster.hpp"
+#include "BM-SpscRing.hpp"
+#include "BM-StaticDispatch.hpp"
+
+/**
+ * Write the given string as a JSON string literal.
+ */
+static void writeJsonString(std::FILE* out, const char* value) {
+    std::fputc('"', out);
+    for (const char* c = value; *c != '\0'; ++c) {
+        if ('"' == *c || '\\' == *c) {
+            std::fputc('\\', out);
+        }
+        std::fputc(*c, out);
+    }
+    std::fputc('"', out);
+}
+
+/**
+ * Write the results and the recorded sizes as a JSON document, to be compared between releases.
+ */
+static void writeJson(std::FILE* out, const std::vector<bench::Result>& results) {
+    std::fprintf(out, "{\n  \"context\": {\"compiler\": ");
+    writeJsonString(out, __VERSION__);
+    std::fprintf(out, ", \"cplusplus\": %ld, \"pointer_size\": %zu},\n", static_cast<long>(__cplusplus), sizeof(void*));
+    std::fprintf(out, "  \"benchmarks\": [");
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const bench::Result& result = results[i];
+        std::fprintf(out, "%s\n    {\"suite\": ", (i > 0) ? "," : "");
+        writeJsonString(out, result.suite);
+        std::fprintf(out, ", \"name\": ");
+        writeJsonString(out, result.name);
+        std::fprintf(out, ", \"iterations\": %llu, \"ns_per_call\": %.3f", static_cast<unsigned long long>(result.iterations), result.nsPerCall);
+        if (result.itemsPerCall > 0) {
+            std::fprintf(out, ", \"items_per_call\": %.0f, \"items_per_second\": %.0f", result.itemsPerCall, result.itemsPerCall * 1e9 / result.nsPerCall);
+        }
+        std::fprintf(out, "}");
+    }
+    std::fprintf(out, "\n  ],\n  \"sizes\": [");
+    const std::vector<bench::SizeRecord>& sizes = bench::sizeRegistry();
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        std::fprintf(out, "%s\n    {\"type\": ", (i > 0) ? "," : "");
+        writeJsonString(out, sizes[i].type);
+        std::fprintf(out, ", \"size\": %zu, \"alignment\": %zu}", sizes[i].size, sizes[i].alignment);
+    }
+    std::fprintf(out, "\n  ]\n}\n");
+}
+
+/**
+ * Run the benchmarks whose `suite::name` contains the optionnal filter, then report the results and the sizes of the
+ * pin types.
+ *
+ * Usage : `io_pins--bench [filter] [--json <file>]`, the JSON report is written to the standard output when `<file>` is
+ * `-`.
+ */
+int main(int argc, char** argv) {
+    const char* filter = "";
+    const char* jsonPath = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (0 == std::strcmp(argv[i], "--json") && i + 1 < argc) {
+            jsonPath = argv[++i];
+        } else {
+            filter = argv[i];
+        }
+    }
+    // with the JSON report on the standard output, the human readable report goes to the error output
+    std::FILE* text = (nullptr != jsonPath && 0 == std::strcmp(jsonPath, "-")) ? stderr : stdout;
+
+    std::vector<bench::Result> results;
+    char fullName[256];
+    std::fprintf(text, "%-64s %14s %16s\n", "benchmark", "ns/call", "items/s");
+    for (const bench::Registration& registration : bench::registry()) {
+        std::snprintf(fullName, sizeof(fullName), "%s::%s", registration.suite, registration.name);
+        if (nullptr == std::strstr(fullName, filter)) {
+            continue;
+        }
+        bench::State state;
+        state.result.suite = registration.suite;
+        state.result.name = registration.name;
+        registration.function(state);
+        results.push_back(state.result);
+        if (state.result.itemsPerCall > 0) {
+            std::fprintf(text, "%-64s %14.3f %16.0f\n", fullName, state.result.nsPerCall, state.result.itemsPerCall * 1e9 / state.result.nsPerCall);
+        } else {
+            std::fprintf(text, "%-64s %14.3f %16s\n", fullName, state.result.nsPerCall, "-");
+        }
+    }
+    std::fprintf(text, "\n%-64s %8s %8s\n", "type", "size", "align");
+    for (const bench::SizeRecord& record : bench::sizeRegistry()) {
+        std::fprintf(text, "%-64s %8zu %8zu\n", record.type, record.size, record.alignment);
+    }
+
+    if (nullptr != jsonPath) {
+        std::FILE* out = (0 == std::strcmp(jsonPath, "-")) ? stdout : std::fopen(jsonPath, "w");
+        if (nullptr == out) {
+            std::fprintf(stderr, "cannot write the JSON report to '%s'\n", jsonPath);
+            return 1;
+        }
+        writeJson(out, results);
+        if (stdout != out) {
+            std::fclose(out);
+        }
+    }
+    return 0;
+}
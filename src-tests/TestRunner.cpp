@@ -11,9 +11,12 @@ A C++ abstraction layer for I/O pins of micro-controllers..
 #include <criterion/internal/assert.h>
 
 #include <cstdint>
+#include <thread>
+#include <vector>
 // FIXME includes your hpp files from ../include
 // e.g. #include "whatever.hpp"
 #include "cmspk/iopins.hpp"
+#include "cmspk/iopins/sim.hpp"
 
 using cmspk::iopins::BinaryInputPin;
 using cmspk::iopins::BinaryOutputPin;
@@ -28,9 +31,53 @@ struct BoolValue {
     bool value;
 };
 
+#include "UT-AnalogFilters.hpp"
+#include "UT-BcmScheduler.hpp"
+#include "UT-BitGatherPlan.hpp"
+#include "UT-BitsetWords.hpp"
+#include "UT-BoardPinMap.hpp"
+#include "UT-CalibratedPins.hpp"
+#include "UT-CalibrationTables.hpp"
+#include "UT-ChangeNotifyingInputPin.hpp"
+#include "UT-DebouncedInputPinGroup.hpp"
+#include "UT-DebouncedLogicInputPin.hpp"
+#include "UT-EdgeDispatcher.hpp"
+#include "UT-EdgeTracker.hpp"
+#include "UT-ExpanderPins.hpp"
+#include "UT-FilteredInputPin.hpp"
 #include "UT-InputPin.hpp"
 #include "UT-InputPinGroup.hpp"
+#include "UT-InputPinGroupSampler.hpp"
+#include "UT-IoPin.hpp"
+#include "UT-IoPinGroup.hpp"
 #include "UT-LogicInputPin.hpp"
+#include "UT-LogicInputPinGroup.hpp"
 #include "UT-LogicOutputPin.hpp"
+#include "UT-LogicOutputPinGroup.hpp"
+#include "UT-MatrixScanner.hpp"
+#include "UT-MultiPortInputPinGroup.hpp"
+#include "UT-MultiPortOutputPinGroup.hpp"
+#include "UT-OpenDrainPin.hpp"
 #include "UT-OutputPin.hpp"
 #include "UT-OutputPinGroup.hpp"
+#include "UT-OutputTransaction.hpp"
+#include "UT-ParallelBusWriter.hpp"
+#include "UT-PinInstrumentation.hpp"
+#include "UT-PortExpander.hpp"
+#include "UT-PortInputPinGroup.hpp"
+#include "UT-PortOutputPins.hpp"
+#include "UT-SetBitRange.hpp"
+#include "UT-ShadowedOutputPinGroup.hpp"
+#include "UT-SimulatedI2cTarget.hpp"
+#include "UT-SimulatedPinBank.hpp"
+#include "UT-SimulatedPins.hpp"
+#include "UT-SoftI2cMaster.hpp"
+#include "UT-SoftSpiMaster.hpp"
+#include "UT-SpscRing.hpp"
+#include "UT-StaticInputPin.hpp"
+#include "UT-StaticInputPinGroup.hpp"
+#include "UT-StaticLogicInputPin.hpp"
+#include "UT-StaticLogicOutputPin.hpp"
+#include "UT-StaticOutputPin.hpp"
+#include "UT-StaticOutputPinGroup.hpp"
+#include "UT-VerticalCounterDebouncer.hpp"
@@ -0,0 +1,131 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+// pseudo random samples over the whole range, with long runs and spikes
+static std::vector<uint16_t> makeAnalogTestSamples(std::size_t count) {
+    std::vector<uint16_t> samples(count);
+    uint32_t seed = 12345;
+    for (std::size_t i = 0; i < count; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        samples[i] = static_cast<uint16_t>(seed >> 16);
+    }
+    return samples;
+}
+
+// compare the buffer path, fed in uneven chunks, to the sample by sample path
+template <typename Filter>
+static bool filtersAgree(const std::vector<uint16_t>& samples) {
+    Filter bulk;
+    Filter single;
+    std::vector<uint16_t> output(samples.size());
+    std::size_t offset = 0;
+    std::size_t chunk = 1;
+    while (offset < samples.size()) {
+        std::size_t size = std::min(chunk, samples.size() - offset);
+        bulk.filter(std::span<const uint16_t>(samples.data() + offset, size), std::span<uint16_t>(output.data() + offset, size));
+        offset += size;
+        chunk = chunk * 3 + 1;
+    }
+    bool same = true;
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        same = same && output[i] == single.push(samples[i]);
+    }
+    return same;
+}
+// ================[END typical specialization]==================
+
+Test(AnalogFilters, decimate_sums_whole_blocks) {
+    std::vector<uint16_t> samples = makeAnalogTestSamples(100);
+    std::array<uint16_t, 8> output{};
+
+    // 16 samples per output, shifted to the mean
+    cr_assert_eq((cmspk::iopins::decimate<uint16_t>(samples, output, 16, 4)), 6u);
+    for (std::size_t o = 0; o < 6; ++o) {
+        uint32_t sum = 0;
+        for (std::size_t i = 0; i < 16; ++i) {
+            sum += samples[o * 16 + i];
+        }
+        cr_assert_eq(output[o], sum >> 4);
+    }
+
+    // 4 samples per output, 1 more bit, limited by the output
+    std::array<uint16_t, 3> small{};
+    const std::array<uint16_t, 16> ramp{100, 200, 300, 400, 1, 1, 1, 1, 0, 0, 0, 0, 9, 9, 9, 9};
+    cr_assert_eq((cmspk::iopins::decimate<uint16_t>(ramp, small, 4, 1)), 3u);
+    cr_assert_eq(small[0], 500);
+    cr_assert_eq(small[1], 2);
+    cr_assert_eq(small[2], 0);
+
+    // wider samples
+    const std::array<uint32_t, 4> wide{0xffffffffu, 0xffffffffu, 1, 3};
+    std::array<uint32_t, 2> wideOutput{};
+    cr_assert_eq((cmspk::iopins::decimate<uint32_t>(wide, wideOutput, 2, 1)), 2u);
+    cr_assert_eq(wideOutput[0], 0xffffffffu);
+    cr_assert_eq(wideOutput[1], 2u);
+}
+
+Test(AnalogFilters, moving_average_ramps_up_then_averages) {
+    cmspk::iopins::MovingAverage<uint16_t, 4> average;
+    cr_assert_eq(average.push(400), 100);
+    cr_assert_eq(average.push(400), 200);
+    cr_assert_eq(average.push(400), 300);
+    cr_assert_eq(average.push(400), 400);
+    cr_assert_eq(average.push(0), 300);
+    cr_assert_eq(average.push(65535), 16383 + 200);
+
+    std::vector<uint16_t> samples = makeAnalogTestSamples(5000);
+    cr_assert((filtersAgree<cmspk::iopins::MovingAverage<uint16_t, 1>>(samples)));
+    cr_assert((filtersAgree<cmspk::iopins::MovingAverage<uint16_t, 4>>(samples)));
+    cr_assert((filtersAgree<cmspk::iopins::MovingAverage<uint16_t, 64>>(samples)));
+}
+
+Test(AnalogFilters, median_removes_spikes) {
+    cmspk::iopins::MedianFilter<uint16_t, 3> median;
+    median.push(10);
+    median.push(10);
+    cr_assert_eq(median.push(60000), 10);
+    cr_assert_eq(median.push(11), 11);
+    cr_assert_eq(median.push(12), 12);
+
+    std::vector<uint16_t> samples = makeAnalogTestSamples(5000);
+    cr_assert((filtersAgree<cmspk::iopins::MedianFilter<uint16_t, 3>>(samples)));
+    cr_assert((filtersAgree<cmspk::iopins::MedianFilter<uint16_t, 5>>(samples)));
+    cr_assert((filtersAgree<cmspk::iopins::MedianFilter<uint16_t, 7>>(samples)));
+
+    // the medians of the buffer path are the true medians
+    cmspk::iopins::MedianFilter<uint16_t, 5> five;
+    std::vector<uint16_t> output(samples.size());
+    five.filter(samples, output);
+    bool exact = true;
+    for (std::size_t i = 4; i < samples.size(); ++i) {
+        std::array<uint16_t, 5> window{samples[i - 4], samples[i - 3], samples[i - 2], samples[i - 1], samples[i]};
+        std::sort(window.begin(), window.end());
+        exact = exact && output[i] == window[2];
+    }
+    cr_assert(exact);
+}
+
+Test(AnalogFilters, iir_converges_to_a_step) {
+    cmspk::iopins::IirFilter<uint16_t, 2> smooth;
+    cr_assert_eq(smooth.push(4000), 1000);
+    cr_assert_eq(smooth.push(4000), 1750);
+    uint16_t value = 0;
+    for (int i = 0; i < 100; ++i) {
+        value = smooth.push(4000);
+    }
+    cr_assert_eq(value, 4000);
+
+    cmspk::iopins::IirFilter<uint32_t, 8> wide(0xffffffffu);
+    cr_assert_eq(wide.push(0xffffffffu), 0xffffffffu);
+
+    std::vector<uint16_t> samples = makeAnalogTestSamples(1000);
+    cr_assert((filtersAgree<cmspk::iopins::IirFilter<uint16_t, 3>>(samples)));
+}
@@ -0,0 +1,117 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+template <std::size_t N>
+class RecordingOutputPinGroup final : public cmspk::iopins::OutputPinGroup<N> {
+  public:
+    ~RecordingOutputPinGroup() {}
+    RecordingOutputPinGroup() : cmspk::iopins::OutputPinGroup<N>({}) {}
+    std::bitset<N> value;
+    int writes = 0;
+    bool failing = false;
+
+  private:
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept {
+        if (failing) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+    virtual std::expected<void, IoFailureReason> doWrite(const std::bitset<N> v) noexcept {
+        ++writes;
+        value = v;
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[END typical specialization]==================
+
+Test(BcmScheduler, frames_are_the_bit_planes_of_the_duty_cycles) {
+    RecordingOutputPinGroup<3> group;
+    cmspk::iopins::BcmScheduler<3, 4> scheduler(group);
+    cr_assert_eq(scheduler.MAX_DUTY, 15);
+    scheduler.setDuty(0, 0b0101);
+    scheduler.setDuty(1, 0b1100);
+    scheduler.setDuty(2, 0xff);
+    cr_assert_eq(scheduler.getDuty(2), 15);
+    cr_assert_eq(scheduler.getFrame(0).to_ulong(), 0b101u);
+    cr_assert_eq(scheduler.getFrame(1).to_ulong(), 0b100u);
+    cr_assert_eq(scheduler.getFrame(2).to_ulong(), 0b111u);
+    cr_assert_eq(scheduler.getFrame(3).to_ulong(), 0b110u);
+
+    // changing a duty cycle flips the bits of the changing planes only
+    scheduler.setDuty(1, 0b0110);
+    cr_assert_eq(scheduler.getFrame(0).to_ulong(), 0b101u);
+    cr_assert_eq(scheduler.getFrame(1).to_ulong(), 0b110u);
+    cr_assert_eq(scheduler.getFrame(2).to_ulong(), 0b111u);
+    cr_assert_eq(scheduler.getFrame(3).to_ulong(), 0b100u);
+}
+
+Test(BcmScheduler, a_period_outputs_each_channel_for_its_duty_cycle) {
+    RecordingOutputPinGroup<4> group;
+    cmspk::iopins::BcmScheduler<4, 8> scheduler(group);
+    const std::array<uint8_t, 4> duties{0, 1, 128, 255};
+    for (std::size_t i = 0; i < duties.size(); ++i) {
+        scheduler.setDuty(i, duties[i]);
+    }
+    std::array<uint32_t, 4> onTicks{};
+    for (uint32_t t = 0; t < scheduler.PERIOD_TICKS; ++t) {
+        cr_assert(scheduler.tick().has_value());
+        for (std::size_t i = 0; i < duties.size(); ++i) {
+            onTicks[i] += group.value[i];
+        }
+    }
+    for (std::size_t i = 0; i < duties.size(); ++i) {
+        cr_assert_eq(onTicks[i], duties[i]);
+    }
+    // one write per slot
+    cr_assert_eq(group.writes, 8);
+    cr_assert_eq(scheduler.getSlot(), 7u);
+}
+
+Test(BcmScheduler, slots_last_a_power_of_two_ticks) {
+    RecordingOutputPinGroup<2> group;
+    cmspk::iopins::BcmScheduler<2, 3> scheduler(group);
+    for (uint32_t expected : {1u, 2u, 4u, 1u}) {
+        auto duration = scheduler.nextSlot();
+        cr_assert(duration.has_value());
+        cr_assert_eq(duration.value(), expected);
+    }
+
+    group.failing = true;
+    auto duration = scheduler.nextSlot();
+    cr_assert_not(duration.has_value());
+    cr_assert_eq(duration.error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+
+    // a failed write does not skip the slot
+    cr_assert_eq(scheduler.getSlot(), 0u);
+    cr_assert_not(scheduler.tick().has_value());
+    cr_assert_eq(scheduler.getSlot(), 0u);
+    group.failing = false;
+    cr_assert(scheduler.tick().has_value());
+    cr_assert_eq(scheduler.getSlot(), 1u);
+    cr_assert(scheduler.tick().has_value());
+    cr_assert_eq(scheduler.getSlot(), 1u);
+}
+
+Test(BcmScheduler, output_pins_drive_the_channels) {
+    RecordingOutputPinGroup<2> group;
+    cmspk::iopins::BcmScheduler<2> scheduler(group);
+    cmspk::iopins::BcmOutputPin<2> led(scheduler, 1);
+    cmspk::iopins::AnalogOutputPin8& pin = led;
+    cr_assert(pin.write(200).has_value());
+    cr_assert_eq(scheduler.getDuty(1), 200);
+    cr_assert_eq(scheduler.getDuty(0), 0);
+
+    cmspk::iopins::BcmOutputPin<2> outOfRange(scheduler, 2);
+    auto result = outOfRange.write(1);
+    cr_assert_not(result.has_value());
+    cr_assert_eq(result.error(), IoFailureReason::FAILURE_PIN_IS_DISABLED);
+}
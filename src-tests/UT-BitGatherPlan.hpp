@@ -0,0 +1,65 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// gather bit by bit, as a reference
+template <std::size_t N>
+uint32_t naiveGather(const std::array<uint8_t, N>& ids, uint32_t word) {
+    uint32_t result = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        result |= ((word >> ids[i]) & 1u) << i;
+    }
+    return result;
+}
+
+Test(BitGatherPlan, adjacent_bits_are_collapsed_into_one_step) {
+    constexpr cmspk::iopins::BitGatherPlan<8> contiguous({4, 5, 6, 7, 8, 9, 10, 11});
+    static_assert(contiguous.getStepCount() == 1);
+    static_assert(contiguous.getMask() == 0xff0);
+    static_assert(contiguous.gather(0xa50) == 0xa5);
+
+    // two runs
+    cmspk::iopins::BitGatherPlan<4> twoRuns({0, 1, 12, 13});
+    cr_assert_eq(twoRuns.getStepCount(), 2);
+    cr_assert(twoRuns.isIncreasing());
+    cr_assert_eq(twoRuns.getMask(), 0x3003u);
+    cr_assert_eq(twoRuns.gather(0x2001), 0b1001u);
+
+    // runs with the same distance share a step
+    cmspk::iopins::BitGatherPlan<4> sameDistance({3, 4, 6, 7});
+    cr_assert_eq(sameDistance.getStepCount(), 2);
+}
+
+Test(BitGatherPlan, pins_beyond_the_word_are_left_out_at_runtime) {
+    std::array<uint8_t, 3> ids{0, 1, 2};
+    ids[1] = 32;
+    cmspk::iopins::BitGatherPlan<3> plan(ids);
+    cr_assert_not(plan.isIncreasing());
+    cr_assert_eq(plan.getMask(), 0x5u);
+    cr_assert_eq(plan.gather(0xffffffffu), 0b101u);
+    cr_assert_eq(plan.scatter(0b111u), 0x5u);
+}
+
+Test(BitGatherPlan, gather_matches_bit_by_bit_reference_and_scatter_is_its_inverse) {
+    const std::array<uint8_t, 6> increasing{0, 2, 3, 9, 30, 31};
+    const std::array<uint8_t, 6> shuffled{31, 2, 0, 9, 3, 30};
+    cmspk::iopins::BitGatherPlan<6> increasingPlan(increasing);
+    cmspk::iopins::BitGatherPlan<6> shuffledPlan(shuffled);
+    cr_assert(increasingPlan.isIncreasing());
+    cr_assert_not(shuffledPlan.isIncreasing());
+
+    uint32_t word = 0x12345678u;
+    for (int i = 0; i < 64; ++i) {
+        cr_assert_eq(increasingPlan.gather(word), naiveGather(increasing, word));
+        cr_assert_eq(shuffledPlan.gather(word), naiveGather(shuffled, word));
+        cr_assert_eq(increasingPlan.scatter(increasingPlan.gather(word)), word & increasingPlan.getMask());
+        cr_assert_eq(shuffledPlan.scatter(shuffledPlan.gather(word)), word & shuffledPlan.getMask());
+        word = word * 1664525u + 1013904223u;
+    }
+}
@@ -0,0 +1,44 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+Test(BitsetWords, converts_a_bitset_into_words_and_back) {
+    cr_assert_eq((cmspk::iopins::bitsetWordCount<uint32_t, 1>), 1u);
+    cr_assert_eq((cmspk::iopins::bitsetWordCount<uint32_t, 64>), 2u);
+    cr_assert_eq((cmspk::iopins::bitsetWordCount<uint64_t, 128>), 2u);
+    cr_assert_eq((cmspk::iopins::bitsetWordCount<uint64_t, 129>), 3u);
+
+    // up to 64 bits
+    std::bitset<40> narrow(0x81'2345'6789ull);
+    auto narrowWords = cmspk::iopins::toWords<uint32_t>(narrow);
+    cr_assert_eq(narrowWords.size(), 2u);
+    cr_assert_eq(narrowWords[0], 0x23456789u);
+    cr_assert_eq(narrowWords[1], 0x81u);
+    cr_assert_eq(cmspk::iopins::fromWords<40>(narrowWords), narrow);
+
+    // beyond 64 bits
+    std::bitset<100> wide;
+    wide.set(0).set(31).set(32).set(63).set(64).set(99);
+    auto wideWords32 = cmspk::iopins::toWords<uint32_t>(wide);
+    cr_assert_eq(wideWords32.size(), 4u);
+    cr_assert_eq(wideWords32[0], 0x80000001u);
+    cr_assert_eq(wideWords32[1], 0x80000001u);
+    cr_assert_eq(wideWords32[2], 0x1u);
+    cr_assert_eq(wideWords32[3], 0x8u);
+    cr_assert_eq(cmspk::iopins::fromWords<100>(wideWords32), wide);
+    auto wideWords64 = cmspk::iopins::toWords<uint64_t>(wide);
+    cr_assert_eq(wideWords64.size(), 2u);
+    cr_assert_eq(wideWords64[0], 0x8000000180000001ull);
+    cr_assert_eq(wideWords64[1], 0x800000001ull);
+    cr_assert_eq(cmspk::iopins::fromWords<100>(wideWords64), wide);
+
+    // the bits beyond N are ignored
+    cr_assert_eq(cmspk::iopins::fromWords<4>(std::array<uint8_t, 1>{0xf5}).to_ulong(), 0x5u);
+    cr_assert_eq(cmspk::iopins::fromWords<68>(std::array<uint64_t, 2>{0, ~0ull}).count(), 4u);
+}
@@ -0,0 +1,79 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+struct TestBoard {
+    using Word = uint32_t;
+    static constexpr std::array<cmspk::iopins::BoardPin, 6> PINS{{
+        {"LED_RED", 0, 5},
+        {"LED_GREEN", 0, 6},
+        {"LED_BLUE", 0, 9},
+        {"BUTTON_A", 1, 13},
+        {"BUTTON_B", 1, 2},
+        {"CS", 2, 31},
+    }};
+};
+
+struct DuplicateNameBoard {
+    using Word = uint32_t;
+    static constexpr std::array<cmspk::iopins::BoardPin, 2> PINS{{{"LED", 0, 5}, {"LED", 0, 6}}};
+};
+
+struct DuplicatePinBoard {
+    using Word = uint8_t;
+    static constexpr std::array<cmspk::iopins::BoardPin, 2> PINS{{{"LED", 0, 5}, {"ALIAS", 0, 5}}};
+};
+
+struct TooWideBoard {
+    using Word = uint8_t;
+    static constexpr std::array<cmspk::iopins::BoardPin, 1> PINS{{{"LED", 0, 8}}};
+};
+
+using TestLeds = cmspk::iopins::BoardPinGroup<TestBoard, "LED_RED", "LED_GREEN", "LED_BLUE">;
+using TestButtons = cmspk::iopins::BoardPinGroup<TestBoard, "BUTTON_A", "BUTTON_B">;
+using TestRedAndGreen = cmspk::iopins::BoardPinGroup<TestBoard, "LED_GREEN", "LED_RED">;
+// ================[END typical specialization]==================
+
+// all of these are resolved at compile time
+static_assert(cmspk::iopins::isBoardPinMapValid<TestBoard>());
+static_assert(!cmspk::iopins::isBoardPinMapValid<DuplicateNameBoard>());
+static_assert(!cmspk::iopins::isBoardPinMapValid<DuplicatePinBoard>());
+static_assert(!cmspk::iopins::isBoardPinMapValid<TooWideBoard>());
+static_assert(cmspk::iopins::BoardPinOf<TestBoard, "CS">::PORT == 2);
+static_assert(cmspk::iopins::BoardPinOf<TestBoard, "CS">::MASK == 0x80000000u);
+static_assert(TestLeds::MASK == 0x260u);
+static_assert(TestLeds::PLAN.gather(0x240u) == 0b110u);
+static_assert(TestButtons::PLAN.scatter(0b10u) == 0x4u);
+static_assert(TestLeds::isDisjointFrom<TestButtons>());
+static_assert(!TestLeds::isDisjointFrom<TestRedAndGreen>());
+
+Test(BoardPinMap, groups_are_resolved_from_names) {
+    cr_assert_eq(cmspk::iopins::boardPinIndex<TestBoard>("BUTTON_A"), 3u);
+    cr_assert_eq(cmspk::iopins::boardPinIndex<TestBoard>("NOPE"), 6u);
+    cr_assert_eq((cmspk::iopins::BoardPinOf<TestBoard, "LED_BLUE">::ID), 9);
+
+    cr_assert_eq(TestLeds::N, 3u);
+    cr_assert_eq(TestLeds::PORT, 0);
+    cr_assert_eq(TestLeds::IDS, (std::array<uint8_t, 3>{5, 6, 9}));
+    cr_assert_eq(TestButtons::PORT, 1);
+    cr_assert_eq(TestButtons::IDS, (std::array<uint8_t, 2>{13, 2}));
+
+    // groups instanciated from names
+    cmspk::iopins::SimulatedPinBank bank(3);
+    cmspk::iopins::SimulatedOutputPinGroup<TestLeds::N> leds(bank, TestLeds::PORT, TestLeds::IDS, TestLeds::PLAN);
+    cmspk::iopins::SimulatedInputPinGroup<TestButtons::N> buttons(bank, TestButtons::PORT, TestButtons::IDS, TestButtons::PLAN);
+    bank.setDirections(TestLeds::PORT, TestLeds::MASK, IoDirection::WRITE);
+    cr_assert(leds.write(0b101).has_value());
+    cr_assert_eq(bank.getLatch(0), 0x220u);
+    bank.drive(1, TestButtons::MASK, 0x2000u);
+    auto readResult = buttons.read();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value().to_ulong(), 0b01u);
+}
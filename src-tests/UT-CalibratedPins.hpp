@@ -0,0 +1,91 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+// tenths of degree, falling
+struct PinTemperatureCalibration {
+    using Value = int16_t;
+    static constexpr std::array<cmspk::iopins::CalibrationPoint<int16_t>, 3> POINTS{{{0, 1000}, {2000, 500}, {4000, -500}}};
+};
+
+// millivolts of a 12 bits converter
+struct PinMillivoltCalibration {
+    using Value = int32_t;
+    static constexpr std::array<cmspk::iopins::CalibrationPoint<int32_t>, 2> POINTS{{{0, 0}, {4095, 3300}}};
+};
+
+class FixedAnalogInputPin final : public cmspk::iopins::AnalogInputPin16 {
+  public:
+    ~FixedAnalogInputPin() {}
+    FixedAnalogInputPin() : cmspk::iopins::AnalogInputPin16(4) {}
+    uint16_t value = 0;
+    bool failing = false;
+
+  private:
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept {
+        if (failing) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_DISABLED);
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+    virtual std::expected<uint16_t, IoFailureReason> doRead() noexcept { return value; }
+};
+
+class LatchedAnalogOutputPin final : public cmspk::iopins::AnalogOutputPin16 {
+  public:
+    ~LatchedAnalogOutputPin() {}
+    LatchedAnalogOutputPin() : cmspk::iopins::AnalogOutputPin16(5) {}
+    uint16_t value = 0;
+    bool failing = false;
+
+  private:
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept {
+        if (failing) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_DISABLED);
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+    virtual std::expected<void, IoFailureReason> doWrite(const uint16_t v) noexcept {
+        value = v;
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[END typical specialization]==================
+
+Test(CalibratedPins, input_pin_reads_engineering_units) {
+    FixedAnalogInputPin source;
+    cmspk::iopins::CalibratedInputPin<uint16_t, cmspk::iopins::LookupTable<PinTemperatureCalibration, uint16_t, 12>> pin(source);
+    cr_assert_eq(pin.getPinId(), 4);
+    source.value = 1000;
+    cr_assert_eq(pin.read().value(), 750);
+    source.value = 3000;
+    cr_assert_eq(pin.read().value(), 0);
+
+    source.failing = true;
+    auto result = pin.read();
+    cr_assert_not(result.has_value());
+    cr_assert_eq(result.error(), IoFailureReason::FAILURE_PIN_IS_DISABLED);
+}
+
+Test(CalibratedPins, output_pin_writes_raw_values) {
+    LatchedAnalogOutputPin target;
+    cmspk::iopins::CalibratedOutputPin<uint16_t, cmspk::iopins::PiecewiseLinearTable<PinMillivoltCalibration, uint16_t>> pin(target);
+    cr_assert_eq(pin.getPinId(), 5);
+    cr_assert(pin.write(1000).has_value());
+    cr_assert_eq(target.value, 1241);
+    cr_assert(pin.write(9999).has_value());
+    cr_assert_eq(target.value, 4095);
+
+    target.failing = true;
+    auto result = pin.write(0);
+    cr_assert_not(result.has_value());
+    cr_assert_eq(result.error(), IoFailureReason::FAILURE_PIN_IS_DISABLED);
+    cr_assert_eq(target.value, 4095);
+}
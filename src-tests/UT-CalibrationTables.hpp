@@ -0,0 +1,141 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+// 12 bits converter with a 3.3V reference, in millivolts
+struct MillivoltCalibration {
+    using Value = int32_t;
+    static constexpr std::array<cmspk::iopins::CalibrationPoint<int32_t>, 2> POINTS{{{0, 0}, {4095, 3300}}};
+};
+
+// 8 bits converter with a 3.3V reference, in millivolts
+struct ByteMillivoltCalibration {
+    using Value = int32_t;
+    static constexpr std::array<cmspk::iopins::CalibrationPoint<int32_t>, 2> POINTS{{{0, 0}, {255, 3300}}};
+};
+
+// thermistor, in tenths of degree, the value falls when the reading rises
+struct ThermistorCalibration {
+    using Value = int16_t;
+    static constexpr std::array<cmspk::iopins::CalibrationPoint<int16_t>, 4> POINTS{{{100, 1250}, {1000, 600}, {3000, 100}, {4000, -400}}};
+};
+
+// calibration with a plateau, that cannot be converted back
+struct PlateauCalibration {
+    using Value = uint8_t;
+    static constexpr std::array<cmspk::iopins::CalibrationPoint<uint8_t>, 3> POINTS{{{0, 0}, {100, 50}, {200, 50}}};
+};
+
+struct UnsortedCalibration {
+    using Value = int32_t;
+    static constexpr std::array<cmspk::iopins::CalibrationPoint<int32_t>, 2> POINTS{{{10, 0}, {5, 3300}}};
+};
+// ================[END typical specialization]==================
+
+Test(CalibrationTables, calibrations_are_checked_at_compile_time) {
+    static_assert(cmspk::iopins::isCalibrationValid<MillivoltCalibration, uint16_t>());
+    static_assert(!cmspk::iopins::isCalibrationValid<MillivoltCalibration, uint8_t>());
+    static_assert(!cmspk::iopins::isCalibrationValid<UnsortedCalibration, uint16_t>());
+    static_assert(cmspk::iopins::isCalibrationMonotonic<ThermistorCalibration>());
+    static_assert(!cmspk::iopins::isCalibrationMonotonic<PlateauCalibration>());
+    cr_assert(true);
+}
+
+Test(CalibrationTables, piecewise_linear_table_interpolates_and_clamps) {
+    using Millivolts = cmspk::iopins::PiecewiseLinearTable<MillivoltCalibration, uint16_t>;
+    static_assert(Millivolts::toValue(4095) == 3300);
+    cr_assert_eq(Millivolts::toValue(0), 0);
+    cr_assert_eq(Millivolts::toValue(2048), 1650);
+    cr_assert_eq(Millivolts::toValue(1241), 1000);
+    cr_assert_eq(Millivolts::toValue(65535), 3300);
+
+    using Thermistor = cmspk::iopins::PiecewiseLinearTable<ThermistorCalibration, uint16_t>;
+    cr_assert_eq(Thermistor::toValue(0), 1250);
+    cr_assert_eq(Thermistor::toValue(550), 925);
+    cr_assert_eq(Thermistor::toValue(1000), 600);
+    cr_assert_eq(Thermistor::toValue(2000), 350);
+    cr_assert_eq(Thermistor::toValue(3500), -150);
+    cr_assert_eq(Thermistor::toValue(4095), -400);
+
+    // a plateau is fine one way
+    using Plateau = cmspk::iopins::PiecewiseLinearTable<PlateauCalibration, uint8_t>;
+    cr_assert_eq(Plateau::toValue(50), 25);
+    cr_assert_eq(Plateau::toValue(150), 50);
+}
+
+Test(CalibrationTables, piecewise_linear_table_converts_back) {
+    using Millivolts = cmspk::iopins::PiecewiseLinearTable<MillivoltCalibration, uint16_t>;
+    cr_assert_eq(Millivolts::toRaw(-5), 0);
+    cr_assert_eq(Millivolts::toRaw(1000), 1241);
+    cr_assert_eq(Millivolts::toRaw(3300), 4095);
+    cr_assert_eq(Millivolts::toRaw(5000), 4095);
+
+    using Thermistor = cmspk::iopins::PiecewiseLinearTable<ThermistorCalibration, uint16_t>;
+    cr_assert_eq(Thermistor::toRaw(2000), 100);
+    cr_assert_eq(Thermistor::toRaw(925), 550);
+    cr_assert_eq(Thermistor::toRaw(350), 2000);
+    cr_assert_eq(Thermistor::toRaw(-150), 3500);
+    cr_assert_eq(Thermistor::toRaw(-1000), 4000);
+
+    // round trip within one step
+    bool roundTrip = true;
+    for (uint32_t raw = 0; raw < 4096; ++raw) {
+        int32_t value = Millivolts::toValue(static_cast<uint16_t>(raw));
+        int32_t back = Millivolts::toValue(Millivolts::toRaw(value));
+        roundTrip = roundTrip && back >= value - 1 && back <= value + 1;
+    }
+    cr_assert(roundTrip);
+}
+
+Test(CalibrationTables, lookup_table_matches_the_interpolation) {
+    using Interpolated = cmspk::iopins::PiecewiseLinearTable<ThermistorCalibration, uint16_t>;
+    using Lookup = cmspk::iopins::LookupTable<ThermistorCalibration, uint16_t, 12>;
+    static_assert(Lookup::SIZE == 4096);
+    bool same = true;
+    for (uint32_t raw = 0; raw < Lookup::SIZE; ++raw) {
+        same = same && Lookup::toValue(static_cast<uint16_t>(raw)) == Interpolated::toValue(static_cast<uint16_t>(raw));
+    }
+    cr_assert(same);
+    cr_assert_eq(Lookup::toValue(60000), Interpolated::toValue(4095));
+
+    // a 8 bits converter
+    using Byte = cmspk::iopins::LookupTable<PlateauCalibration, uint8_t, 8>;
+    cr_assert_eq(Byte::toValue(0), 0);
+    cr_assert_eq(Byte::toValue(50), 25);
+    cr_assert_eq(Byte::toValue(255), 50);
+}
+
+Test(CalibrationTables, lookup_table_converts_back_within_one_step) {
+    using Lookup = cmspk::iopins::LookupTable<ThermistorCalibration, uint16_t, 12>;
+    cr_assert_eq(Lookup::toRaw(2000), 100);
+    cr_assert_eq(Lookup::toRaw(600), 1000);
+    cr_assert_eq(Lookup::toRaw(-150), 3500);
+    cr_assert_eq(Lookup::toRaw(-1000), 4000);
+
+    // at most one reading away from the nearest value
+    using Millivolts = cmspk::iopins::LookupTable<MillivoltCalibration, uint16_t, 12>;
+    bool nearest = true;
+    for (int32_t value = 0; value <= 3300; ++value) {
+        uint16_t raw = Millivolts::toRaw(value);
+        int32_t error = std::abs(Millivolts::toValue(raw) - value);
+        int32_t best = error;
+        for (uint32_t other = 0; other < Millivolts::SIZE; ++other) {
+            best = std::min(best, std::abs(Millivolts::toValue(static_cast<uint16_t>(other)) - value));
+        }
+        nearest = nearest && error <= best + 1;
+    }
+    cr_assert(nearest);
+
+    // clamped to the size of the table
+    using Byte = cmspk::iopins::LookupTable<ByteMillivoltCalibration, uint16_t, 8>;
+    cr_assert_eq(Byte::toRaw(3300), 255);
+    cr_assert_eq(Byte::toRaw(5000), 255);
+    cr_assert_eq(Byte::toRaw(-10), 0);
+}
@@ -0,0 +1,88 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+Test(ChangeNotifyingInputPin, queue_keeps_the_order_and_counts_overflows) {
+    cmspk::iopins::EdgeEventQueue<4> queue;
+    cr_assert_eq(queue.capacity(), 4u);
+    for (uint32_t i = 0; i < 6; ++i) {
+        bool accepted = queue.post(cmspk::iopins::EdgeEvent{i, 1, 0 == (i & 1)});
+        cr_assert_eq(accepted, i < 4);
+    }
+    cr_assert_eq(queue.size(), 4u);
+    cr_assert_eq(queue.getOverflowCount(), 2u);
+
+    // the oldest events are kept
+    for (uint32_t i = 0; i < 4; ++i) {
+        std::optional<cmspk::iopins::EdgeEvent> event = queue.pop();
+        cr_assert(event.has_value());
+        cr_assert_eq(event->timestamp, i);
+        cr_assert_eq(event->channel, 1);
+        cr_assert_eq(event->level, 0 == (i & 1));
+    }
+    cr_assert_not(queue.pop().has_value());
+    cr_assert(queue.post(cmspk::iopins::EdgeEvent{9, 1, true}));
+    cr_assert_eq(queue.getOverflowCount(), 2u);
+}
+
+Test(ChangeNotifyingInputPin, simulated_pin_notifies_changes_only) {
+    cmspk::iopins::EdgeEventQueue<8> queue;
+    cmspk::iopins::SimulatedChangeNotifyingInputPin<8> pin(12, queue, 3);
+    cr_assert_eq(pin.getPinId(), 12);
+    cr_assert_eq(pin.getChannel(), 3);
+    cr_assert_not(pin.read().value());
+
+    cr_assert(pin.drive(false, 10));
+    cr_assert_eq(queue.size(), 0u);
+    cr_assert(pin.drive(true, 20));
+    cr_assert(pin.drive(true, 30));
+    cr_assert(pin.read().value());
+    cr_assert(pin.drive(false, 40));
+    cr_assert_not(pin.read().value());
+
+    std::array<cmspk::iopins::EdgeEvent, 8> events;
+    cr_assert_eq(queue.popBatch(events), 2u);
+    cr_assert_eq(events[0].timestamp, 20u);
+    cr_assert(events[0].level);
+    cr_assert_eq(events[0].channel, 3);
+    cr_assert_eq(events[1].timestamp, 40u);
+    cr_assert_not(events[1].level);
+}
+
+Test(ChangeNotifyingInputPin, edges_from_another_thread_are_all_received) {
+    static cmspk::iopins::EdgeEventQueue<64> queue;
+    static cmspk::iopins::SimulatedChangeNotifyingInputPin<64> pin(0, queue, 0);
+    constexpr uint32_t COUNT = 20000;
+    std::thread interruptSource([] {
+        uint32_t sent = 0;
+        while (sent < COUNT) {
+            // wait for room, like an interrupt source slower than the main loop
+            if (queue.size() == queue.capacity()) {
+                std::this_thread::yield();
+                continue;
+            }
+            ++sent;
+            pin.drive(1 == (sent & 1), sent);
+        }
+    });
+    uint32_t expected = 1;
+    bool ordered = true;
+    while (expected <= COUNT) {
+        std::optional<cmspk::iopins::EdgeEvent> event = queue.pop();
+        if (!event.has_value()) {
+            std::this_thread::yield();
+            continue;
+        }
+        ordered = ordered && event->timestamp == expected && event->level == (1 == (expected & 1));
+        ++expected;
+    }
+    interruptSource.join();
+    cr_assert(ordered);
+    cr_assert_eq(queue.getOverflowCount(), 0u);
+}
@@ -0,0 +1,67 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+class BouncingInputPinQuartet final : public cmspk::iopins::InputPinQuartet {
+  public:
+    ~BouncingInputPinQuartet() {}
+    BouncingInputPinQuartet(std::array<uint8_t, 4> indices, uint8_t* value) : cmspk::iopins::InputPinQuartet(indices), value(value) {}
+    bool readable = true;
+
+  private:
+    uint8_t* value;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept {
+        if (!readable) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+    virtual std::expected<std::bitset<4>, IoFailureReason> doRead() noexcept { return std::bitset<4>(*value); }
+};
+// ================[END typical specialization]==================
+
+Test(DebouncedInputPinGroup, read_returns_debounced_values) {
+    uint8_t mockValue{0};
+    BouncingInputPinQuartet source({3, 4, 5, 6}, &mockValue);
+    cmspk::iopins::DebouncedInputPinGroup<4, 2> p(source);
+
+    // verify predicates and ids
+    cr_assert(p.isReadable());
+    cr_assert_not(p.isWritable());
+    cr_assert_eq(p.getPinIds()[0], 3);
+    cr_assert_eq(p.getPinIds()[3], 6);
+
+    // verify debouncing
+    mockValue = 0b0101;
+    auto readResult = p.read();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value().to_ulong(), 0u);
+    mockValue = 0b0100;
+    readResult = p.read();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value().to_ulong(), 0b0100u);
+    readResult = p.read();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value().to_ulong(), 0b0100u);
+    cr_assert_eq(p.getState().to_ulong(), 0b0100u);
+
+    // verify failure propagation, without sampling
+    source.readable = false;
+    mockValue = 0;
+    readResult = p.read();
+    cr_assert_not(readResult.has_value());
+    cr_assert_eq(readResult.error(), IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+    cr_assert_eq(p.getState().to_ulong(), 0b0100u);
+
+    // verify reset
+    p.reset(0b1111);
+    cr_assert_eq(p.getState().to_ulong(), 0b1111u);
+}
@@ -0,0 +1,47 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+class BouncingBinaryInputPin final : public BinaryInputPin {
+  public:
+    ~BouncingBinaryInputPin() {}
+    BouncingBinaryInputPin(uint8_t index, BoolValue* value) : BinaryInputPin(index), value(value) {}
+
+  private:
+    BoolValue* value;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<bool, IoFailureReason> doRead() noexcept { return value->value; }
+};
+// ================[END typical specialization]==================
+
+Test(DebouncedLogicInputPin, logic_value_follows_debounced_raw_value) {
+    BoolValue mockValue{true};
+    BouncingBinaryInputPin source(12, &mockValue);
+    cmspk::iopins::DebouncedLogicInputPin<3> p(source, LogicIoPinSetting::ACTIVE_LOW, true);
+
+    // verify id
+    cr_assert_eq(p.getPinId(), 12);
+
+    // button pressed (active low), with a bounce
+    mockValue.value = false;
+    cr_assert(p.isNegated());
+    mockValue.value = true;
+    cr_assert(p.isNegated());
+    mockValue.value = false;
+    cr_assert(p.isNegated());
+    cr_assert(p.isNegated());
+    cr_assert(p.isAsserted());
+
+    // verify raw read
+    auto readResult = p.read();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value(), false);
+}
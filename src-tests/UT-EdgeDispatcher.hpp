@@ -0,0 +1,79 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+struct EdgeRecorder {
+    std::vector<uint32_t> timestamps;
+    int rising = 0;
+    int falling = 0;
+
+    static void onEdge(void* context, const cmspk::iopins::EdgeEvent& event) {
+        EdgeRecorder* recorder = static_cast<EdgeRecorder*>(context);
+        recorder->timestamps.push_back(event.timestamp);
+        if (event.level) {
+            ++recorder->rising;
+        } else {
+            ++recorder->falling;
+        }
+    }
+};
+// ================[END typical specialization]==================
+
+Test(EdgeDispatcher, events_go_to_the_handler_of_their_channel) {
+    cmspk::iopins::EdgeEventQueue<64> queue;
+    cmspk::iopins::SimulatedChangeNotifyingInputPin<64> button(4, queue, 0);
+    cmspk::iopins::SimulatedChangeNotifyingInputPin<64> sensor(5, queue, 1);
+    cmspk::iopins::EdgeDispatcher<2, 64> dispatcher(queue);
+    EdgeRecorder buttonEdges;
+    EdgeRecorder sensorEdges;
+    cr_assert(dispatcher.setHandler(0, EdgeRecorder::onEdge, &buttonEdges));
+    cr_assert(dispatcher.setHandler(1, EdgeRecorder::onEdge, &sensorEdges));
+    cr_assert_not(dispatcher.setHandler(2, EdgeRecorder::onEdge, &sensorEdges));  // no such channel
+
+    button.drive(true, 1);
+    sensor.drive(true, 2);
+    button.drive(false, 3);
+    cr_assert_eq(dispatcher.dispatch(), 3u);
+    cr_assert_eq(buttonEdges.timestamps.size(), 2u);
+    cr_assert_eq(buttonEdges.timestamps[0], 1u);
+    cr_assert_eq(buttonEdges.timestamps[1], 3u);
+    cr_assert_eq(buttonEdges.rising, 1);
+    cr_assert_eq(buttonEdges.falling, 1);
+    cr_assert_eq(sensorEdges.timestamps.size(), 1u);
+    cr_assert_eq(sensorEdges.rising, 1);
+    cr_assert_eq(dispatcher.dispatch(), 0u);
+}
+
+Test(EdgeDispatcher, dispatch_is_bounded_and_counts_unhandled_events) {
+    cmspk::iopins::EdgeEventQueue<64> queue;
+    cmspk::iopins::EdgeDispatcher<2, 64> dispatcher(queue);
+    EdgeRecorder recorder;
+    dispatcher.setHandler(0, EdgeRecorder::onEdge, &recorder);
+    for (uint32_t i = 0; i < 40; ++i) {
+        queue.post(cmspk::iopins::EdgeEvent{i, 0, true});
+    }
+    queue.post(cmspk::iopins::EdgeEvent{40, 1, true});  // no handler
+    queue.post(cmspk::iopins::EdgeEvent{41, 7, true});  // no such channel
+
+    // more than one batch, but not everything
+    cr_assert_eq(dispatcher.dispatch(35), 35u);
+    cr_assert_eq(recorder.timestamps.size(), 35u);
+    cr_assert_eq(recorder.timestamps[34], 34u);
+    cr_assert_eq(dispatcher.dispatch(), 7u);
+    cr_assert_eq(recorder.timestamps.size(), 40u);
+    cr_assert_eq(dispatcher.getUnhandledCount(), 2u);
+
+    // removing a handler
+    dispatcher.setHandler(0, nullptr, nullptr);
+    queue.post(cmspk::iopins::EdgeEvent{42, 0, false});
+    cr_assert_eq(dispatcher.dispatch(), 1u);
+    cr_assert_eq(dispatcher.getUnhandledCount(), 3u);
+    cr_assert_eq(dispatcher.getOverflowCount(), 0u);
+}
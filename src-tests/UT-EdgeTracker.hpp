@@ -0,0 +1,69 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+class TrackedInputPinOctet final : public cmspk::iopins::InputPinOctet {
+  public:
+    ~TrackedInputPinOctet() {}
+    TrackedInputPinOctet(uint8_t* value) : cmspk::iopins::InputPinOctet({0, 1, 2, 3, 4, 5, 6, 7}), value(value) {}
+    bool readable = true;
+
+  private:
+    uint8_t* value;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept {
+        if (!readable) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+    virtual std::expected<std::bitset<8>, IoFailureReason> doRead() noexcept { return std::bitset<8>(*value); }
+};
+// ================[END typical specialization]==================
+
+Test(EdgeTracker, reports_rising_falling_and_changed_pins) {
+    uint8_t mockValue{0b00001111};
+    TrackedInputPinOctet source(&mockValue);
+    cmspk::iopins::EdgeTracker<8> tracker(source, 0b00001111);
+
+    // nothing changed
+    auto edges = tracker.read();
+    cr_assert(edges.has_value());
+    cr_assert_not(edges.value().hasChanged());
+    cr_assert(edges.value().changedIndices().empty());
+
+    // presses and releases
+    mockValue = 0b01100110;
+    edges = tracker.read();
+    cr_assert(edges.has_value());
+    cr_assert(edges.value().hasChanged());
+    cr_assert_eq(edges.value().value.to_ulong(), 0b01100110u);
+    cr_assert_eq(edges.value().rising.to_ulong(), 0b01100000u);
+    cr_assert_eq(edges.value().falling.to_ulong(), 0b00001001u);
+    cr_assert_eq(edges.value().changed.to_ulong(), 0b01101001u);
+    std::vector<std::size_t> rising;
+    for (std::size_t index : edges.value().risingIndices()) {
+        rising.push_back(index);
+    }
+    cr_assert_eq(rising, (std::vector<std::size_t>{5, 6}));
+    std::vector<std::size_t> falling;
+    for (std::size_t index : edges.value().fallingIndices()) {
+        falling.push_back(index);
+    }
+    cr_assert_eq(falling, (std::vector<std::size_t>{0, 3}));
+
+    // a failed read does not change the previous values
+    source.readable = false;
+    mockValue = 0;
+    edges = tracker.read();
+    cr_assert_not(edges.has_value());
+    cr_assert_eq(edges.error(), IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+    cr_assert_eq(tracker.getPrevious().to_ulong(), 0b01100110u);
+}
@@ -0,0 +1,94 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+Test(ExpanderPins, pins_of_a_chip_share_one_transaction_per_batch) {
+    cmspk::iopins::SimulatedPortExpander expander;
+    std::vector<cmspk::iopins::ExpanderOutputPin> outputs;
+    for (uint8_t bit = 0; bit < 8; ++bit) {
+        outputs.emplace_back(expander, bit);
+    }
+    cmspk::iopins::ExpanderLogicOutputPin enable(expander, 8, LogicIoPinSetting::ACTIVE_LOW);
+
+    // not yet configured
+    auto writeResult = outputs[0].write(true);
+    cr_assert_not(writeResult.has_value());
+    cr_assert_eq(writeResult.error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+    cr_assert(expander.setOutputMask(0x01ff).has_value());
+    expander.resetCounters();
+
+    // one transaction per pin write
+    for (cmspk::iopins::ExpanderOutputPin& pin : outputs) {
+        cr_assert(pin.write(true).has_value());
+    }
+    cr_assert(enable.toAsserted().has_value());
+    cr_assert_eq(expander.getTransactionCount(), 9u);
+    cr_assert_eq(expander.getOutputRegister(), 0x00ffu);
+
+    // one transaction for the whole batch
+    expander.resetCounters();
+    expander.beginBatch();
+    for (std::size_t i = 0; i < outputs.size(); ++i) {
+        cr_assert(outputs[i].write(i % 2 == 0).has_value());
+    }
+    cr_assert(enable.toNegated().has_value());
+    cr_assert_eq(expander.getTransactionCount(), 0u);
+    cr_assert(expander.commit().has_value());
+    cr_assert_eq(expander.getTransactionCount(), 1u);
+    cr_assert_eq(expander.getOutputRegister(), 0x0155u);
+}
+
+Test(ExpanderPins, input_pins_reuse_the_snapshot_of_the_batch) {
+    cmspk::iopins::SimulatedPortExpander expander;
+    cmspk::iopins::ExpanderInputPin a(expander, 3);
+    cmspk::iopins::ExpanderInputPin b(expander, 12);
+    cmspk::iopins::ExpanderLogicInputPin button(expander, 15, LogicIoPinSetting::ACTIVE_LOW);
+    expander.drive(0x1008);
+
+    cr_assert(a.read().value());
+    cr_assert(b.read().value());
+    cr_assert(button.isAsserted());
+    cr_assert_eq(expander.getReadCount(), 3u);
+
+    expander.beginBatch();
+    cr_assert(a.read().value());
+    cr_assert(b.read().value());
+    cr_assert(button.isAsserted());
+    cr_assert(expander.commit().has_value());
+    cr_assert_eq(expander.getReadCount(), 4u);
+
+    // failures of the bus and of the configuration
+    expander.setFailing(true);
+    auto readResult = a.read();
+    cr_assert_not(readResult.has_value());
+    cr_assert_eq(readResult.error(), IoFailureReason::FAILURE_NO_ACKNOWLEDGE);
+    expander.setFailing(false);
+    cr_assert(expander.setOutputMask(0x0008).has_value());
+    readResult = a.read();
+    cr_assert_not(readResult.has_value());
+    cr_assert_eq(readResult.error(), IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+}
+
+Test(ExpanderPins, pins_beyond_the_width_of_the_expander_are_rejected) {
+    cmspk::iopins::SimulatedPortExpander expander;
+    cmspk::iopins::ExpanderInputPin input(expander, 16);
+    cmspk::iopins::ExpanderLogicInputPin logicInput(expander, 40, LogicIoPinSetting::ACTIVE_LOW);
+    cmspk::iopins::ExpanderOutputPin output(expander, 16);
+    cmspk::iopins::ExpanderLogicOutputPin logicOutput(expander, 200);
+    cr_assert(expander.setOutputMask(0xffff).has_value());
+    expander.drive(0xffff);
+    expander.resetCounters();
+
+    cr_assert_eq(input.read().error(), IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+    cr_assert_eq(logicInput.read().error(), IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+    cr_assert_eq(output.write(true).error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+    cr_assert_eq(logicOutput.toAsserted().error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+    cr_assert_eq(expander.getReadCount(), 0u);
+    cr_assert_eq(expander.getTransactionCount(), 0u);
+}
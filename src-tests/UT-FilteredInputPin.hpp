@@ -0,0 +1,59 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+class SequenceAnalogInputPin final : public cmspk::iopins::AnalogInputPin16 {
+  public:
+    ~SequenceAnalogInputPin() {}
+    SequenceAnalogInputPin(std::vector<uint16_t> values) : cmspk::iopins::AnalogInputPin16(2), values(values) {}
+    std::size_t reads = 0;
+    bool failing = false;
+
+  private:
+    std::vector<uint16_t> values;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept {
+        if (failing) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_DISABLED);
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+    virtual std::expected<uint16_t, IoFailureReason> doRead() noexcept { return values[reads++ % values.size()]; }
+};
+// ================[END typical specialization]==================
+
+Test(FilteredInputPin, filter_is_fed_by_each_read) {
+    SequenceAnalogInputPin source({1000, 1000, 50000, 1000, 1002});
+    cmspk::iopins::FilteredInputPin<uint16_t, cmspk::iopins::MedianFilter<uint16_t, 3>> pin(source);
+    cr_assert_eq(pin.getPinId(), 2);
+    pin.read();
+    pin.read();
+    cr_assert_eq(pin.read().value(), 1000);
+    cr_assert_eq(pin.read().value(), 1000);
+    cr_assert_eq(pin.read().value(), 1002);
+    cr_assert_eq(source.reads, 5u);
+
+    source.failing = true;
+    auto result = pin.read();
+    cr_assert_not(result.has_value());
+    cr_assert_eq(result.error(), IoFailureReason::FAILURE_PIN_IS_DISABLED);
+    cr_assert_eq(source.reads, 5u);
+}
+
+Test(FilteredInputPin, oversampling_adds_resolution) {
+    // a 12 bits converter toggling between 2 codes
+    SequenceAnalogInputPin source({2047, 2048, 2048, 2048});
+    cmspk::iopins::OversampledInputPin<uint16_t, 16, 2> pin(source);
+    cr_assert_eq(pin.read().value(), (4u * 2047u + 12u * 2048u) >> 2);
+    cr_assert_eq(source.reads, 16u);
+
+    source.failing = true;
+    cr_assert_not(pin.read().has_value());
+}
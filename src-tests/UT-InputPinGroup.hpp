@@ -55,3 +55,20 @@ Test(InputPinGroup, can_read_multiple_pin) {
     cr_assert_eq(readResult.value()[1], true);
     cr_assert_eq(readResult.value()[2], false);
 }
+
+Test(InputPinGroup, read_samples_paced) {
+    uint8_t mockValue = 0;
+    ConcreteInputPinTrio p({1, 42, 5}, &mockValue);
+    std::array<std::bitset<3>, 5> samples;
+
+    // the pacing function changes the value between two samples
+    cr_assert(p.readSamples(samples, [](void* context) { ++*static_cast<uint8_t*>(context); }, &mockValue).has_value());
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        cr_assert_eq(samples[i].to_ulong(), i);
+    }
+    cr_assert_eq(mockValue, 5);
+
+    // without pacing
+    cr_assert(p.readSamples(samples).has_value());
+    cr_assert_eq(samples[4].to_ulong(), 5u);
+}
@@ -0,0 +1,68 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+class SampledInputPinPair final : public cmspk::iopins::InputPinPair {
+  public:
+    ~SampledInputPinPair() {}
+    SampledInputPinPair(uint8_t* value) : cmspk::iopins::InputPinPair({0, 1}), value(value) {}
+    bool readable = true;
+
+  private:
+    uint8_t* value;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept {
+        if (!readable) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+    virtual std::expected<std::bitset<2>, IoFailureReason> doRead() noexcept { return std::bitset<2>(*value); }
+};
+// ================[END typical specialization]==================
+
+Test(InputPinGroupSampler, appends_timestamped_samples_to_the_ring) {
+    uint8_t mockValue{0};
+    SampledInputPinPair source(&mockValue);
+    cmspk::iopins::SpscRing<cmspk::iopins::TimestampedSample<2>, 2> ring;
+    uint32_t ticks = 100;
+    cmspk::iopins::InputPinGroupSampler<2, 2> sampler(source, ring, [](void* context) { return (*static_cast<uint32_t*>(context))++; }, &ticks);
+
+    mockValue = 1;
+    auto pollResult = sampler.poll();
+    cr_assert(pollResult.has_value());
+    cr_assert(pollResult.value());
+    mockValue = 2;
+    cr_assert(sampler.poll().value());
+
+    // ring is full
+    mockValue = 3;
+    pollResult = sampler.poll();
+    cr_assert(pollResult.has_value());
+    cr_assert_not(pollResult.value());
+    cr_assert_eq(sampler.getOverrunCount(), 1u);
+
+    // failures are reported
+    source.readable = false;
+    pollResult = sampler.poll();
+    cr_assert_not(pollResult.has_value());
+    cr_assert_eq(pollResult.error(), IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+
+    // verify samples
+    auto sample = ring.pop();
+    cr_assert(sample.has_value());
+    cr_assert_eq(sample.value().timestamp, 100u);
+    cr_assert_eq(sample.value().value.to_ulong(), 1u);
+    sample = ring.pop();
+    cr_assert(sample.has_value());
+    cr_assert_eq(sample.value().timestamp, 101u);
+    cr_assert_eq(sample.value().value.to_ulong(), 2u);
+    cr_assert_not(ring.pop().has_value());
+}
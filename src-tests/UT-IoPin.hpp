@@ -0,0 +1,99 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+class ConcreteIoPin final : public cmspk::iopins::BinaryIoPin {
+  public:
+    ~ConcreteIoPin() {}
+    ConcreteIoPin(uint8_t id) : cmspk::iopins::BinaryIoPin(id) {}
+    int directionChanges = 0;
+    bool inputOnly = false;
+    bool line = false;
+
+  private:
+    virtual std::expected<void, IoFailureReason> doSetDirection(IoDirection value) noexcept {
+        ++directionChanges;
+        if (inputOnly && IoDirection::WRITE == value) {
+            return std::unexpected(IoFailureReason::FAILURE_IMMUTABLE_DIRECTION);
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+    virtual std::expected<bool, IoFailureReason> doRead() noexcept { return line; }
+    virtual std::expected<void, IoFailureReason> doWrite(const bool value) noexcept {
+        line = value;
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[END typical specialization]==================
+
+Test(IoPin, direction_gates_reading_and_writing) {
+    ConcreteIoPin p(3);
+    cr_assert_eq(p.getPinId(), 3);
+    cr_assert_eq(p.getDirection(), IoDirection::HIGH_Z);
+    cr_assert(p.isDisabled());
+    auto readResult = p.read();
+    cr_assert_not(readResult.has_value());
+    cr_assert_eq(readResult.error(), IoFailureReason::FAILURE_PIN_IS_DISABLED);
+
+    cr_assert(p.setDirection(IoDirection::WRITE).has_value());
+    cr_assert(p.isWritable());
+    cr_assert(p.isNotReadable());
+    cr_assert(p.write(true).has_value());
+    readResult = p.read();
+    cr_assert_not(readResult.has_value());
+    cr_assert_eq(readResult.error(), IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+
+    cr_assert(p.setDirection(IoDirection::READ).has_value());
+    cr_assert(p.read().value());
+    auto writeResult = p.write(false);
+    cr_assert_not(writeResult.has_value());
+    cr_assert_eq(writeResult.error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+}
+
+Test(IoPin, redundant_direction_changes_do_not_reach_the_pin) {
+    ConcreteIoPin p(0);
+    cr_assert(p.setDirection(IoDirection::READ).has_value());
+    cr_assert(p.setDirection(IoDirection::READ).has_value());
+    cr_assert_eq(p.directionChanges, 1);
+    cr_assert(p.setDirection(IoDirection::WRITE).has_value());
+    cr_assert(p.setDirection(IoDirection::WRITE).has_value());
+    cr_assert_eq(p.directionChanges, 2);
+
+    // after invalidation, the direction is set again
+    p.invalidateDirection();
+    cr_assert(p.setDirection(IoDirection::WRITE).has_value());
+    cr_assert_eq(p.directionChanges, 3);
+}
+
+Test(IoPin, failed_direction_change_disables_the_pin) {
+    ConcreteIoPin p(0);
+    p.inputOnly = true;
+    cr_assert(p.setDirection(IoDirection::READ).has_value());
+    auto result = p.setDirection(IoDirection::WRITE);
+    cr_assert_not(result.has_value());
+    cr_assert_eq(result.error(), IoFailureReason::FAILURE_IMMUTABLE_DIRECTION);
+
+    // the state of the pin is unknown, neither the previous nor the requested direction is trusted
+    cr_assert_eq(p.getDirection(), IoDirection::HIGH_Z);
+    cr_assert_not(p.isDirectionKnown());
+    cr_assert(p.isNotReadable());
+    cr_assert(p.isNotWritable());
+    auto readResult = p.read();
+    cr_assert_not(readResult.has_value());
+    cr_assert_eq(readResult.error(), IoFailureReason::FAILURE_PIN_IS_DISABLED);
+    auto writeResult = p.write(true);
+    cr_assert_not(writeResult.has_value());
+    cr_assert_eq(writeResult.error(), IoFailureReason::FAILURE_PIN_IS_DISABLED);
+    cr_assert_not(p.line);
+
+    // the direction is not trusted anymore, the next change accesses the pin
+    cr_assert(p.setDirection(IoDirection::READ).has_value());
+    cr_assert_eq(p.directionChanges, 3);
+}
@@ -0,0 +1,60 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+Test(IoPinGroup, bus_turns_around_with_one_access_per_change) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    cmspk::iopins::SimulatedIoPinGroup<8> bus(bank, 0, {8, 9, 10, 11, 12, 13, 14, 15});
+    cr_assert_eq(bus.getPinIds()[7], 15);
+    auto writeResult = bus.write(0x5a);
+    cr_assert_not(writeResult.has_value());
+    cr_assert_eq(writeResult.error(), IoFailureReason::FAILURE_PIN_IS_DISABLED);
+
+    int accesses = 0;
+    bank.setListener([](void* context) { ++*static_cast<int*>(context); }, &accesses);
+    cr_assert(bus.setDirection(IoDirection::WRITE).has_value());
+    cr_assert_eq(accesses, 1);
+    cr_assert_eq(bank.getDirection(0, 8), IoDirection::WRITE);
+    cr_assert_eq(bank.getDirection(0, 15), IoDirection::WRITE);
+    cr_assert_eq(bank.getDirection(0, 7), IoDirection::READ);
+    cr_assert(bus.write(0x5a).has_value());
+    cr_assert_eq(bank.getLatch(0), 0x5a00u);
+    cr_assert_eq(accesses, 2);
+
+    // redundant change
+    cr_assert(bus.setDirection(IoDirection::WRITE).has_value());
+    cr_assert_eq(accesses, 2);
+
+    // turn around and read what the other side drives
+    cr_assert(bus.setDirection(IoDirection::READ).has_value());
+    cr_assert_eq(accesses, 3);
+    bank.drive(0, 0xff00u, 0xa500u);
+    auto readResult = bus.read();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value().to_ulong(), 0xa5u);
+    cr_assert_not(bus.write(0).has_value());
+
+    cr_assert(bus.setDirection(IoDirection::HIGH_Z).has_value());
+    cr_assert_eq(bank.getDirection(0, 12), IoDirection::HIGH_Z);
+    readResult = bus.read();
+    cr_assert_not(readResult.has_value());
+    cr_assert_eq(readResult.error(), IoFailureReason::FAILURE_PIN_IS_DISABLED);
+}
+
+Test(IoPinGroup, simulated_pin_follows_its_direction) {
+    cmspk::iopins::SimulatedPinBank bank(2);
+    cmspk::iopins::SimulatedIoPin pin(bank, 1, 4);
+    cr_assert_eq(pin.getPort(), 1u);
+    cr_assert(pin.setDirection(IoDirection::WRITE).has_value());
+    cr_assert(pin.write(true).has_value());
+    cr_assert(bank.getLevel(1, 4));
+    cr_assert(pin.setDirection(IoDirection::READ).has_value());
+    bank.drive(1, 4, false);
+    cr_assert_not(pin.read().value());
+}
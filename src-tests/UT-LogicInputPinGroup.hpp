@@ -0,0 +1,65 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+class ConcreteLogicInputPinQuartet final : public cmspk::iopins::LogicInputPinGroup<4> {
+  public:
+    ~ConcreteLogicInputPinQuartet() {}
+    ConcreteLogicInputPinQuartet(const std::array<LogicIoPinSetting, 4>& settings, uint8_t* port)
+        : cmspk::iopins::LogicInputPinGroup<4>({0, 1, 2, 3}, settings), port(port) {}
+    ConcreteLogicInputPinQuartet(LogicIoPinSetting setting, uint8_t* port) : cmspk::iopins::LogicInputPinGroup<4>({0, 1, 2, 3}, setting), port(port) {}
+
+  private:
+    uint8_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<std::bitset<4>, IoFailureReason> doRead() noexcept { return std::bitset<4>(*port); }
+};
+// ================[END typical specialization]==================
+
+Test(LogicInputPinGroup, readLogic_applies_the_polarity_mask) {
+    uint8_t mockPort{0b0011};
+    ConcreteLogicInputPinQuartet p(
+        {LogicIoPinSetting::ACTIVE_HIGH, LogicIoPinSetting::ACTIVE_LOW, LogicIoPinSetting::ACTIVE_HIGH, LogicIoPinSetting::ACTIVE_LOW}, &mockPort);
+    cr_assert_eq(p.getPolarityMask().to_ulong(), 0b1010u);
+    cr_assert_eq(p.getLogicSetting(1), LogicIoPinSetting::ACTIVE_LOW);
+    cr_assert_eq(p.getLogicSetting(2), LogicIoPinSetting::ACTIVE_HIGH);
+
+    // raw value is untouched
+    auto readResult = p.read();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value().to_ulong(), 0b0011u);
+
+    auto logicResult = p.readLogic();
+    cr_assert(logicResult.has_value());
+    cr_assert_eq(logicResult.value().to_ulong(), 0b1001u);
+
+    // change a logic setting
+    p.setLogicSetting(1, LogicIoPinSetting::ACTIVE_HIGH);
+    cr_assert_eq(p.readLogic().value().to_ulong(), 0b1011u);
+}
+
+Test(LogicInputPinGroup, isAsserted_and_isNegated_check_the_given_pins) {
+    uint8_t mockPort{0b0000};
+    ConcreteLogicInputPinQuartet p(LogicIoPinSetting::ACTIVE_LOW, &mockPort);
+    cr_assert_eq(p.getPolarityMask().to_ulong(), 0b1111u);
+    cr_assert(p.isAsserted());
+    cr_assert_not(p.isNegated());
+
+    mockPort = 0b0110;
+    cr_assert_not(p.isAsserted());
+    cr_assert(p.isAsserted(0b1001));
+    cr_assert(p.isNegated(0b0110));
+    cr_assert_not(p.isNegated(0b0111));
+
+    p.setLogicSettings({LogicIoPinSetting::ACTIVE_HIGH, LogicIoPinSetting::ACTIVE_HIGH, LogicIoPinSetting::ACTIVE_HIGH, LogicIoPinSetting::ACTIVE_HIGH});
+    cr_assert(p.isAsserted(0b0110));
+    cr_assert(p.isNegated(0b1001));
+}
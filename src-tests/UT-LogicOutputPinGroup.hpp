@@ -0,0 +1,72 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+class ConcreteLogicOutputPinQuartet final : public cmspk::iopins::LogicOutputPinGroup<4> {
+  public:
+    ~ConcreteLogicOutputPinQuartet() {}
+    ConcreteLogicOutputPinQuartet(const std::array<LogicIoPinSetting, 4>& settings, uint8_t* port)
+        : cmspk::iopins::LogicOutputPinGroup<4>({0, 1, 2, 3}, settings), port(port) {}
+    bool failing = false;
+
+  private:
+    uint8_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept {
+        if (failing) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_DISABLED);
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+    virtual std::expected<void, IoFailureReason> doWrite(const std::bitset<4> value) noexcept {
+        *port = static_cast<uint8_t>(value.to_ulong());
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[END typical specialization]==================
+
+Test(LogicOutputPinGroup, writeLogic_applies_the_polarity_mask) {
+    uint8_t mockPort{0};
+    ConcreteLogicOutputPinQuartet p(
+        {LogicIoPinSetting::ACTIVE_LOW, LogicIoPinSetting::ACTIVE_LOW, LogicIoPinSetting::ACTIVE_HIGH, LogicIoPinSetting::ACTIVE_HIGH}, &mockPort);
+    cr_assert_eq(p.getPolarityMask().to_ulong(), 0b0011u);
+
+    cr_assert(p.writeLogic(0b0101).has_value());
+    cr_assert_eq(mockPort, 0b0110);
+    cr_assert_eq(p.getLogicState().to_ulong(), 0b0101u);
+
+    // raw write is untouched
+    cr_assert(p.write(0b0101).has_value());
+    cr_assert_eq(mockPort, 0b0101);
+}
+
+Test(LogicOutputPinGroup, assertMask_and_negateMask_keep_the_other_pins) {
+    uint8_t mockPort{0};
+    ConcreteLogicOutputPinQuartet p(
+        {LogicIoPinSetting::ACTIVE_LOW, LogicIoPinSetting::ACTIVE_LOW, LogicIoPinSetting::ACTIVE_HIGH, LogicIoPinSetting::ACTIVE_HIGH}, &mockPort);
+    // initially negated
+    cr_assert_eq(p.getLogicState().to_ulong(), 0u);
+
+    cr_assert(p.assertMask(0b1001).has_value());
+    cr_assert_eq(p.getLogicState().to_ulong(), 0b1001u);
+    cr_assert_eq(mockPort, 0b1010);
+
+    cr_assert(p.assertMask(0b0100).has_value());
+    cr_assert(p.negateMask(0b0001).has_value());
+    cr_assert_eq(p.getLogicState().to_ulong(), 0b1100u);
+    cr_assert_eq(mockPort, 0b1111);
+
+    // a failed write does not change the logic state
+    p.failing = true;
+    auto result = p.negateMask(0b1100);
+    cr_assert_not(result.has_value());
+    cr_assert_eq(result.error(), IoFailureReason::FAILURE_PIN_IS_DISABLED);
+    cr_assert_eq(p.getLogicState().to_ulong(), 0b1100u);
+}
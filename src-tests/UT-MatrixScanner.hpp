@@ -0,0 +1,145 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+/**
+ * Fake keyboard matrix without diodes : rows are selected when driven low, columns are pulled up and read low when
+ * connected to a selected row through pressed keys.
+ */
+struct FakeKeyboardMatrix {
+    std::array<std::bitset<4>, 3> pressed{};
+    std::bitset<3> rowLevels{0b111};
+
+    std::bitset<4> columnLevels() const {
+        std::bitset<4> connected;
+        for (std::size_t r = 0; r < 3; ++r) {
+            if (!rowLevels[r]) {
+                connected |= pressed[r];
+            }
+        }
+        // without diodes, current also flows through the other rows sharing a pressed key
+        for (std::size_t r = 0; r < 3; ++r) {
+            if ((pressed[r] & connected).any()) {
+                connected |= pressed[r];
+            }
+        }
+        return ~connected;
+    }
+};
+
+class FakeMatrixRows final : public cmspk::iopins::OutputPinTrio {
+  public:
+    FakeMatrixRows(FakeKeyboardMatrix* matrix) : cmspk::iopins::OutputPinTrio({0, 1, 2}), matrix(matrix) {}
+
+  private:
+    FakeKeyboardMatrix* matrix;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<void, IoFailureReason> doWrite(std::bitset<3> value) noexcept {
+        matrix->rowLevels = value;
+        return std::expected<void, IoFailureReason>();
+    }
+};
+
+class FakeMatrixColumns final : public cmspk::iopins::InputPinQuartet {
+  public:
+    FakeMatrixColumns(FakeKeyboardMatrix* matrix) : cmspk::iopins::InputPinQuartet({3, 4, 5, 6}), matrix(matrix) {}
+    bool readable = true;
+
+  private:
+    FakeKeyboardMatrix* matrix;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept {
+        if (!readable) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+    virtual std::expected<std::bitset<4>, IoFailureReason> doRead() noexcept { return matrix->columnLevels(); }
+};
+// ================[END typical specialization]==================
+
+Test(MatrixScanner, key_presses_are_debounced_and_queued) {
+    FakeKeyboardMatrix matrix;
+    FakeMatrixRows rows(&matrix);
+    FakeMatrixColumns columns(&matrix);
+    cmspk::iopins::MatrixScanner<3, 4, 2, 2> scanner(rows, columns);
+
+    // press (1, 2)
+    matrix.pressed[1].set(2);
+    cr_assert(scanner.scan().has_value());
+    cr_assert_not(scanner.isPressed(1, 2));
+    cr_assert_eq(scanner.getPendingEventCount(), 0);
+    cr_assert(scanner.scan().has_value());
+    cr_assert(scanner.isPressed(1, 2));
+    cr_assert_eq(scanner.getKeyStates().to_ulong(), 1u << 6);
+    cr_assert_eq(matrix.rowLevels.to_ulong(), 0b111u);  // rows are deselected after the scan
+
+    auto event = scanner.pollEvent();
+    cr_assert(event.has_value());
+    cr_assert_eq(event.value().row, 1);
+    cr_assert_eq(event.value().column, 2);
+    cr_assert(event.value().pressed);
+    cr_assert_not(scanner.pollEvent().has_value());
+
+    // release (1, 2), press (0, 0) and (2, 3) : 3 events for a queue of 2
+    matrix.pressed[1].reset(2);
+    matrix.pressed[0].set(0);
+    matrix.pressed[2].set(3);
+    scanner.scan();
+    scanner.scan();
+    cr_assert_eq(scanner.getPendingEventCount(), 2);
+    cr_assert_eq(scanner.getDroppedEventCount(), 1);
+    event = scanner.pollEvent();
+    cr_assert(event.has_value());
+    cr_assert_eq(event.value().row, 0);
+    cr_assert_eq(event.value().column, 0);
+    cr_assert(event.value().pressed);
+    event = scanner.pollEvent();
+    cr_assert(event.has_value());
+    cr_assert_eq(event.value().row, 1);
+    cr_assert_eq(event.value().column, 2);
+    cr_assert_not(event.value().pressed);
+
+    // failure of the columns
+    columns.readable = false;
+    auto scanResult = scanner.scan();
+    cr_assert_not(scanResult.has_value());
+    cr_assert_eq(scanResult.error(), IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+    cr_assert_eq(matrix.rowLevels.to_ulong(), 0b111u);
+}
+
+Test(MatrixScanner, ghosting_keeps_previous_state_of_rows) {
+    FakeKeyboardMatrix matrix;
+    FakeMatrixRows rows(&matrix);
+    FakeMatrixColumns columns(&matrix);
+    cmspk::iopins::MatrixScanner<3, 4, 1> scanner(rows, columns);
+
+    // press (0, 0), (0, 1) and (1, 0)
+    matrix.pressed[0].set(0).set(1);
+    scanner.scan();
+    cr_assert_not(scanner.isGhostingDetected());
+    matrix.pressed[1].set(0);
+    scanner.scan();
+
+    // (1, 1) would appear as a phantom key
+    cr_assert(scanner.isGhostingDetected());
+    cr_assert(scanner.isPressed(0, 0));
+    cr_assert(scanner.isPressed(0, 1));
+    cr_assert_not(scanner.isPressed(1, 0));
+    cr_assert_not(scanner.isPressed(1, 1));
+
+    // release (0, 1)
+    matrix.pressed[0].reset(1);
+    scanner.scan();
+    cr_assert_not(scanner.isGhostingDetected());
+    cr_assert(scanner.isPressed(1, 0));
+    cr_assert_not(scanner.isPressed(1, 1));
+}
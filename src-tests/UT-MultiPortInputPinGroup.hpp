@@ -0,0 +1,105 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+template <std::size_t N, std::size_t Ports>
+class ConcreteMultiPortInputPinGroup final : public cmspk::iopins::MultiPortInputPinGroup<N, Ports, uint16_t> {
+  public:
+    ~ConcreteMultiPortInputPinGroup() {}
+    ConcreteMultiPortInputPinGroup(const cmspk::iopins::PortSliceLayout<N, Ports, uint16_t>& layout, uint16_t* ports)
+        : cmspk::iopins::MultiPortInputPinGroup<N, Ports, uint16_t>(layout), ports(ports) {}
+    int failingPort = -1;
+    std::vector<uint8_t> reads;
+
+  private:
+    uint16_t* ports;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<uint16_t, IoFailureReason> doReadPort(uint8_t port) noexcept {
+        reads.push_back(port);
+        if (failingPort == port) {
+            return std::unexpected(IoFailureReason::FAILURE);
+        }
+        return ports[port];
+    }
+};
+// ================[END typical specialization]==================
+
+Test(MultiPortInputPinGroup, reads_each_port_once_and_assembles_the_group) {
+    uint16_t ports[3] = {0, 0, 0};
+    // 4 pins from port 2 at bit 12, 16 pins from port 0, 4 pins from port 1 at bit 3
+    ConcreteMultiPortInputPinGroup<24, 3> p({{{2, 12, 4}, {0, 0, 16}, {1, 3, 4}}}, ports);
+    cr_assert(p.isReadable());
+    cr_assert_eq(p.getPinIds()[0], 12);
+    cr_assert_eq(p.getPinIds()[3], 15);
+    cr_assert_eq(p.getPinIds()[4], 0);
+    cr_assert_eq(p.getPinIds()[20], 3);
+    cr_assert_eq(p.getLayout().getOffset(2), 20u);
+
+    ports[2] = 0xa000;
+    ports[0] = 0x1234;
+    ports[1] = 0x0078;  // bits 3..6 = 0b1111
+    auto readResult = p.read();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value().to_ulong(), 0xf1234au);
+    cr_assert_eq(p.reads, (std::vector<uint8_t>{2, 0, 1}));
+
+    // a failing port aborts the read
+    p.failingPort = 0;
+    readResult = p.read();
+    cr_assert_not(readResult.has_value());
+    cr_assert_eq(readResult.error(), IoFailureReason::FAILURE);
+}
+
+Test(MultiPortInputPinGroup, can_read_128_pins_as_words) {
+    cmspk::iopins::SimulatedPinBank bank(5);
+    // 128 pins over 5 ports : 24 + 32 + 32 + 32 + 8, the slices straddle the 64 bits words
+    cmspk::iopins::SimulatedMultiPortInputPinGroup<128, 5> p(bank, {{{0, 8, 24}, {1, 0, 32}, {2, 0, 32}, {3, 0, 32}, {4, 4, 8}}});
+    bank.drive(0, 0xffffff00u, 0xabcdef00u);
+    bank.drive(1, 0xffffffffu, 0x01234567u);
+    bank.drive(2, 0xffffffffu, 0x89abcdefu);
+    bank.drive(3, 0xffffffffu, 0xfedcba98u);
+    bank.drive(4, 0x00000ff0u, 0x00000c30u);
+
+    auto words = p.readWords();
+    cr_assert(words.has_value());
+    cr_assert_eq(words.value()[0], 0xef012345'67abcdefull);
+    cr_assert_eq(words.value()[1], 0xc3fedcba'9889abcdull);
+    for (std::size_t port = 0; port < 5; ++port) {
+        cr_assert_eq(bank.getReadCount(port), 1u);
+    }
+    auto bits = p.read();
+    cr_assert(bits.has_value());
+    cr_assert_eq(cmspk::iopins::toWords<uint64_t>(bits.value()), words.value());
+
+    // 32 bits words
+    auto narrowWords = p.readWords<uint32_t>();
+    cr_assert(narrowWords.has_value());
+    cr_assert_eq(narrowWords.value(), (std::array<uint32_t, 4>{0x67abcdefu, 0xef012345u, 0x9889abcdu, 0xc3fedcbau}));
+
+    // not all pins are inputs
+    bank.setDirection(4, 11, IoDirection::WRITE);
+    auto readResult = p.read();
+    cr_assert_not(readResult.has_value());
+    cr_assert_eq(readResult.error(), IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+}
+
+Test(MultiPortInputPinGroup, slices_sharing_a_port_read_it_once) {
+    uint16_t ports[2] = {0x8421, 0x00f0};
+    // 4 pins from port 0 at bit 12, 4 pins from port 1 at bit 4, 4 pins from port 0 at bit 0
+    ConcreteMultiPortInputPinGroup<12, 3> p({{{0, 12, 4}, {1, 4, 4}, {0, 0, 4}}}, ports);
+    cr_assert_eq(p.getLayout().getOwner(2), 0u);
+    cr_assert_eq(p.getLayout().getMask(2), 0x000fu);
+
+    auto readResult = p.read();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value().to_ulong(), 0x1f8u);
+    cr_assert_eq(p.reads, (std::vector<uint8_t>{0, 1}));
+}
@@ -0,0 +1,94 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+struct PortWrite {
+    uint8_t port;
+    uint16_t mask;
+    uint16_t values;
+    bool operator==(const PortWrite&) const = default;
+};
+
+template <std::size_t N, std::size_t Ports>
+class ConcreteMultiPortOutputPinGroup final : public cmspk::iopins::MultiPortOutputPinGroup<N, Ports, uint16_t> {
+  public:
+    ~ConcreteMultiPortOutputPinGroup() {}
+    ConcreteMultiPortOutputPinGroup(const cmspk::iopins::PortSliceLayout<N, Ports, uint16_t>& layout)
+        : cmspk::iopins::MultiPortOutputPinGroup<N, Ports, uint16_t>(layout) {}
+    int failingPort = -1;
+    std::vector<PortWrite> writes;
+
+  private:
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<void, IoFailureReason> doWritePort(uint8_t port, uint16_t mask, uint16_t values) noexcept {
+        if (failingPort == port) {
+            return std::unexpected(IoFailureReason::FAILURE);
+        }
+        writes.push_back({port, mask, values});
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[END typical specialization]==================
+
+Test(MultiPortOutputPinGroup, writes_each_port_once_with_a_mask) {
+    ConcreteMultiPortOutputPinGroup<24, 3> p({{{2, 12, 4}, {0, 0, 16}, {1, 3, 4}}});
+    cr_assert(p.isWritable());
+
+    cr_assert(p.write(0xf1234au).has_value());
+    cr_assert_eq(p.writes, (std::vector<PortWrite>{{2, 0xf000, 0xa000}, {0, 0xffff, 0x1234}, {1, 0x0078, 0x0078}}));
+
+    // a failing port aborts the write, the previous ports are written
+    p.writes.clear();
+    p.failingPort = 0;
+    auto writeResult = p.write(0);
+    cr_assert_not(writeResult.has_value());
+    cr_assert_eq(writeResult.error(), IoFailureReason::FAILURE);
+    cr_assert_eq(p.writes.size(), 1u);
+}
+
+Test(MultiPortOutputPinGroup, can_write_128_pins_from_words) {
+    cmspk::iopins::SimulatedPinBank bank(5);
+    cmspk::iopins::SimulatedMultiPortOutputPinGroup<128, 5> p(bank, {{{0, 8, 24}, {1, 0, 32}, {2, 0, 32}, {3, 0, 32}, {4, 4, 8}}});
+    // not all pins are outputs
+    auto writeResult = p.writeWords({0, 0});
+    cr_assert_not(writeResult.has_value());
+    cr_assert_eq(writeResult.error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+
+    for (std::size_t port = 0; port < 5; ++port) {
+        bank.setDirections(port, 0xffffffffu, IoDirection::WRITE);
+    }
+    bank.writePort(4, 0xffffffffu, 0xf000000fu);
+    bank.resetCounters();
+    cr_assert(p.writeWords({0xef012345'67abcdefull, 0xc3fedcba'9889abcdull}).has_value());
+    cr_assert_eq(bank.getLatch(0), 0xabcdef00u);
+    cr_assert_eq(bank.getLatch(1), 0x01234567u);
+    cr_assert_eq(bank.getLatch(2), 0x89abcdefu);
+    cr_assert_eq(bank.getLatch(3), 0xfedcba98u);
+    cr_assert_eq(bank.getLatch(4), 0xf0000c3fu);  // the pins outside of the slice are kept
+    for (std::size_t port = 0; port < 5; ++port) {
+        cr_assert_eq(bank.getWriteCount(port), 1u);
+    }
+
+    // 32 bits words
+    cr_assert(p.writeWords<uint32_t>({0x01234567u, 0x89abcdefu, 0x00000000u, 0x0f000000u}).has_value());
+    cr_assert_eq(bank.getLatch(0), 0x23456700u);
+    cr_assert_eq(bank.getLatch(1), 0xabcdef01u);
+    cr_assert_eq(bank.getLatch(2), 0x00000089u);
+    cr_assert_eq(bank.getLatch(3), 0x00000000u);
+    cr_assert_eq(bank.getLatch(4), 0xf00000ffu);
+}
+
+Test(MultiPortOutputPinGroup, slices_sharing_a_port_write_it_once) {
+    // 4 pins to port 0 at bit 12, 4 pins to port 1 at bit 4, 4 pins to port 0 at bit 0
+    ConcreteMultiPortOutputPinGroup<12, 3> p({{{0, 12, 4}, {1, 4, 4}, {0, 0, 4}}});
+
+    cr_assert(p.write(0x1f8u).has_value());
+    cr_assert_eq(p.writes, (std::vector<PortWrite>{{0, 0xf00f, 0x8001}, {1, 0x00f0, 0x00f0}}));
+}
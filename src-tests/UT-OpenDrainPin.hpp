@@ -0,0 +1,78 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+class ConcreteOpenDrainPin final : public cmspk::iopins::OpenDrainPin {
+  public:
+    ~ConcreteOpenDrainPin() {}
+    ConcreteOpenDrainPin(uint8_t id) : cmspk::iopins::OpenDrainPin(id) {}
+    int directionChanges = 0;
+    bool failing = false;
+    bool externalPullDown = false;
+    IoDirection hardwareDirection = IoDirection::HIGH_Z;
+
+  private:
+    virtual std::expected<void, IoFailureReason> doSetDirection(IoDirection value) noexcept {
+        ++directionChanges;
+        if (failing) {
+            return std::unexpected(IoFailureReason::FAILURE_IMMUTABLE_DIRECTION);
+        }
+        hardwareDirection = value;
+        return std::expected<void, IoFailureReason>();
+    }
+    virtual std::expected<bool, IoFailureReason> doRead() noexcept { return IoDirection::READ == hardwareDirection && !externalPullDown; }
+};
+// ================[END typical specialization]==================
+
+Test(OpenDrainPin, same_direction_is_set_once) {
+    ConcreteOpenDrainPin p(7);
+    cr_assert_eq(p.getPinId(), 7);
+    cr_assert_eq(p.getDirection(), IoDirection::HIGH_Z);
+
+    cr_assert(p.release().has_value());
+    cr_assert(p.set(true).has_value());
+    cr_assert_eq(p.directionChanges, 1);
+    cr_assert_eq(p.getDirection(), IoDirection::READ);
+    cr_assert(p.read().value());
+
+    cr_assert(p.set(false).has_value());
+    cr_assert(p.driveLow().has_value());
+    cr_assert_eq(p.directionChanges, 2);
+    cr_assert_eq(p.getDirection(), IoDirection::WRITE);
+    cr_assert_not(p.read().value());
+
+    // after invalidation, the direction is set again
+    p.invalidateDirection();
+    cr_assert(p.driveLow().has_value());
+    cr_assert_eq(p.directionChanges, 3);
+}
+
+Test(OpenDrainPin, disabled_pin_is_not_readable) {
+    ConcreteOpenDrainPin p(0);
+    cr_assert(p.disable().has_value());
+    auto readResult = p.read();
+    cr_assert_not(readResult.has_value());
+    cr_assert_eq(readResult.error(), IoFailureReason::FAILURE_PIN_IS_DISABLED);
+}
+
+Test(OpenDrainPin, failed_change_forgets_the_direction) {
+    ConcreteOpenDrainPin p(0);
+    cr_assert(p.release().has_value());
+    p.failing = true;
+    auto result = p.driveLow();
+    cr_assert_not(result.has_value());
+    cr_assert_eq(result.error(), IoFailureReason::FAILURE_IMMUTABLE_DIRECTION);
+    cr_assert_eq(p.getDirection(), IoDirection::HIGH_Z);
+
+    // the next change accesses the pin, even to the previous direction
+    p.failing = false;
+    cr_assert(p.release().has_value());
+    cr_assert_eq(p.directionChanges, 3);
+}
@@ -57,3 +57,20 @@ Test(OutputPinGroup, can_write_multiple_pin) {
     cr_assert(writeResults.has_value());
     cr_assert_eq(mockValue, 3);
 }
+
+Test(OutputPinGroup, write_sequence_paced) {
+    struct Probe {
+        uint8_t value = 0;
+        std::vector<uint8_t> seen;
+    } probe;
+    ConcreteOutputPinTrio p({1, 42, 5}, &probe.value);
+    const std::array<std::bitset<3>, 4> values{0b001, 0b011, 0b111, 0b110};
+
+    // the pacing function sees each sample in turn
+    auto record = [](void* context) {
+        Probe* probe = static_cast<Probe*>(context);
+        probe->seen.push_back(probe->value);
+    };
+    cr_assert(p.writeSequence(values, record, &probe).has_value());
+    cr_assert_eq(probe.seen, (std::vector<uint8_t>{1, 3, 7, 6}));
+}
@@ -0,0 +1,181 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+struct RecordedPortWrite {
+    uint8_t port;
+    uint32_t mask;
+    uint32_t values;
+};
+
+class RecordingOutputPort final : public cmspk::iopins::OutputPort {
+  public:
+    ~RecordingOutputPort() {}
+    RecordingOutputPort(uint8_t index, std::vector<RecordedPortWrite>& log) : cmspk::iopins::OutputPort(index), log(log) {}
+    bool failing = false;
+
+  private:
+    std::vector<RecordedPortWrite>& log;
+
+    virtual std::expected<void, IoFailureReason> doCheckWritable(Word) const noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<void, IoFailureReason> doWriteMasked(Word mask, Word values) noexcept {
+        if (failing) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_DISABLED);
+        }
+        log.push_back({getIndex(), mask, values});
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[END typical specialization]==================
+
+Test(OutputTransaction, writes_go_through_without_a_transaction) {
+    std::vector<RecordedPortWrite> log;
+    RecordingOutputPort port(0, log);
+    cr_assert_not(port.isDeferring());
+    port.writeBits(0x3u, 0x1u);
+    port.writeBits(0x3u, 0x1u);
+    cr_assert_eq(log.size(), 2u);
+    cr_assert_eq(log[1].mask, 0x3u);
+    cr_assert_eq(log[1].values, 0x1u);
+}
+
+Test(OutputTransaction, commit_writes_each_port_once_by_increasing_index) {
+    std::vector<RecordedPortWrite> log;
+    RecordingOutputPort portA(0, log);
+    RecordingOutputPort portB(1, log);
+    RecordingOutputPort portC(2, log);
+    cmspk::iopins::OutputTransaction transaction{portC, portA};
+    cr_assert(transaction.join(portB));
+    cr_assert(transaction.join(portB));
+    cr_assert(portA.isDeferring());
+
+    portC.writeBits(0x10u, 0x10u);
+    portA.writeBits(0x01u, 0x01u);
+    portB.writeBits(0x02u, 0x00u);
+    portA.writeBits(0x80u, 0x80u);
+    cr_assert(log.empty());
+    cr_assert(transaction.isPending());
+
+    cr_assert(transaction.commit().has_value());
+    cr_assert_eq(log.size(), 3u);
+    cr_assert_eq(log[0].port, 0);
+    cr_assert_eq(log[0].mask, 0x81u);
+    cr_assert_eq(log[0].values, 0x81u);
+    cr_assert_eq(log[1].port, 1);
+    cr_assert_eq(log[2].port, 2);
+    cr_assert_not(transaction.isPending());
+
+    // nothing left to write
+    cr_assert(transaction.commit().has_value());
+    cr_assert_eq(log.size(), 3u);
+}
+
+Test(OutputTransaction, writes_cancelling_out_are_dropped) {
+    std::vector<RecordedPortWrite> log;
+    RecordingOutputPort portA(0, log);
+    RecordingOutputPort portB(1, log);
+    cmspk::iopins::OutputTransaction transaction{portA, portB};
+    portA.writeBits(0x0fu, 0x05u);
+    portB.writeBits(0x0fu, 0x00u);
+    transaction.commit();
+    cr_assert_eq(log.size(), 2u);
+
+    // a pulse inside the transaction, and a write of the current value
+    portA.writeBits(0x01u, 0x00u);
+    portA.writeBits(0x01u, 0x01u);
+    portB.writeBits(0x03u, 0x00u);
+    cr_assert_not(transaction.isPending());
+    transaction.commit();
+    cr_assert_eq(log.size(), 2u);
+
+    // only the changing pins are written
+    portA.writeBits(0x0fu, 0x06u);
+    transaction.commit();
+    cr_assert_eq(log.size(), 3u);
+    cr_assert_eq(log[2].mask, 0x03u);
+    cr_assert_eq(log[2].values & log[2].mask, 0x02u);
+
+    // unless the shadow is forgotten
+    portA.invalidate();
+    portA.writeBits(0x0fu, 0x06u);
+    transaction.commit();
+    cr_assert_eq(log.size(), 4u);
+    cr_assert_eq(log[3].mask, 0x0fu);
+}
+
+Test(OutputTransaction, failed_ports_are_written_again) {
+    std::vector<RecordedPortWrite> log;
+    RecordingOutputPort portA(0, log);
+    RecordingOutputPort portB(1, log);
+    cmspk::iopins::OutputTransaction transaction{portA, portB};
+    portA.failing = true;
+    portA.writeBits(0x01u, 0x01u);
+    portB.writeBits(0x01u, 0x01u);
+    auto result = transaction.commit();
+    cr_assert_not(result.has_value());
+    cr_assert_eq(result.error(), IoFailureReason::FAILURE_PIN_IS_DISABLED);
+    cr_assert_eq(log.size(), 1u);
+    cr_assert_eq(log[0].port, 1);
+
+    portA.failing = false;
+    portA.writeBits(0x01u, 0x01u);
+    portB.writeBits(0x01u, 0x01u);
+    cr_assert(transaction.commit().has_value());
+    cr_assert_eq(log.size(), 2u);
+    cr_assert_eq(log[1].port, 0);
+}
+
+Test(OutputTransaction, rollback_and_destruction_discard_the_writes) {
+    std::vector<RecordedPortWrite> log;
+    RecordingOutputPort portA(0, log);
+    {
+        cmspk::iopins::OutputTransaction transaction{portA};
+        portA.writeBits(0x01u, 0x01u);
+        transaction.rollback();
+        cr_assert_not(transaction.isPending());
+        transaction.commit();
+        cr_assert(log.empty());
+
+        // a port is in one transaction at most
+        cmspk::iopins::OutputTransaction other;
+        cr_assert_not(other.join(portA));
+        portA.writeBits(0x01u, 0x01u);
+    }
+    cr_assert(log.empty());
+    cr_assert_not(portA.isDeferring());
+    portA.writeBits(0x01u, 0x01u);
+    cr_assert_eq(log.size(), 1u);
+}
+
+Test(OutputTransaction, ports_can_leave_before_the_end) {
+    std::vector<RecordedPortWrite> log;
+    RecordingOutputPort portA(0, log);
+    cmspk::iopins::OutputTransaction transaction{portA};
+    {
+        RecordingOutputPort portB(1, log);
+        RecordingOutputPort portC(2, log);
+        cr_assert(transaction.join(portB));
+        cr_assert(transaction.join(portC));
+        portB.writeBits(0x02u, 0x02u);
+
+        // leaving discards the deferred writes, and writes through again
+        cr_assert(transaction.leave(portC));
+        cr_assert_not(transaction.leave(portC));
+        cr_assert_not(portC.isDeferring());
+        portC.writeBits(0x04u, 0x04u);
+        cr_assert_eq(log.size(), 1u);
+        log.clear();
+        // portB is destroyed while in the transaction
+    }
+    portA.writeBits(0x01u, 0x01u);
+    cr_assert(transaction.commit().has_value());
+    cr_assert_eq(log.size(), 1u);
+    cr_assert_eq(log[0].port, 0);
+}
@@ -0,0 +1,115 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+// Latch the data and data/command lines (pins 0 to 8 of port 0) on the latching edge of the strobe (pin 9 of port 0).
+struct ParallelBusProbe {
+    cmspk::iopins::SimulatedPinBank& bank;
+    bool latchOnRisingEdge;
+    bool strobe = false;
+    std::vector<uint16_t> latched;
+
+    ParallelBusProbe(cmspk::iopins::SimulatedPinBank& bank, bool latchOnRisingEdge) : bank(bank), latchOnRisingEdge(latchOnRisingEdge) {
+        bank.setDirections(0, 0x3ffu, IoDirection::WRITE);
+        strobe = bank.getLevel(0, 9);
+        bank.setListener(onAccess, this);
+    }
+
+    static void onAccess(void* context) {
+        ParallelBusProbe* probe = static_cast<ParallelBusProbe*>(context);
+        bool level = probe->bank.getLevel(0, 9);
+        if (level != probe->strobe && level == probe->latchOnRisingEdge) {
+            probe->latched.push_back(static_cast<uint16_t>(probe->bank.getLatch(0) & 0x1ffu));
+        }
+        probe->strobe = level;
+    }
+};
+// ================[END typical specialization]==================
+
+Test(ParallelBusWriter, separate_lines_latch_commands_and_data) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    bank.writePort(0, 1u << 9, 1u << 9);  // WR idles high
+    ParallelBusProbe probe(bank, true);
+    cmspk::iopins::SimulatedOutputPinGroup<8> data(bank, 0, {0, 1, 2, 3, 4, 5, 6, 7});
+    cmspk::iopins::SimulatedOutputPin dc(bank, 0, 8);
+    cmspk::iopins::SimulatedOutputPin wr(bank, 0, 9);
+    cmspk::iopins::ParallelBusWriter<cmspk::iopins::ParallelSeparateLines> bus(cmspk::iopins::ParallelSeparateLines(data, dc, wr));
+    cr_assert_eq(bus.getProtocol(), cmspk::iopins::BUS_8080);
+
+    const std::array<uint8_t, 3> pixels{0x12, 0x34, 0x56};
+    cr_assert(bus.writeCommand(0x2c).has_value());
+    cr_assert(bus.writeData(pixels).has_value());
+    cr_assert(bus.writeCommand(0x29).has_value());
+    cr_assert_eq(probe.latched.size(), 5u);
+    cr_assert_eq(probe.latched[0], 0x02cu);
+    cr_assert_eq(probe.latched[1], 0x112u);
+    cr_assert_eq(probe.latched[2], 0x134u);
+    cr_assert_eq(probe.latched[3], 0x156u);
+    cr_assert_eq(probe.latched[4], 0x029u);
+    cr_assert(bank.getLevel(0, 9));
+
+    // filling only toggles the strobe
+    bank.resetCounters();
+    cr_assert(bus.fill(0xa5, 10).has_value());
+    cr_assert_eq(probe.latched.size(), 15u);
+    cr_assert_eq(probe.latched[14], 0x1a5u);
+    cr_assert_eq(bank.getWriteCount(0), 1u + 1u + 2u * 10u);
+}
+
+Test(ParallelBusWriter, shared_port_merges_data_and_strobe) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    ParallelBusProbe probe(bank, false);
+    cmspk::iopins::SimulatedOutputPinGroup<10> lines(bank, 0, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    cmspk::iopins::ParallelBusWriter<cmspk::iopins::ParallelSharedPortLines> bus(cmspk::iopins::ParallelSharedPortLines(lines), cmspk::iopins::BUS_6800);
+
+    const std::array<uint8_t, 2> color{0xf8, 0x00};
+    cr_assert(bus.writeCommand(0x2c).has_value());
+    bank.resetCounters();
+    cr_assert(bus.fill(color, 4).has_value());
+    cr_assert_eq(probe.latched.size(), 9u);
+    cr_assert_eq(probe.latched[0], 0x02cu);
+    cr_assert_eq(probe.latched[1], 0x1f8u);
+    cr_assert_eq(probe.latched[2], 0x100u);
+    cr_assert_eq(probe.latched[8], 0x100u);
+    cr_assert_not(bank.getLevel(0, 9));
+
+    // one setup of the data/command line, then 2 port writes per byte
+    cr_assert_eq(bank.getWriteCount(0), 1u + 2u * 8u);
+}
+
+Test(ParallelBusWriter, delay_is_called_after_each_strobe_edge_with_its_context) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    cmspk::iopins::SimulatedOutputPinGroup<10> lines(bank, 0, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    int delays = 0;
+    cmspk::iopins::ParallelBusWriter<cmspk::iopins::ParallelSharedPortLines> bus(cmspk::iopins::ParallelSharedPortLines(lines), cmspk::iopins::BUS_8080,
+                                                                                 [](void* context) { ++*static_cast<int*>(context); }, &delays);
+    bank.setDirections(0, 0x3ffu, IoDirection::WRITE);
+
+    const std::array<uint8_t, 3> values{1, 2, 3};
+    cr_assert(bus.writeData(values).has_value());
+    cr_assert_eq(bank.getWriteCount(0), 1u + 2u * 3u);
+    cr_assert_eq(delays, 1 + 2 * 3);
+}
+
+Test(ParallelBusWriter, failure_stops_the_transfer) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    cmspk::iopins::SimulatedOutputPinGroup<10> lines(bank, 0, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    cmspk::iopins::ParallelBusWriter<cmspk::iopins::ParallelSharedPortLines> bus{cmspk::iopins::ParallelSharedPortLines(lines)};
+    const std::array<uint8_t, 2> values{1, 2};
+    auto result = bus.writeData(values);
+    cr_assert_not(result.has_value());
+    cr_assert_eq(result.error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+    cr_assert_eq(bank.getWriteCount(0), 0u);
+
+    // once configured, the lines are written again
+    bank.setDirections(0, 0x3ffu, IoDirection::WRITE);
+    cr_assert(bus.writeData(values).has_value());
+    cr_assert_eq(bank.getWriteCount(0), 1u + 2u * 2u);
+}
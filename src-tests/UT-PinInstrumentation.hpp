@@ -0,0 +1,212 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+// each reading of the clock advances it by 5 ticks
+struct SteppingInstrumentationClock {
+    static inline uint32_t ticks = 0;
+    static uint32_t now() noexcept {
+        ticks += 5;
+        return ticks;
+    }
+};
+
+using TestInstrumentation = cmspk::iopins::CountingInstrumentation<SteppingInstrumentationClock>;
+
+template <typename Instrumentation>
+class InstrumentedStaticInputPin final : public cmspk::iopins::StaticBinaryInputPin<InstrumentedStaticInputPin<Instrumentation>, Instrumentation> {
+    friend cmspk::iopins::StaticBinaryInputPin<InstrumentedStaticInputPin<Instrumentation>, Instrumentation>;
+
+  public:
+    ~InstrumentedStaticInputPin() {}
+    InstrumentedStaticInputPin() : cmspk::iopins::StaticBinaryInputPin<InstrumentedStaticInputPin<Instrumentation>, Instrumentation>(1) {}
+    bool readable = true;
+
+  private:
+    std::expected<void, IoFailureReason> checkReadability() noexcept {
+        if (!readable) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+    std::expected<bool, IoFailureReason> doRead() noexcept { return true; }
+};
+
+class InstrumentedStaticLogicOutputPin final : public cmspk::iopins::StaticLogicOutputPin<InstrumentedStaticLogicOutputPin, TestInstrumentation> {
+    friend cmspk::iopins::StaticBinaryOutputPin<InstrumentedStaticLogicOutputPin, TestInstrumentation>;
+
+  public:
+    ~InstrumentedStaticLogicOutputPin() {}
+    InstrumentedStaticLogicOutputPin()
+        : cmspk::iopins::StaticLogicOutputPin<InstrumentedStaticLogicOutputPin, TestInstrumentation>(2, LogicIoPinSetting::ACTIVE_LOW) {}
+    bool level = false;
+
+  private:
+    std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    std::expected<void, IoFailureReason> doWrite(const bool value) noexcept {
+        level = value;
+        return std::expected<void, IoFailureReason>();
+    }
+};
+
+class InstrumentedStaticInputGroup final : public cmspk::iopins::StaticInputPinQuartet<InstrumentedStaticInputGroup, TestInstrumentation> {
+    friend cmspk::iopins::StaticInputPinGroup<InstrumentedStaticInputGroup, 4, TestInstrumentation>;
+
+  public:
+    ~InstrumentedStaticInputGroup() {}
+    InstrumentedStaticInputGroup() : cmspk::iopins::StaticInputPinQuartet<InstrumentedStaticInputGroup, TestInstrumentation>({0, 1, 2, 3}) {}
+
+  private:
+    std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    std::expected<std::bitset<4>, IoFailureReason> doRead() noexcept { return std::bitset<4>(0x5); }
+};
+
+// the layout of a static pin before the instrumentation policy
+struct UninstrumentedStaticPinLayout : public cmspk::iopins::CapabilityEpoch {
+    uint8_t id;
+};
+// ================[END typical specialization]==================
+
+Test(PinInstrumentation, disabled_instrumentation_takes_no_room) {
+    static_assert(std::is_empty_v<cmspk::iopins::NoInstrumentation>);
+    static_assert(sizeof(InstrumentedStaticInputPin<cmspk::iopins::NoInstrumentation>) == sizeof(UninstrumentedStaticPinLayout));
+    static_assert(sizeof(InstrumentedStaticInputPin<TestInstrumentation>) > sizeof(UninstrumentedStaticPinLayout));
+    InstrumentedStaticInputPin<cmspk::iopins::NoInstrumentation> pin;
+    cr_assert(pin.read().value());
+}
+
+Test(PinInstrumentation, latencies_are_bucketed_by_power_of_2) {
+    cr_assert_eq(cmspk::iopins::PinStatistics::latencyBucketOf(0), 0u);
+    cr_assert_eq(cmspk::iopins::PinStatistics::latencyBucketOf(1), 1u);
+    cr_assert_eq(cmspk::iopins::PinStatistics::latencyBucketOf(2), 2u);
+    cr_assert_eq(cmspk::iopins::PinStatistics::latencyBucketOf(3), 2u);
+    cr_assert_eq(cmspk::iopins::PinStatistics::latencyBucketOf(1024), 11u);
+    cr_assert_eq(cmspk::iopins::PinStatistics::latencyBucketOf(0xffffffffu), 31u);
+}
+
+Test(PinInstrumentation, static_pins_count_operations_failures_and_latencies) {
+    InstrumentedStaticInputPin<TestInstrumentation> pin;
+    pin.read();
+    pin.read();
+    pin.readable = false;
+    pin.read();
+    // the handles are not instrumented
+    pin.readable = true;
+    pin.acquireReader().value().readRaw();
+
+    const cmspk::iopins::PinStatistics& statistics = pin.getInstrumentation().getStatistics();
+    cr_assert_eq(statistics.getOperationCount(cmspk::iopins::PIN_OPERATION_READ), 3u);
+    cr_assert_eq(statistics.getOperationCount(cmspk::iopins::PIN_OPERATION_WRITE), 0u);
+    cr_assert_eq(statistics.getTotalOperationCount(), 3u);
+    cr_assert_eq(statistics.getFailureCount(IoFailureReason::FAILURE_PIN_IS_NOT_READABLE), 1u);
+    cr_assert_eq(statistics.getTotalFailureCount(), 1u);
+    // 5 ticks per operation
+    cr_assert_eq(statistics.getLatencies()[3], 3u);
+
+    InstrumentedStaticLogicOutputPin led;
+    led.toAsserted();
+    cr_assert_not(led.level);
+    cr_assert_eq(led.getInstrumentation().getOperationCount(cmspk::iopins::PIN_OPERATION_WRITE), 1u);
+
+    InstrumentedStaticInputGroup group;
+    std::array<std::bitset<4>, 8> samples;
+    group.read();
+    group.readSamples(samples);
+    cr_assert_eq(group.getInstrumentation().getOperationCount(cmspk::iopins::PIN_OPERATION_READ), 1u);
+    cr_assert_eq(group.getInstrumentation().getOperationCount(cmspk::iopins::PIN_OPERATION_READ_BURST), 1u);
+}
+
+Test(PinInstrumentation, virtual_pins_are_instrumented_by_wrapping) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    bank.setDirection(0, 4, IoDirection::WRITE);
+    cmspk::iopins::SimulatedInputPin input(bank, 0, 3);
+    cmspk::iopins::SimulatedOutputPin output(bank, 0, 4);
+    cmspk::iopins::InstrumentedInputPin<bool, TestInstrumentation> instrumentedInput(input);
+    cmspk::iopins::InstrumentedOutputPin<bool, TestInstrumentation> instrumentedOutput(output);
+    cr_assert_eq(instrumentedInput.getPinId(), 3);
+
+    cr_assert(instrumentedInput.read().has_value());
+    cr_assert(instrumentedOutput.write(true).has_value());
+    cr_assert_eq(bank.getLatch(0), 0x10u);
+    cr_assert_eq(instrumentedInput.getInstrumentation().getOperationCount(cmspk::iopins::PIN_OPERATION_READ), 1u);
+    cr_assert_eq(instrumentedOutput.getInstrumentation().getOperationCount(cmspk::iopins::PIN_OPERATION_WRITE), 1u);
+
+    bank.setDirection(0, 4, IoDirection::READ);
+    cr_assert_not(instrumentedOutput.write(false).has_value());
+    cr_assert_eq(instrumentedOutput.getInstrumentation().getFailureCount(IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE), 1u);
+}
+
+Test(PinInstrumentation, virtual_groups_are_instrumented_by_wrapping) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    bank.setDirections(0, 0x0cu, IoDirection::WRITE);
+    cmspk::iopins::SimulatedInputPinGroup<2> inputs(bank, 0, {0, 1});
+    cmspk::iopins::SimulatedOutputPinGroup<2> outputs(bank, 0, {2, 3});
+    cmspk::iopins::InstrumentedInputPinGroup<2, TestInstrumentation> instrumentedInputs(inputs);
+    cmspk::iopins::InstrumentedOutputPinGroup<2, TestInstrumentation> instrumentedOutputs(outputs);
+    cr_assert_eq(instrumentedOutputs.getPinIds()[1], 3);
+
+    bank.drive(0, 0x03u, 0x02u);
+    auto readResult = instrumentedInputs.read();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value().to_ulong(), 0b10u);
+    cr_assert(instrumentedOutputs.write(0b01).has_value());
+    cr_assert_eq(bank.getLatch(0), 0x04u);
+
+    // a burst is forwarded to the group, and counted once
+    int paces = 0;
+    std::array<std::bitset<2>, 4> samples;
+    const std::array<std::bitset<2>, 3> values{0b11, 0b10, 0b00};
+    cr_assert(instrumentedInputs.readSamples(samples, [](void* context) { ++*static_cast<int*>(context); }, &paces).has_value());
+    cr_assert(instrumentedOutputs.writeSequence(values, [](void* context) { ++*static_cast<int*>(context); }, &paces).has_value());
+    cr_assert_eq(paces, 7);
+    cr_assert_eq(samples[3].to_ulong(), 0b10u);
+    cr_assert_eq(bank.getLatch(0), 0x00u);
+    const cmspk::iopins::PinStatistics& inputStatistics = instrumentedInputs.getInstrumentation().getStatistics();
+    cr_assert_eq(inputStatistics.getOperationCount(cmspk::iopins::PIN_OPERATION_READ), 1u);
+    cr_assert_eq(inputStatistics.getOperationCount(cmspk::iopins::PIN_OPERATION_READ_BURST), 1u);
+    const cmspk::iopins::PinStatistics& outputStatistics = instrumentedOutputs.getInstrumentation().getStatistics();
+    cr_assert_eq(outputStatistics.getOperationCount(cmspk::iopins::PIN_OPERATION_WRITE), 1u);
+    cr_assert_eq(outputStatistics.getOperationCount(cmspk::iopins::PIN_OPERATION_WRITE_BURST), 1u);
+
+    // failures are counted
+    bank.setDirection(0, 3, IoDirection::READ);
+    cr_assert_not(instrumentedOutputs.writeSequence(values).has_value());
+    cr_assert_eq(outputStatistics.getFailureCount(IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE), 1u);
+    cr_assert_eq(outputStatistics.getOperationCount(cmspk::iopins::PIN_OPERATION_WRITE_BURST), 2u);
+}
+
+Test(PinInstrumentation, registry_takes_a_snapshot_of_all_the_pins) {
+    TestInstrumentation hot;
+    TestInstrumentation cold;
+    TestInstrumentation extra;
+    cmspk::iopins::InstrumentationRegistry<2> registry;
+    cr_assert(registry.add("HOT", hot));
+    cr_assert(registry.add("COLD", cold));
+    cr_assert_not(registry.add("EXTRA", extra));
+    cr_assert_eq(registry.size(), 2u);
+
+    for (int i = 0; i < 10; ++i) {
+        hot.record(cmspk::iopins::PIN_OPERATION_READ, 1);
+    }
+    cold.record(cmspk::iopins::PIN_OPERATION_WRITE, 100);
+    cold.recordFailure(IoFailureReason::FAILURE_TIMEOUT);
+
+    std::array<cmspk::iopins::PinStatisticsSnapshot, 4> snapshots;
+    cr_assert_eq(registry.snapshot(snapshots), 2u);
+    cr_assert(std::string_view(snapshots[0].name) == "HOT");
+    cr_assert_eq(snapshots[0].statistics.getTotalOperationCount(), 10u);
+    cr_assert_eq(snapshots[1].statistics.getFailureCount(IoFailureReason::FAILURE_TIMEOUT), 1u);
+    cr_assert_eq(snapshots[1].statistics.getLatencies()[7], 1u);
+
+    // the snapshot is a copy
+    registry.resetAll();
+    cr_assert_eq(hot.getTotalOperationCount(), 0u);
+    cr_assert_eq(snapshots[0].statistics.getTotalOperationCount(), 10u);
+}
@@ -0,0 +1,96 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+Test(PortExpander, writes_are_coalesced_inside_a_batch) {
+    cmspk::iopins::SimulatedPortExpander expander;
+    cr_assert(expander.setOutputMask(0x00ff).has_value());
+    cr_assert_eq(expander.getDirectionRegister(), 0x00ffu);
+    cr_assert(expander.checkWritable(0x0081).has_value());
+    cr_assert_eq(expander.checkWritable(0x0100).error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+    cr_assert_eq(expander.checkReadable(0x0001).error(), IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+    expander.resetCounters();
+
+    // without batch, each write is a transfer
+    cr_assert(expander.writeBits(0x0001, 0x0001).has_value());
+    cr_assert(expander.writeBits(0x0002, 0x0002).has_value());
+    cr_assert_eq(expander.getWriteCount(), 2u);
+    cr_assert_eq(expander.getOutputRegister(), 0x0003u);
+
+    // nested batches, one transfer at the outermost commit
+    expander.beginBatch();
+    cr_assert(expander.writeBits(0x0010, 0x0010).has_value());
+    expander.beginBatch();
+    cr_assert(expander.writeBits(0x0001, 0x0000).has_value());
+    cr_assert(expander.commit().has_value());
+    cr_assert(expander.writeBits(0x0020, 0x0020).has_value());
+    cr_assert(expander.isBatching());
+    cr_assert(expander.isPending());
+    cr_assert_eq(expander.getOutputImage(), 0x0032u);
+    cr_assert_eq(expander.getWriteCount(), 2u);
+    cr_assert(expander.commit().has_value());
+    cr_assert_not(expander.isBatching());
+    cr_assert_not(expander.isPending());
+    cr_assert_eq(expander.getWriteCount(), 3u);
+    cr_assert_eq(expander.getOutputRegister(), 0x0032u);
+
+    // a batch that changes nothing does not transfer
+    expander.beginBatch();
+    cr_assert(expander.writeBits(0x0010, 0x0000).has_value());
+    cr_assert(expander.writeBits(0x0010, 0x0010).has_value());
+    cr_assert(expander.commit().has_value());
+    cr_assert_eq(expander.getWriteCount(), 3u);
+}
+
+Test(PortExpander, failed_commit_stays_pending) {
+    cmspk::iopins::SimulatedPortExpander expander;
+    cr_assert(expander.setOutputMask(0xffff).has_value());
+    expander.beginBatch();
+    cr_assert(expander.writeBits(0x8000, 0x8000).has_value());
+    expander.setFailing(true);
+    auto commitResult = expander.commit();
+    cr_assert_not(commitResult.has_value());
+    cr_assert_eq(commitResult.error(), IoFailureReason::FAILURE_NO_ACKNOWLEDGE);
+    cr_assert_not(expander.isBatching());
+    cr_assert(expander.isPending());
+
+    // the next commit retries
+    expander.setFailing(false);
+    cr_assert(expander.commit().has_value());
+    cr_assert_not(expander.isPending());
+    cr_assert_eq(expander.getOutputRegister(), 0x8000u);
+
+    // the direction register is kept when the transfer fails
+    expander.setFailing(true);
+    cr_assert_not(expander.setOutputMask(0).has_value());
+    cr_assert_eq(expander.getOutputMask(), 0xffffu);
+}
+
+Test(PortExpander, reads_share_a_snapshot_inside_a_batch) {
+    cmspk::iopins::SimulatedPortExpander expander;
+    expander.drive(0x1234);
+    cr_assert_eq(expander.readInputs().value(), 0x1234u);
+    cr_assert_eq(expander.readInputs().value(), 0x1234u);
+    cr_assert_eq(expander.getReadCount(), 2u);
+
+    expander.beginBatch();
+    cr_assert_eq(expander.readInputs().value(), 0x1234u);
+    expander.drive(0x4321);
+    cr_assert_eq(expander.readInputs().value(), 0x1234u);
+    cr_assert_eq(expander.getReadCount(), 3u);
+    expander.invalidateSnapshot();
+    cr_assert_eq(expander.readInputs().value(), 0x4321u);
+    cr_assert_eq(expander.getReadCount(), 4u);
+    cr_assert(expander.commit().has_value());
+
+    // the snapshot is forgotten after the batch
+    expander.drive(0x0f0f);
+    cr_assert_eq(expander.readInputs().value(), 0x0f0fu);
+    cr_assert_eq(expander.getReadCount(), 5u);
+}
@@ -0,0 +1,81 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+class ConcretePortInputPinQuartet final : public cmspk::iopins::PortInputPinGroup<4> {
+  public:
+    ~ConcretePortInputPinQuartet() {}
+    ConcretePortInputPinQuartet(std::array<uint8_t, 4> indices, uint32_t* port) : cmspk::iopins::PortInputPinGroup<4>(indices), port(port) {}
+    bool readable = true;
+
+  private:
+    uint32_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<uint32_t, IoFailureReason> doReadPort() noexcept {
+        if (!readable) {
+            return std::unexpected(IoFailureReason::FAILURE);
+        }
+        return *port;
+    }
+};
+// ================[END typical specialization]==================
+
+Test(PortInputPinGroup, can_read_scattered_pins_of_a_port) {
+    uint32_t mockPort{0};
+    ConcretePortInputPinQuartet p({7, 2, 3, 16}, &mockPort);
+
+    // verify predicates
+    cr_assert(p.isReadable());
+    cr_assert(p.isNotWritable());
+
+    // verify ids and plan
+    cr_assert_eq(p.getPinIds()[0], 7);
+    cr_assert_eq(p.getPinIds()[3], 16);
+    cr_assert_eq(p.getGatherPlan().getMask(), 0x1008cu);
+    cr_assert_eq(p.getGatherPlan().getStepCount(), 3);
+
+    // verify read
+    mockPort = 0x10084;  // pins 16, 7 and 2 are high
+    auto readResult = p.read();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value().to_ulong(), 0b1011u);
+
+    // verify read to get another value
+    mockPort = 0xfffeffb7;  // pins 16 and 3 are low
+    readResult = p.read();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value().to_ulong(), 0b0011u);
+
+    // verify failure of the port read
+    p.readable = false;
+    readResult = p.read();
+    cr_assert_not(readResult.has_value());
+    cr_assert_eq(readResult.error(), IoFailureReason::FAILURE);
+}
+
+Test(PortInputPinGroup, can_use_a_precomputed_plan) {
+    static constexpr std::array<uint8_t, 4> lowNibbleIds{0, 1, 2, 3};
+    static constexpr cmspk::iopins::BitGatherPlan<4> lowNibblePlan(lowNibbleIds);
+    uint32_t mockPort{0xa5};
+    class PrecomputedGroup final : public cmspk::iopins::PortInputPinGroup<4> {
+      public:
+        PrecomputedGroup(uint32_t* port) : cmspk::iopins::PortInputPinGroup<4>(lowNibbleIds, lowNibblePlan), port(port) {}
+
+      private:
+        uint32_t* port;
+        virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+        virtual std::expected<uint32_t, IoFailureReason> doReadPort() noexcept { return *port; }
+    } p(&mockPort);
+
+    auto readResult = p.read();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value().to_ulong(), 0x5u);
+}
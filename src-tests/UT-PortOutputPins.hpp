@@ -0,0 +1,74 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+Test(PortOutputPins, pins_write_their_bit_of_the_port) {
+    cmspk::iopins::SimulatedPinBank bank(2);
+    bank.setDirections(1, 0x00ffu, IoDirection::WRITE);
+    cmspk::iopins::SimulatedOutputPort port(bank, 1);
+    cmspk::iopins::PortOutputPin pin(port, 3);
+    cmspk::iopins::PortLogicOutputPin led(port, 4, LogicIoPinSetting::ACTIVE_LOW);
+    cr_assert_eq(pin.getPinId(), 3);
+    cr_assert_eq(&pin.getPort(), &port);
+
+    cr_assert(pin.write(true).has_value());
+    cr_assert(led.toAsserted().has_value());
+    cr_assert_eq(bank.getLatch(1), 0x08u);
+    cr_assert(led.toNegated().has_value());
+    cr_assert_eq(bank.getLatch(1), 0x18u);
+    cr_assert_eq(bank.getWriteCount(1), 3u);
+
+    // not an output
+    cmspk::iopins::PortOutputPin input(port, 9);
+    auto result = input.write(true);
+    cr_assert_not(result.has_value());
+    cr_assert_eq(result.error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+    cr_assert_eq(bank.getWriteCount(1), 3u);
+
+    // beyond the width of the port
+    cmspk::iopins::PortOutputPin outside(port, 32);
+    cmspk::iopins::PortLogicOutputPin farOutside(port, 200);
+    cr_assert_eq(outside.write(true).error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+    cr_assert_eq(farOutside.toAsserted().error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+    cr_assert_eq(bank.getWriteCount(1), 3u);
+}
+
+Test(PortOutputPins, transaction_updates_all_the_pins_of_a_port_at_once) {
+    cmspk::iopins::SimulatedPinBank bank(2);
+    bank.setDirections(0, 0x00ffu, IoDirection::WRITE);
+    bank.setDirections(1, 0x00ffu, IoDirection::WRITE);
+    cmspk::iopins::SimulatedOutputPort port0(bank, 0);
+    cmspk::iopins::SimulatedOutputPort port1(bank, 1);
+    cmspk::iopins::PortOutputPin red(port0, 0);
+    cmspk::iopins::PortOutputPin green(port0, 1);
+    cmspk::iopins::PortLogicOutputPin enable(port1, 2, LogicIoPinSetting::ACTIVE_LOW);
+    cmspk::iopins::PortLogicOutputPin strobe(port1, 3);
+
+    cmspk::iopins::OutputTransaction transaction{port0, port1};
+    red.write(true);
+    green.write(true);
+    enable.toAsserted();
+    strobe.toAsserted();
+    strobe.toNegated();
+    cr_assert_eq(bank.getWriteCount(0) + bank.getWriteCount(1), 0u);
+
+    cr_assert(transaction.commit().has_value());
+    cr_assert_eq(bank.getWriteCount(0), 1u);
+    cr_assert_eq(bank.getWriteCount(1), 1u);
+    cr_assert_eq(bank.getLatch(0), 0x03u);
+    cr_assert_eq(bank.getLatch(1), 0x00u);
+
+    // the next step of the state machine only changes port 0
+    red.write(false);
+    enable.toAsserted();
+    cr_assert(transaction.commit().has_value());
+    cr_assert_eq(bank.getWriteCount(0), 2u);
+    cr_assert_eq(bank.getWriteCount(1), 1u);
+    cr_assert_eq(bank.getLatch(0), 0x02u);
+}
@@ -0,0 +1,34 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+template <std::size_t N>
+std::vector<std::size_t> collectSetBits(const std::bitset<N>& bits) {
+    std::vector<std::size_t> indices;
+    for (std::size_t index : cmspk::iopins::SetBitRange<N>(bits)) {
+        indices.push_back(index);
+    }
+    return indices;
+}
+
+Test(SetBitRange, iterates_over_set_bits_in_increasing_order) {
+    cr_assert(cmspk::iopins::SetBitRange<8>(0).empty());
+    cr_assert(collectSetBits<8>(0).empty());
+    cr_assert_eq(collectSetBits<8>(0b10010110), (std::vector<std::size_t>{1, 2, 4, 7}));
+    cr_assert_eq(collectSetBits<64>(0x8000000000000001ull), (std::vector<std::size_t>{0, 63}));
+
+    // wider than a word, with an empty word in between
+    std::bitset<200> wide;
+    wide.set(3).set(64).set(130).set(199);
+    cr_assert_not(cmspk::iopins::SetBitRange<200>(wide).empty());
+    cr_assert_eq(collectSetBits<200>(wide), (std::vector<std::size_t>{3, 64, 130, 199}));
+    wide.reset();
+    wide.set(150);
+    cr_assert_eq(collectSetBits<200>(wide), (std::vector<std::size_t>{150}));
+}
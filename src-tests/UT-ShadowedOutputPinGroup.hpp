@@ -0,0 +1,69 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+class ConcreteShadowedOutputPinQuartet final : public cmspk::iopins::ShadowedOutputPinGroup<4> {
+  public:
+    ~ConcreteShadowedOutputPinQuartet() {}
+    ConcreteShadowedOutputPinQuartet(std::array<uint8_t, 4> indices, uint8_t* port) : cmspk::iopins::ShadowedOutputPinGroup<4>(indices), port(port) {}
+    int portWrites = 0;
+    std::bitset<4> lastSetMask;
+    std::bitset<4> lastClearMask;
+
+  private:
+    uint8_t* port;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<void, IoFailureReason> doWriteMasks(const std::bitset<4> setMask, const std::bitset<4> clearMask) noexcept {
+        ++portWrites;
+        lastSetMask = setMask;
+        lastClearMask = clearMask;
+        (*port) = ((*port) | setMask.to_ulong()) & ~clearMask.to_ulong();
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[END typical specialization]==================
+
+Test(ShadowedOutputPinGroup, only_changed_pins_are_written) {
+    uint8_t mockPort{0xf0};
+    ConcreteShadowedOutputPinQuartet p({0, 1, 2, 3}, &mockPort);
+    cr_assert_not(p.isShadowValid());
+
+    // first write updates every pin
+    auto writeResult = p.write(0b0101);
+    cr_assert(writeResult.has_value());
+    cr_assert_eq(p.portWrites, 1);
+    cr_assert_eq(p.lastSetMask.to_ulong(), 0b0101u);
+    cr_assert_eq(p.lastClearMask.to_ulong(), 0b1010u);
+    cr_assert_eq(mockPort, 0xf5);
+    cr_assert(p.isShadowValid());
+    cr_assert_eq(p.getShadow().to_ulong(), 0b0101u);
+
+    // same value is not written
+    writeResult = p.write(0b0101);
+    cr_assert(writeResult.has_value());
+    cr_assert_eq(p.portWrites, 1);
+
+    // only the delta is written
+    writeResult = p.write(0b0110);
+    cr_assert(writeResult.has_value());
+    cr_assert_eq(p.portWrites, 2);
+    cr_assert_eq(p.lastSetMask.to_ulong(), 0b0010u);
+    cr_assert_eq(p.lastClearMask.to_ulong(), 0b0001u);
+    cr_assert_eq(mockPort, 0xf6);
+
+    // invalidation forces a full update
+    p.invalidateShadow();
+    writeResult = p.write(0b0110);
+    cr_assert(writeResult.has_value());
+    cr_assert_eq(p.portWrites, 3);
+    cr_assert_eq(p.lastSetMask.to_ulong(), 0b0110u);
+    cr_assert_eq(p.lastClearMask.to_ulong(), 0b1001u);
+}
@@ -0,0 +1,71 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+/**
+ * Bare bus driver, to check the target without the I2C master.
+ */
+struct RawI2cBus {
+    cmspk::iopins::SimulatedPinBank& bank;
+
+    void line(uint8_t bit, bool level) { bank.setDirection(0, bit, level ? IoDirection::READ : IoDirection::WRITE); }
+    void clockPulse() {
+        line(0, true);
+        line(0, false);
+    }
+    void start() {
+        line(1, false);
+        line(0, false);
+    }
+    bool sendByte(uint8_t value) {
+        for (int i = 7; i >= 0; --i) {
+            line(1, (value >> i) & 1u);
+            clockPulse();
+        }
+        line(1, true);
+        line(0, true);
+        bool acknowledged = !bank.getLevel(0, 1);
+        line(0, false);
+        return acknowledged;
+    }
+};
+// ================[END typical specialization]==================
+
+Test(SimulatedI2cTarget, acknowledges_only_its_address) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    cmspk::iopins::SimulatedI2cTarget target(bank, 0, 0, 1, 0x42);
+    // the pull-ups of the bus
+    cr_assert_eq(bank.getPull(0, 0), cmspk::iopins::SimulatedPull::PULL_UP);
+    cr_assert_eq(bank.getPull(0, 1), cmspk::iopins::SimulatedPull::PULL_UP);
+    RawI2cBus bus{bank};
+
+    bus.start();
+    cr_assert_eq(target.getStartCount(), 1u);
+    cr_assert_not(bus.sendByte(0x43 << 1));
+
+    bus.line(1, true);
+    bus.line(0, true);
+    bus.start();
+    cr_assert_eq(target.getStartCount(), 2u);
+    cr_assert(bus.sendByte(0x42 << 1));
+    cr_assert(bus.sendByte(0x05));
+    cr_assert(bus.sendByte(0x99));
+    cr_assert_eq(target.getRegister(0x05), 0x99);
+}
+
+Test(SimulatedI2cTarget, unregisters_from_the_bank) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    {
+        cmspk::iopins::SimulatedI2cTarget target(bank, 0, 0, 1, 0x42);
+    }
+    // no listener left to call
+    bank.readPort(0);
+    cr_assert_eq(bank.getReadCount(0), 1u);
+}
@@ -0,0 +1,102 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+using cmspk::iopins::SimulatedPinBank;
+using cmspk::iopins::SimulatedPull;
+
+Test(SimulatedPinBank, level_depends_on_direction_drive_and_pull) {
+    SimulatedPinBank bank(3);
+    cr_assert_eq(bank.getPortCount(), 3);
+
+    // floating input reads low, pull up reads high
+    cr_assert_eq(bank.getDirection(1, 4), IoDirection::READ);
+    cr_assert_eq(bank.getPull(1, 4), SimulatedPull::PULL_NONE);
+    cr_assert_not(bank.getLevel(1, 4));
+    bank.setPull(1, 4, SimulatedPull::PULL_UP);
+    cr_assert_eq(bank.getPull(1, 4), SimulatedPull::PULL_UP);
+    cr_assert(bank.getLevel(1, 4));
+
+    // the outside world wins over the pull
+    bank.drive(1, 4, false);
+    cr_assert_not(bank.getLevel(1, 4));
+    bank.release(1, 1u << 4);
+    cr_assert(bank.getLevel(1, 4));
+
+    // the output latch wins over everything
+    bank.setDirection(1, 4, IoDirection::WRITE);
+    bank.drive(1, 4, true);
+    cr_assert_not(bank.getLevel(1, 4));
+    bank.writePort(1, 1u << 4, 0xffffffffu);
+    cr_assert(bank.getLevel(1, 4));
+    cr_assert_eq(bank.getLatch(1), 1u << 4);
+    bank.writeMasks(1, 0x3, 1u << 4);
+    cr_assert_eq(bank.getLatch(1), 0x3u);
+    cr_assert_eq(bank.getLevels(1), 0u);  // pins 0 and 1 are not outputs
+
+    // back to high impedance
+    bank.setPull(1, 4, SimulatedPull::PULL_DOWN);
+    bank.release(1, 1u << 4);
+    bank.setDirection(1, 4, IoDirection::HIGH_Z);
+    cr_assert_eq(bank.getDirection(1, 4), IoDirection::HIGH_Z);
+    cr_assert_eq(bank.getPull(1, 4), SimulatedPull::PULL_DOWN);
+    cr_assert_not(bank.getLevel(1, 4));
+}
+
+Test(SimulatedPinBank, accesses_are_counted_and_advance_the_clock) {
+    SimulatedPinBank bank(2);
+    cr_assert_eq(bank.now(), 0u);
+    bank.readPort(0);
+    bank.readPort(0);
+    bank.writePort(1, 1, 1);
+    bank.writeMasks(1, 0, 1);
+    cr_assert_eq(bank.getReadCount(0), 2u);
+    cr_assert_eq(bank.getWriteCount(0), 0u);
+    cr_assert_eq(bank.getWriteCount(1), 2u);
+    cr_assert_eq(bank.now(), 4u);
+    bank.advance(10);
+    cr_assert_eq(bank.now(), 14u);
+    bank.resetCounters();
+    cr_assert_eq(bank.getReadCount(0), 0u);
+    cr_assert_eq(bank.getWriteCount(1), 0u);
+}
+
+Test(SimulatedPinBank, readability_and_writability_follow_directions) {
+    SimulatedPinBank bank(1);
+    bank.setDirections(0, 0x0f, IoDirection::WRITE);
+    bank.setDirection(0, 7, IoDirection::HIGH_Z);
+    cr_assert(bank.checkReadable(0, 0x30).has_value());
+    cr_assert_eq(bank.checkReadable(0, 0x11).error(), IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+    cr_assert_eq(bank.checkReadable(0, 0x80).error(), IoFailureReason::FAILURE_PIN_IS_DISABLED);
+    cr_assert(bank.checkWritable(0, 0x0f).has_value());
+    cr_assert_eq(bank.checkWritable(0, 0x1f).error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+    cr_assert_eq(bank.checkWritable(0, 0x81).error(), IoFailureReason::FAILURE_PIN_IS_DISABLED);
+}
+
+Test(SimulatedPinBank, listener_follows_the_micro_controller_accesses) {
+    SimulatedPinBank bank(1);
+    int calls = 0;
+    bank.setListener([](void* context) { ++(*static_cast<int*>(context)); }, &calls);
+
+    // outside world and accessors do not notify
+    bank.drive(0, 1, true);
+    bank.release(0, 1u << 1);
+    bank.getLevels(0);
+    cr_assert_eq(calls, 0);
+
+    bank.setDirection(0, 1, IoDirection::WRITE);
+    bank.writePort(0, 1u << 1, 1u << 1);
+    bank.writeMasks(0, 0, 1u << 1);
+    bank.readPort(0);
+    cr_assert_eq(calls, 4);
+
+    bank.setListener(nullptr, nullptr);
+    bank.readPort(0);
+    cr_assert_eq(calls, 4);
+}
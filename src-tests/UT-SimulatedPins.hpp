@@ -0,0 +1,155 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+Test(SimulatedPins, single_pins_are_bound_to_the_bank) {
+    cmspk::iopins::SimulatedPinBank bank(2);
+    cmspk::iopins::SimulatedInputPin input(bank, 1, 3);
+    cmspk::iopins::SimulatedOutputPin output(bank, 1, 5);
+    cmspk::iopins::SimulatedLogicInputPin logicInput(bank, 0, 0, LogicIoPinSetting::ACTIVE_LOW);
+    cmspk::iopins::SimulatedLogicOutputPin logicOutput(bank, 0, 1, LogicIoPinSetting::ACTIVE_LOW);
+    cr_assert_eq(input.getPinId(), 3);
+    cr_assert_eq(input.getPort(), 1u);
+
+    // the output pin is not writable until configured
+    auto writeResult = output.write(true);
+    cr_assert_not(writeResult.has_value());
+    cr_assert_eq(writeResult.error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+    bank.setDirection(1, 5, IoDirection::WRITE);
+    bank.setDirection(0, 1, IoDirection::WRITE);
+    cr_assert(output.write(true).has_value());
+    cr_assert(bank.getLevel(1, 5));
+    cr_assert(logicOutput.toAsserted().has_value());
+    cr_assert_not(bank.getLevel(0, 1));
+
+    // inputs
+    bank.drive(1, 3, true);
+    auto readResult = input.read();
+    cr_assert(readResult.has_value());
+    cr_assert(readResult.value());
+    bank.setPull(0, 0, cmspk::iopins::SimulatedPull::PULL_UP);
+    cr_assert(logicInput.isNegated());
+    bank.drive(0, 0, false);
+    cr_assert(logicInput.isAsserted());
+
+    // disabled pin
+    bank.setDirection(1, 3, IoDirection::HIGH_Z);
+    readResult = input.read();
+    cr_assert_not(readResult.has_value());
+    cr_assert_eq(readResult.error(), IoFailureReason::FAILURE_PIN_IS_DISABLED);
+}
+
+Test(SimulatedPins, pins_beyond_the_width_of_the_port_are_rejected) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    bank.setDirections(0, 0xffffffffu, IoDirection::WRITE);
+    cmspk::iopins::SimulatedInputPin input(bank, 0, 32);
+    cmspk::iopins::SimulatedOutputPin output(bank, 0, 32);
+    cmspk::iopins::SimulatedLogicInputPin logicInput(bank, 0, 40);
+    cmspk::iopins::SimulatedLogicOutputPin logicOutput(bank, 0, 200);
+    cmspk::iopins::SimulatedIoPin io(bank, 0, 32);
+    cmspk::iopins::SimulatedOpenDrainPin line(bank, 0, 32);
+
+    cr_assert_eq(input.read().error(), IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+    cr_assert_eq(logicInput.read().error(), IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+    cr_assert_eq(output.write(true).error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+    cr_assert_eq(logicOutput.toAsserted().error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+    cr_assert_eq(io.setDirection(IoDirection::READ).error(), IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+    cr_assert_eq(io.setDirection(IoDirection::WRITE).error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+    cr_assert_not(io.read().has_value());
+    cr_assert_not(io.write(true).has_value());
+    cr_assert_eq(line.release().error(), IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+    cr_assert_eq(line.driveLow().error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+    cr_assert_eq(line.read().error(), IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+    cr_assert_eq(bank.getReadCount(0), 0u);
+    cr_assert_eq(bank.getWriteCount(0), 0u);
+    cr_assert_eq(bank.getLatch(0), 0u);
+}
+
+Test(SimulatedPins, groups_access_their_port_once) {
+    cmspk::iopins::SimulatedPinBank bank(4);
+    cmspk::iopins::SimulatedInputPinGroup<3> inputs(bank, 2, {7, 0, 15});
+    cmspk::iopins::SimulatedOutputPinGroup<3> outputs(bank, 3, {31, 8, 9});
+    bank.setDirections(3, 0x80000300u, IoDirection::WRITE);
+
+    bank.drive(2, 0x8081u, 0x8080u);
+    auto readResult = inputs.read();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value().to_ulong(), 0b101u);
+    cr_assert_eq(bank.getReadCount(2), 1u);
+
+    cr_assert(outputs.write(0b011).has_value());
+    cr_assert_eq(bank.getLatch(3), 0x80000100u);
+    cr_assert_eq(bank.getWriteCount(3), 1u);
+
+    // not all pins are outputs
+    bank.setDirection(3, 8, IoDirection::READ);
+    auto writeResult = outputs.write(0b111);
+    cr_assert_not(writeResult.has_value());
+    cr_assert_eq(writeResult.error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+    cr_assert_eq(bank.getWriteCount(3), 1u);
+}
+
+Test(SimulatedPins, open_drain_pins_make_a_wired_and_line) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    bank.setPull(0, 4, cmspk::iopins::SimulatedPull::PULL_UP);
+    bank.writePort(0, 1u << 4, 1u << 4);
+    cmspk::iopins::SimulatedOpenDrainPin line(bank, 0, 4);
+
+    cr_assert(line.release().has_value());
+    cr_assert_eq(bank.getDirection(0, 4), IoDirection::READ);
+    auto readResult = line.read();
+    cr_assert(readResult.has_value());
+    cr_assert(readResult.value());
+
+    // another device pulls the line low
+    bank.drive(0, 4, false);
+    cr_assert_not(line.read().value());
+    bank.release(0, 1u << 4);
+
+    // driving low clears the latch that was high
+    cr_assert(line.driveLow().has_value());
+    cr_assert_eq(bank.getDirection(0, 4), IoDirection::WRITE);
+    cr_assert_eq(bank.getLatch(0), 0u);
+    cr_assert_not(line.read().value());
+
+    cr_assert(line.disable().has_value());
+    readResult = line.read();
+    cr_assert_not(readResult.has_value());
+    cr_assert_eq(readResult.error(), IoFailureReason::FAILURE_PIN_IS_DISABLED);
+}
+
+Test(SimulatedPins, bursts_check_the_pins_once) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    cmspk::iopins::SimulatedOutputPinGroup<2> outputs(bank, 0, {4, 5});
+    cmspk::iopins::SimulatedInputPinGroup<2> inputs(bank, 0, {4, 5});
+    const std::array<std::bitset<2>, 3> values{0b01, 0b10, 0b11};
+
+    // not writable, nothing is written
+    auto writeResult = outputs.writeSequence(values);
+    cr_assert_not(writeResult.has_value());
+    cr_assert_eq(writeResult.error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+    cr_assert_eq(bank.getWriteCount(0), 0u);
+
+    bank.setDirections(0, 0x30u, IoDirection::WRITE);
+    cr_assert(outputs.writeSequence(values).has_value());
+    cr_assert_eq(bank.getWriteCount(0), 3u);
+    cr_assert_eq(bank.getLatch(0), 0x30u);
+
+    // one port read per sample
+    bank.setDirections(0, 0x30u, IoDirection::READ);
+    bank.drive(0, 0x30u, 0x20u);
+    std::array<std::bitset<2>, 4> samples;
+    cr_assert(inputs.readSamples(samples).has_value());
+    cr_assert_eq(bank.getReadCount(0), 4u);
+    cr_assert_eq(samples[3].to_ulong(), 0b10u);
+    bank.setDirections(0, 0x30u, IoDirection::HIGH_Z);
+    auto readResult = inputs.readSamples(samples);
+    cr_assert_not(readResult.has_value());
+    cr_assert_eq(readResult.error(), IoFailureReason::FAILURE_PIN_IS_DISABLED);
+}
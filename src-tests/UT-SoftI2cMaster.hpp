@@ -0,0 +1,112 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+Test(SoftI2cMaster, writes_then_reads_registers) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    cmspk::iopins::SimulatedI2cTarget target(bank, 0, 0, 1, 0x42);
+    cmspk::iopins::SimulatedOpenDrainPin scl(bank, 0, 0);
+    cmspk::iopins::SimulatedOpenDrainPin sda(bank, 0, 1);
+    cmspk::iopins::SoftI2cMaster i2c(scl, sda);
+
+    const std::array<uint8_t, 3> values{0xde, 0xad, 0x5a};
+    cr_assert(i2c.writeRegisters(0x42, 0x10, values).has_value());
+    cr_assert_eq(target.getRegister(0x10), 0xde);
+    cr_assert_eq(target.getRegister(0x11), 0xad);
+    cr_assert_eq(target.getRegister(0x12), 0x5a);
+    cr_assert_eq(target.getStartCount(), 1u);
+    cr_assert_eq(target.getStopCount(), 1u);
+
+    // reading uses a repeated start
+    std::array<uint8_t, 2> readValues{};
+    cr_assert(i2c.readRegisters(0x42, 0x11, readValues).has_value());
+    cr_assert_eq(readValues[0], 0xad);
+    cr_assert_eq(readValues[1], 0x5a);
+    cr_assert_eq(target.getStartCount(), 3u);
+    cr_assert_eq(target.getStopCount(), 2u);
+
+    // the bus is released
+    cr_assert(bank.getLevel(0, 0));
+    cr_assert(bank.getLevel(0, 1));
+}
+
+Test(SoftI2cMaster, plain_reads_and_writes) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    cmspk::iopins::SimulatedI2cTarget target(bank, 0, 0, 1, 0x42);
+    cmspk::iopins::SimulatedOpenDrainPin scl(bank, 0, 0);
+    cmspk::iopins::SimulatedOpenDrainPin sda(bank, 0, 1);
+    cmspk::iopins::SoftI2cMaster i2c(scl, sda);
+
+    // the first byte written is the register address
+    const std::array<uint8_t, 2> values{0x20, 0x81};
+    cr_assert(i2c.write(0x42, values).has_value());
+    cr_assert_eq(target.getRegister(0x20), 0x81);
+
+    // a plain read goes on from the current register address
+    target.setRegister(0x21, 0x7e);
+    std::array<uint8_t, 1> readValues{};
+    cr_assert(i2c.read(0x42, readValues).has_value());
+    cr_assert_eq(readValues[0], 0x7e);
+}
+
+Test(SoftI2cMaster, delay_is_called_after_each_change_of_a_line_with_its_context) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    cmspk::iopins::SimulatedI2cTarget target(bank, 0, 0, 1, 0x42);
+    cmspk::iopins::SimulatedOpenDrainPin scl(bank, 0, 0);
+    cmspk::iopins::SimulatedOpenDrainPin sda(bank, 0, 1);
+    int delays = 0;
+    cmspk::iopins::SoftI2cMaster i2c(scl, sda, cmspk::iopins::SoftI2cMaster::DEFAULT_STRETCH_TIMEOUT, [](void* context) { ++*static_cast<int*>(context); },
+                                     &delays);
+
+    // start : data high, clock high, data low, clock low ; stop : data low, clock high, data high
+    cr_assert(i2c.start().has_value());
+    cr_assert_eq(delays, 4);
+    cr_assert(i2c.stop().has_value());
+    cr_assert_eq(delays, 7);
+    cr_assert_eq(target.getStopCount(), 1u);
+}
+
+Test(SoftI2cMaster, absent_target_is_not_acknowledged) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    cmspk::iopins::SimulatedI2cTarget target(bank, 0, 0, 1, 0x42);
+    cmspk::iopins::SimulatedOpenDrainPin scl(bank, 0, 0);
+    cmspk::iopins::SimulatedOpenDrainPin sda(bank, 0, 1);
+    cmspk::iopins::SoftI2cMaster i2c(scl, sda);
+
+    const std::array<uint8_t, 1> values{0x01};
+    auto result = i2c.writeRegisters(0x43, 0x00, values);
+    cr_assert_not(result.has_value());
+    cr_assert_eq(result.error(), IoFailureReason::FAILURE_NO_ACKNOWLEDGE);
+    cr_assert_eq(target.getRegister(0x00), 0x00);
+    // the bus is released anyway
+    cr_assert_eq(target.getStopCount(), 1u);
+    cr_assert(bank.getLevel(0, 1));
+}
+
+Test(SoftI2cMaster, waits_for_a_stretched_clock) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    cmspk::iopins::SimulatedI2cTarget target(bank, 0, 0, 1, 0x42);
+    cmspk::iopins::SimulatedOpenDrainPin scl(bank, 0, 0);
+    cmspk::iopins::SimulatedOpenDrainPin sda(bank, 0, 1);
+    target.setClockStretching(10);
+
+    cmspk::iopins::SoftI2cMaster i2c(scl, sda);
+    const std::array<uint8_t, 2> values{0x12, 0x34};
+    cr_assert(i2c.writeRegisters(0x42, 0x80, values).has_value());
+    cr_assert_eq(target.getRegister(0x80), 0x12);
+    cr_assert_eq(target.getRegister(0x81), 0x34);
+    // address, register and 2 values
+    cr_assert_eq(target.getStretchCount(), 4u);
+
+    // a short timeout gives up
+    cmspk::iopins::SoftI2cMaster impatient(scl, sda, 5);
+    auto result = impatient.writeRegisters(0x42, 0x80, values);
+    cr_assert_not(result.has_value());
+    cr_assert_eq(result.error(), IoFailureReason::FAILURE_TIMEOUT);
+}
@@ -0,0 +1,220 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+/**
+ * Shift register of a SPI target, receiving the bits sent by the master and sending the bits of its response.
+ */
+struct FakeSpiTarget {
+    bool cpol = false;
+    bool cpha = false;
+    bool sck = false;
+    bool mosi = false;
+    bool miso = false;
+    std::vector<bool> received;
+    std::vector<bool> response;
+    std::size_t next = 0;
+    int sckWrites = 0;
+    int mosiWrites = 0;
+
+    FakeSpiTarget(cmspk::iopins::SpiMode mode, std::vector<bool> response)
+        : cpol(cmspk::iopins::SPI_MODE_2 == mode || cmspk::iopins::SPI_MODE_3 == mode),
+          cpha(cmspk::iopins::SPI_MODE_1 == mode || cmspk::iopins::SPI_MODE_3 == mode), response(response) {
+        // chip select : the clock is idle, with CPHA = 0 the first bit MUST be ready before the first edge
+        sck = cpol;
+        if (!cpha) {
+            shiftOut();
+        }
+    }
+
+    void shiftOut() {
+        if (next < response.size()) {
+            miso = response[next++];
+        }
+    }
+
+    void clock(bool level) {
+        ++sckWrites;
+        if (level == sck) {
+            return;
+        }
+        bool leading = (sck == cpol);
+        sck = level;
+        if (leading != cpha) {
+            received.push_back(mosi);
+        } else {
+            shiftOut();
+        }
+    }
+};
+
+class FakeSpiClockPin final : public BinaryOutputPin {
+  public:
+    FakeSpiClockPin(FakeSpiTarget& target) : BinaryOutputPin(0), target(target) {}
+
+  private:
+    FakeSpiTarget& target;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<void, IoFailureReason> doWrite(const bool value) noexcept {
+        target.clock(value);
+        return std::expected<void, IoFailureReason>();
+    }
+};
+
+class FakeSpiDataOutPin final : public BinaryOutputPin {
+  public:
+    FakeSpiDataOutPin(FakeSpiTarget& target) : BinaryOutputPin(1), target(target) {}
+
+  private:
+    FakeSpiTarget& target;
+
+    virtual std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<void, IoFailureReason> doWrite(const bool value) noexcept {
+        ++target.mosiWrites;
+        target.mosi = value;
+        return std::expected<void, IoFailureReason>();
+    }
+};
+
+class FakeSpiDataInPin final : public BinaryInputPin {
+  public:
+    FakeSpiDataInPin(FakeSpiTarget& target) : BinaryInputPin(2), target(target) {}
+
+  private:
+    FakeSpiTarget& target;
+
+    virtual std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    virtual std::expected<bool, IoFailureReason> doRead() noexcept { return target.miso; }
+};
+
+std::vector<bool> spiBits(std::vector<uint32_t> words, int width, bool msbFirst) {
+    std::vector<bool> bits;
+    for (uint32_t word : words) {
+        for (int i = 0; i < width; ++i) {
+            bits.push_back((word >> (msbFirst ? (width - 1 - i) : i)) & 1u);
+        }
+    }
+    return bits;
+}
+// ================[END typical specialization]==================
+
+Test(SoftSpiMaster, every_mode_exchanges_bytes) {
+    for (cmspk::iopins::SpiMode mode :
+         {cmspk::iopins::SPI_MODE_0, cmspk::iopins::SPI_MODE_1, cmspk::iopins::SPI_MODE_2, cmspk::iopins::SPI_MODE_3}) {
+        FakeSpiTarget target(mode, spiBits({0x5a, 0xc3}, 8, true));
+        FakeSpiClockPin sck(target);
+        FakeSpiDataOutPin mosi(target);
+        FakeSpiDataInPin miso(target);
+        cmspk::iopins::SoftSpiMaster<cmspk::iopins::SpiSeparateLines> spi(cmspk::iopins::SpiSeparateLines(sck, mosi, miso), mode);
+
+        const std::array<uint8_t, 2> out{0xa5, 0x3c};
+        std::array<uint8_t, 2> in{};
+        cr_assert(spi.transfer(out, in).has_value());
+        cr_assert(target.received == spiBits({0xa5, 0x3c}, 8, true));
+        cr_assert_eq(in[0], 0x5a);
+        cr_assert_eq(in[1], 0xc3);
+        // the clock is back to idle
+        cr_assert_eq(target.sck, target.cpol);
+    }
+}
+
+Test(SoftSpiMaster, supports_lsb_first_and_wider_words) {
+    FakeSpiTarget target(cmspk::iopins::SPI_MODE_1, spiBits({0xbeef}, 16, false));
+    FakeSpiClockPin sck(target);
+    FakeSpiDataOutPin mosi(target);
+    FakeSpiDataInPin miso(target);
+    cmspk::iopins::SoftSpiMaster<cmspk::iopins::SpiSeparateLines> spi(cmspk::iopins::SpiSeparateLines(sck, mosi, miso), cmspk::iopins::SPI_MODE_1,
+                                                                      cmspk::iopins::LSB_FIRST);
+    auto result = spi.transferWord<uint16_t>(0x1234);
+    cr_assert(result.has_value());
+    cr_assert_eq(result.value(), 0xbeef);
+    cr_assert(target.received == spiBits({0x1234}, 16, false));
+
+    FakeSpiTarget wideTarget(cmspk::iopins::SPI_MODE_3, spiBits({0x01234567u, 0x89abcdefu}, 32, true));
+    FakeSpiClockPin wideSck(wideTarget);
+    FakeSpiDataOutPin wideMosi(wideTarget);
+    FakeSpiDataInPin wideMiso(wideTarget);
+    cmspk::iopins::SoftSpiMaster<cmspk::iopins::SpiSeparateLines> wideSpi(cmspk::iopins::SpiSeparateLines(wideSck, wideMosi, wideMiso),
+                                                                          cmspk::iopins::SPI_MODE_3);
+    const std::array<uint32_t, 2> out{0xdeadbeefu, 0xcafef00du};
+    std::array<uint32_t, 1> in{};
+    cr_assert(wideSpi.transfer(out, in).has_value());
+    cr_assert(wideTarget.received == spiBits({0xdeadbeefu, 0xcafef00du}, 32, true));
+    // the words received beyond the size of `in` are discarded
+    cr_assert_eq(in[0], 0x01234567u);
+}
+
+Test(SoftSpiMaster, separate_lines_write_only_the_changing_line) {
+    FakeSpiTarget target(cmspk::iopins::SPI_MODE_0, spiBits({0x00, 0x00}, 8, true));
+    FakeSpiClockPin sck(target);
+    FakeSpiDataOutPin mosi(target);
+    FakeSpiDataInPin miso(target);
+    cmspk::iopins::SoftSpiMaster<cmspk::iopins::SpiSeparateLines> spi(cmspk::iopins::SpiSeparateLines(sck, mosi, miso));
+
+    // first transfer : both lines are written once to know their levels, then only the clock toggles
+    auto result = spi.transferWord<uint8_t>(0xff);
+    cr_assert(result.has_value());
+    cr_assert_eq(target.mosiWrites, 1);
+    cr_assert_eq(target.sckWrites, 1 + 16);
+
+    result = spi.transferWord<uint8_t>(0xff);
+    cr_assert(result.has_value());
+    cr_assert_eq(target.mosiWrites, 1);
+    cr_assert_eq(target.sckWrites, 1 + 32);
+}
+
+Test(SoftSpiMaster, delay_is_called_after_each_clock_edge_with_its_context) {
+    FakeSpiTarget target(cmspk::iopins::SPI_MODE_0, spiBits({0x00}, 8, true));
+    FakeSpiClockPin sck(target);
+    FakeSpiDataOutPin mosi(target);
+    FakeSpiDataInPin miso(target);
+    int delays = 0;
+    cmspk::iopins::SoftSpiMaster<cmspk::iopins::SpiSeparateLines> spi(cmspk::iopins::SpiSeparateLines(sck, mosi, miso), cmspk::iopins::SPI_MODE_0,
+                                                                      cmspk::iopins::MSB_FIRST, [](void* context) { ++*static_cast<int*>(context); },
+                                                                      &delays);
+
+    cr_assert(spi.transferWord<uint8_t>(0xa5).has_value());
+    cr_assert_eq(delays, target.sckWrites);
+    cr_assert_eq(delays, 1 + 16);
+}
+
+Test(SoftSpiMaster, shared_port_lines_update_both_lines_with_one_write) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    bank.setDirections(0, 0b011u, IoDirection::WRITE);
+    bank.setPull(0, 2, cmspk::iopins::SimulatedPull::PULL_UP);
+    cmspk::iopins::SimulatedOutputPinGroup<2> sckMosi(bank, 0, {0, 1});
+    cmspk::iopins::SimulatedInputPin miso(bank, 0, 2);
+    cmspk::iopins::SoftSpiMaster<cmspk::iopins::SpiSharedPortLines> spi(cmspk::iopins::SpiSharedPortLines(sckMosi, miso));
+
+    const std::array<uint8_t, 1> out{0x55};
+    std::array<uint8_t, 1> in{};
+    cr_assert(spi.transfer(out, in).has_value());
+    cr_assert_eq(in[0], 0xff);
+    // each bit is one write for the data setup with the trailing edge, one write for the leading edge, plus the last
+    // trailing edge
+    cr_assert_eq(bank.getWriteCount(0), 2u * 8u + 1u);
+    cr_assert_eq(bank.getLatch(0) & 0b011u, 0b010u);
+}
+
+Test(SoftSpiMaster, failures_stop_the_transfer) {
+    cmspk::iopins::SimulatedPinBank bank(1);
+    bank.setDirections(0, 0b011u, IoDirection::WRITE);
+    bank.setDirection(0, 2, IoDirection::HIGH_Z);
+    cmspk::iopins::SimulatedOutputPin sck(bank, 0, 0);
+    cmspk::iopins::SimulatedOutputPin mosi(bank, 0, 1);
+    cmspk::iopins::SimulatedInputPin miso(bank, 0, 2);
+    cmspk::iopins::SoftSpiMaster<cmspk::iopins::SpiSeparateLines> spi(cmspk::iopins::SpiSeparateLines(sck, mosi, miso));
+
+    const std::array<uint8_t, 2> out{0x55, 0xaa};
+    auto result = spi.transfer(out, std::span<uint8_t>());
+    cr_assert_not(result.has_value());
+    cr_assert_eq(result.error(), IoFailureReason::FAILURE_PIN_IS_DISABLED);
+}
@@ -0,0 +1,65 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+Test(SpscRing, keeps_elements_in_order_across_wrap_around) {
+    cmspk::iopins::SpscRing<uint32_t, 4> ring;
+    cr_assert(ring.empty());
+    cr_assert_eq(ring.capacity(), 4);
+    cr_assert_not(ring.pop().has_value());
+
+    // fill
+    cr_assert(ring.push(1));
+    const std::array<uint32_t, 4> batch{2, 3, 4, 5};
+    cr_assert_eq(ring.pushBatch(batch), 3);
+    cr_assert_eq(ring.size(), 4);
+    cr_assert_not(ring.push(6));
+
+    // partial pop, then push across the end of the storage
+    auto element = ring.pop();
+    cr_assert(element.has_value());
+    cr_assert_eq(element.value(), 1u);
+    cr_assert(ring.push(5));
+    std::array<uint32_t, 8> received{};
+    cr_assert_eq(ring.popBatch(received), 4);
+    cr_assert_eq(received[0], 2u);
+    cr_assert_eq(received[1], 3u);
+    cr_assert_eq(received[2], 4u);
+    cr_assert_eq(received[3], 5u);
+    cr_assert(ring.empty());
+}
+
+Test(SpscRing, transfers_every_element_between_two_threads) {
+    static cmspk::iopins::SpscRing<uint32_t, 64> ring;
+    constexpr uint32_t COUNT = 100000;
+    std::thread producer([] {
+        std::array<uint32_t, 7> batch;
+        uint32_t next = 0;
+        while (next < COUNT) {
+            std::size_t size = 0;
+            while (size < batch.size() && next + size < COUNT) {
+                batch[size] = next + static_cast<uint32_t>(size);
+                ++size;
+            }
+            next += static_cast<uint32_t>(ring.pushBatch(std::span<const uint32_t>(batch.data(), size)));
+        }
+    });
+    uint32_t expected = 0;
+    bool ordered = true;
+    std::array<uint32_t, 5> received;
+    while (expected < COUNT) {
+        std::size_t count = ring.popBatch(received);
+        for (std::size_t i = 0; i < count; ++i) {
+            ordered = ordered && (received[i] == expected++);
+        }
+    }
+    producer.join();
+    cr_assert(ordered);
+    cr_assert(ring.empty());
+}
@@ -0,0 +1,89 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+class ConcreteStaticBinaryInputPin final : public cmspk::iopins::StaticBinaryInputPin<ConcreteStaticBinaryInputPin> {
+    friend cmspk::iopins::StaticBinaryInputPin<ConcreteStaticBinaryInputPin>;
+
+  public:
+    ~ConcreteStaticBinaryInputPin() {}
+    ConcreteStaticBinaryInputPin(uint8_t index, BoolValue* value) : cmspk::iopins::StaticBinaryInputPin<ConcreteStaticBinaryInputPin>(index), value(value) {}
+    bool readable = true;
+    void reconfigure(bool readable) noexcept {
+        this->readable = readable;
+        invalidateCapabilities();
+    }
+
+  private:
+    BoolValue* value;
+
+    std::expected<void, IoFailureReason> checkReadability() noexcept {
+        if (!readable) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+    std::expected<bool, IoFailureReason> doRead() noexcept { return value->value; }
+};
+// ================[END typical specialization]==================
+
+Test(StaticInputPin, readable_pin_is_enabled_readable_not_writable) {
+    BoolValue mockValue{true};
+    ConcreteStaticBinaryInputPin p(42, &mockValue);
+
+    // verify predicates
+    cr_assert(p.isReadable());
+    cr_assert(p.isNotWritable());
+    cr_assert(p.isEnabled());
+    cr_assert_not(p.isNotReadable());
+    cr_assert_not(p.isWritable());
+    cr_assert_not(p.isDisabled());
+
+    // verify id
+    cr_assert_eq(p.getPinId(), 42);
+
+    // verify read
+    auto readResult = p.read();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value(), true);
+
+    // verify read to get another value
+    mockValue.value = false;
+    readResult = p.read();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value(), false);
+
+    // verify failing readability check
+    p.readable = false;
+    readResult = p.read();
+    cr_assert_not(readResult.has_value());
+    cr_assert_eq(readResult.error(), IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+}
+
+Test(StaticInputPin, reader_skips_the_checks_until_invalidated) {
+    BoolValue mockValue{true};
+    ConcreteStaticBinaryInputPin p(42, &mockValue);
+
+    auto reader = p.acquireReader();
+    cr_assert(reader.has_value());
+    cr_assert(reader.value().isValid());
+    cr_assert(reader.value().readRaw());
+    mockValue.value = false;
+    cr_assert_not(reader.value().readRaw());
+
+    // a change of capability invalidates the handle
+    p.reconfigure(false);
+    cr_assert_not(reader.value().isValid());
+    auto failedReader = p.acquireReader();
+    cr_assert_not(failedReader.has_value());
+    cr_assert_eq(failedReader.error(), IoFailureReason::FAILURE_PIN_IS_NOT_READABLE);
+    p.reconfigure(true);
+    cr_assert(p.acquireReader().value().isValid());
+}
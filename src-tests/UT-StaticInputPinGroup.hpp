@@ -0,0 +1,76 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+class ConcreteStaticInputPinTrio final : public cmspk::iopins::StaticInputPinTrio<ConcreteStaticInputPinTrio> {
+    friend cmspk::iopins::StaticInputPinGroup<ConcreteStaticInputPinTrio, 3>;
+
+  public:
+    ~ConcreteStaticInputPinTrio() {}
+    ConcreteStaticInputPinTrio(std::array<uint8_t, 3> indices, uint8_t* value)
+        : cmspk::iopins::StaticInputPinTrio<ConcreteStaticInputPinTrio>(indices), value(value) {}
+
+  private:
+    uint8_t* value;
+
+    std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    std::expected<std::bitset<3>, IoFailureReason> doRead() noexcept { return std::bitset<3>(*value); }
+};
+// ================[END typical specialization]==================
+
+Test(StaticInputPinGroup, can_read_multiple_pin) {
+    uint8_t mockValue{6};  // expected bit set : [0,1,1] from LSB to MSB
+    ConcreteStaticInputPinTrio p({1, 42, 5}, &mockValue);
+
+    // verify predicates
+    cr_assert(p.isReadable());
+    cr_assert(p.isNotWritable());
+    cr_assert_not(p.isDisabled());
+
+    // verify ids
+    cr_assert_eq(p.getPinIds()[0], 1);
+    cr_assert_eq(p.getPinIds()[1], 42);
+    cr_assert_eq(p.getPinIds()[2], 5);
+
+    // verify read
+    auto readResult = p.read();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value()[0], false);
+    cr_assert_eq(readResult.value()[1], true);
+    cr_assert_eq(readResult.value()[2], true);
+
+    // verify read to get another value
+    mockValue = 3;  // expected bit set : [1,1,0] from LSB to MSB
+    readResult = p.read();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value()[0], true);
+    cr_assert_eq(readResult.value()[1], true);
+    cr_assert_eq(readResult.value()[2], false);
+}
+
+Test(StaticInputPinGroup, reader_reads_without_checks) {
+    uint8_t mockValue{6};
+    ConcreteStaticInputPinTrio p({1, 42, 5}, &mockValue);
+    auto reader = p.acquireReader();
+    cr_assert(reader.has_value());
+    cr_assert(reader.value().isValid());
+    cr_assert_eq(reader.value().readRaw().to_ulong(), 6u);
+    mockValue = 1;
+    cr_assert_eq(reader.value().readRaw().to_ulong(), 1u);
+}
+
+Test(StaticInputPinGroup, read_samples_paced) {
+    uint8_t mockValue = 2;
+    ConcreteStaticInputPinTrio p({1, 42, 5}, &mockValue);
+    std::array<std::bitset<3>, 4> samples;
+    cr_assert(p.readSamples(samples, [](void* context) { ++*static_cast<uint8_t*>(context); }, &mockValue).has_value());
+    cr_assert_eq(samples[0].to_ulong(), 2u);
+    cr_assert_eq(samples[3].to_ulong(), 5u);
+}
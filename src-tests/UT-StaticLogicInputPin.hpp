@@ -0,0 +1,73 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+class ConcreteStaticLogicInputPin final : public cmspk::iopins::StaticLogicInputPin<ConcreteStaticLogicInputPin> {
+    friend cmspk::iopins::StaticBinaryInputPin<ConcreteStaticLogicInputPin>;
+
+  public:
+    ~ConcreteStaticLogicInputPin() {}
+    ConcreteStaticLogicInputPin(uint8_t index, BoolValue* value) : cmspk::iopins::StaticLogicInputPin<ConcreteStaticLogicInputPin>(index), value(value) {}
+
+  private:
+    BoolValue* value;
+
+    std::expected<void, IoFailureReason> checkReadability() noexcept { return std::expected<void, IoFailureReason>(); }
+    std::expected<bool, IoFailureReason> doRead() noexcept { return value->value; }
+};
+// ================[END typical specialization]==================
+
+Test(StaticLogicInputPin, readLogic_depends_on_logic_setting) {
+    BoolValue mockValue{true};
+    ConcreteStaticLogicInputPin p(42, &mockValue);
+
+    // verify raw read
+    auto readResult = p.read();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value(), true);
+
+    // verify logic read
+    readResult = p.readLogic();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value(), true);
+    cr_assert(p.isAsserted());
+    cr_assert_not(p.isNegated());
+
+    // change logic setting
+    p.setLogicSetting(LogicIoPinSetting::ACTIVE_LOW);
+    cr_assert_eq(p.getLogicSetting(), LogicIoPinSetting::ACTIVE_LOW);
+    readResult = p.readLogic();
+    cr_assert(readResult.has_value());
+    cr_assert_eq(readResult.value(), false);
+    cr_assert_not(p.isAsserted());
+    cr_assert(p.isNegated());
+
+    mockValue.value = false;
+    cr_assert(p.isAsserted());
+    cr_assert_not(p.isNegated());
+}
+
+Test(StaticLogicInputPin, logic_reader_is_invalidated_by_the_logic_setting) {
+    BoolValue mockValue{false};
+    ConcreteStaticLogicInputPin p(42, &mockValue);
+    p.setLogicSetting(LogicIoPinSetting::ACTIVE_LOW);
+
+    auto reader = p.acquireLogicReader();
+    cr_assert(reader.has_value());
+    cr_assert(reader.value().readLogicRaw());
+    cr_assert_not(reader.value().readRaw());
+
+    // same setting, the handle stays valid
+    p.setLogicSetting(LogicIoPinSetting::ACTIVE_LOW);
+    cr_assert(reader.value().isValid());
+    p.setLogicSetting(LogicIoPinSetting::ACTIVE_HIGH);
+    cr_assert_not(reader.value().isValid());
+    cr_assert_not(p.acquireLogicReader().value().readLogicRaw());
+}
@@ -0,0 +1,79 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+class ConcreteStaticLogicOutputPin final : public cmspk::iopins::StaticLogicOutputPin<ConcreteStaticLogicOutputPin> {
+    friend cmspk::iopins::StaticBinaryOutputPin<ConcreteStaticLogicOutputPin>;
+
+  public:
+    ~ConcreteStaticLogicOutputPin() {}
+    ConcreteStaticLogicOutputPin(uint8_t index, BoolValue* value) : cmspk::iopins::StaticLogicOutputPin<ConcreteStaticLogicOutputPin>(index), value(value) {}
+
+  private:
+    BoolValue* value;
+
+    std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+
+    std::expected<void, IoFailureReason> doWrite(const bool value) noexcept {
+        this->value->value = value;
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[END typical specialization]==================
+
+Test(StaticLogicOutputPin, writeLogic_depends_on_logic_setting) {
+    BoolValue mockValue{false};
+    ConcreteStaticLogicOutputPin p(43, &mockValue);
+
+    // verify write
+    auto writeResult = p.writeLogic(true);
+    cr_assert(writeResult.has_value());
+    cr_assert_eq(mockValue.value, true);
+
+    // use wrappers
+    writeResult = p.toNegated();
+    cr_assert(writeResult.has_value());
+    cr_assert_eq(mockValue.value, false);
+    writeResult = p.toAsserted();
+    cr_assert(writeResult.has_value());
+    cr_assert_eq(mockValue.value, true);
+
+    // change logic setting
+    p.setLogicSetting(LogicIoPinSetting::ACTIVE_LOW);
+    writeResult = p.writeLogic(true);
+    cr_assert(writeResult.has_value());
+    cr_assert_eq(mockValue.value, false);
+
+    // use wrappers
+    writeResult = p.toNegated();
+    cr_assert(writeResult.has_value());
+    cr_assert_eq(mockValue.value, true);
+    writeResult = p.toAsserted();
+    cr_assert(writeResult.has_value());
+    cr_assert_eq(mockValue.value, false);
+}
+
+Test(StaticLogicOutputPin, logic_writer_is_invalidated_by_the_logic_setting) {
+    BoolValue mockValue{false};
+    ConcreteStaticLogicOutputPin p(43, &mockValue);
+    p.setLogicSetting(LogicIoPinSetting::ACTIVE_LOW);
+
+    auto writer = p.acquireLogicWriter();
+    cr_assert(writer.has_value());
+    writer.value().writeLogicRaw(false);
+    cr_assert_eq(mockValue.value, true);
+    writer.value().writeLogicRaw(true);
+    cr_assert_eq(mockValue.value, false);
+
+    p.setLogicSetting(LogicIoPinSetting::ACTIVE_HIGH);
+    cr_assert_not(writer.value().isValid());
+    p.acquireLogicWriter().value().writeLogicRaw(true);
+    cr_assert_eq(mockValue.value, true);
+}
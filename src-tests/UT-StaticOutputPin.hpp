@@ -0,0 +1,91 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+class ConcreteStaticBinaryOutputPin final : public cmspk::iopins::StaticBinaryOutputPin<ConcreteStaticBinaryOutputPin> {
+    friend cmspk::iopins::StaticBinaryOutputPin<ConcreteStaticBinaryOutputPin>;
+
+  public:
+    ~ConcreteStaticBinaryOutputPin() {}
+    ConcreteStaticBinaryOutputPin(uint8_t index, BoolValue* value) : cmspk::iopins::StaticBinaryOutputPin<ConcreteStaticBinaryOutputPin>(index), value(value) {}
+    bool writable = true;
+    void reconfigure(bool writable) noexcept {
+        this->writable = writable;
+        invalidateCapabilities();
+    }
+
+  private:
+    BoolValue* value;
+
+    std::expected<void, IoFailureReason> checkWritability() noexcept {
+        if (!writable) {
+            return std::unexpected(IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+        }
+        return std::expected<void, IoFailureReason>();
+    }
+
+    std::expected<void, IoFailureReason> doWrite(const bool value) noexcept {
+        this->value->value = value;
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[END typical specialization]==================
+
+Test(StaticOutputPin, writable_pin_is_enabled_writable_not_readable) {
+    BoolValue mockValue{true};
+    ConcreteStaticBinaryOutputPin p(43, &mockValue);
+
+    // verify predicates
+    cr_assert(p.isNotReadable());
+    cr_assert(p.isWritable());
+    cr_assert(p.isEnabled());
+    cr_assert_not(p.isReadable());
+    cr_assert_not(p.isNotWritable());
+    cr_assert_not(p.isDisabled());
+
+    // verify id
+    cr_assert_eq(p.getPinId(), 43);
+
+    // verify write
+    auto writeResult = p.write(false);
+    cr_assert(writeResult.has_value());
+    cr_assert_eq(mockValue.value, false);
+
+    // verify another write
+    writeResult = p.write(true);
+    cr_assert(writeResult.has_value());
+    cr_assert_eq(mockValue.value, true);
+
+    // verify failing writability check
+    p.writable = false;
+    writeResult = p.write(false);
+    cr_assert_not(writeResult.has_value());
+    cr_assert_eq(writeResult.error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+    cr_assert_eq(mockValue.value, true);
+}
+
+Test(StaticOutputPin, writer_skips_the_checks_until_invalidated) {
+    BoolValue mockValue{false};
+    ConcreteStaticBinaryOutputPin p(43, &mockValue);
+
+    auto writer = p.acquireWriter();
+    cr_assert(writer.has_value());
+    writer.value().writeRaw(true);
+    cr_assert_eq(mockValue.value, true);
+    writer.value().writeRaw(false);
+    cr_assert_eq(mockValue.value, false);
+
+    // a change of capability invalidates the handle
+    p.reconfigure(false);
+    cr_assert_not(writer.value().isValid());
+    auto failedWriter = p.acquireWriter();
+    cr_assert_not(failedWriter.has_value());
+    cr_assert_eq(failedWriter.error(), IoFailureReason::FAILURE_PIN_IS_NOT_WRITABLE);
+}
@@ -0,0 +1,73 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+// ================[BEGIN typical specialization]==================
+class ConcreteStaticOutputPinTrio final : public cmspk::iopins::StaticOutputPinTrio<ConcreteStaticOutputPinTrio> {
+    friend cmspk::iopins::StaticOutputPinGroup<ConcreteStaticOutputPinTrio, 3>;
+
+  public:
+    ~ConcreteStaticOutputPinTrio() {}
+    ConcreteStaticOutputPinTrio(std::array<uint8_t, 3> indices, uint8_t* value)
+        : cmspk::iopins::StaticOutputPinTrio<ConcreteStaticOutputPinTrio>(indices), value(value) {}
+
+  private:
+    uint8_t* value;
+
+    std::expected<void, IoFailureReason> checkWritability() noexcept { return std::expected<void, IoFailureReason>(); }
+    std::expected<void, IoFailureReason> doWrite(std::bitset<3> valueToWrite) noexcept {
+        (*value) = valueToWrite.to_ulong();
+        return std::expected<void, IoFailureReason>();
+    }
+};
+// ================[END typical specialization]==================
+
+Test(StaticOutputPinGroup, can_write_multiple_pin) {
+    uint8_t mockValue{0};
+    ConcreteStaticOutputPinTrio p({1, 42, 5}, &mockValue);
+
+    // verify predicates
+    cr_assert(p.isNotReadable());
+    cr_assert(p.isWritable());
+    cr_assert_not(p.isDisabled());
+
+    // verify ids
+    cr_assert_eq(p.getPinIds()[0], 1);
+    cr_assert_eq(p.getPinIds()[1], 42);
+    cr_assert_eq(p.getPinIds()[2], 5);
+
+    // verify write
+    auto writeResults = p.write(0b110);  // expected bit set : [0,1,1] from LSB to MSB
+    cr_assert(writeResults.has_value());
+    cr_assert_eq(mockValue, 6);
+
+    // verify write to get another value
+    mockValue = 0;                  // reset mock
+    writeResults = p.write(0b1011);  // expected bit 3 and beyond to be ignored
+    cr_assert(writeResults.has_value());
+    cr_assert_eq(mockValue, 3);
+}
+
+Test(StaticOutputPinGroup, writer_writes_without_checks) {
+    uint8_t mockValue{0};
+    ConcreteStaticOutputPinTrio p({1, 42, 5}, &mockValue);
+    auto writer = p.acquireWriter();
+    cr_assert(writer.has_value());
+    cr_assert(writer.value().isValid());
+    writer.value().writeRaw(0b101);
+    cr_assert_eq(mockValue, 0b101);
+}
+
+Test(StaticOutputPinGroup, write_sequence_ends_with_the_last_sample) {
+    uint8_t mockValue{0};
+    ConcreteStaticOutputPinTrio p({1, 42, 5}, &mockValue);
+    const std::array<std::bitset<3>, 3> values{0b001, 0b010, 0b101};
+    cr_assert(p.writeSequence(values).has_value());
+    cr_assert_eq(mockValue, 5);
+}
@@ -0,0 +1,57 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* ** ** ** ** ** ** ** ** ** ** ** ** **
+
+---
+Copyright (C) 2025~2025 David SPORN
+---
+This is part of **I/O pins**.
+A C++ abstraction layer for I/O pins of micro-controllers.
+* ** ** ** ** ** ** ** ** ** ** ** ** **/
+
+Test(VerticalCounterDebouncer, change_is_accepted_after_enough_consecutive_samples) {
+    cmspk::iopins::VerticalCounterDebouncer<8, 3> debouncer;
+    cr_assert_eq(debouncer.PLANES, 2);
+
+    // channel 0 is stable, channel 1 bounces, channel 2 never changes
+    cr_assert_eq(debouncer.sample(0b011).to_ulong(), 0u);
+    cr_assert_eq(debouncer.sample(0b001).to_ulong(), 0u);
+    cr_assert_eq(debouncer.sample(0b011).to_ulong(), 1u);  // third sample of channel 0
+    cr_assert_eq(debouncer.sample(0b011).to_ulong(), 1u);
+    cr_assert_eq(debouncer.sample(0b011).to_ulong(), 3u);  // third consecutive sample of channel 1
+
+    // release, with a bounce on channel 0
+    cr_assert_eq(debouncer.sample(0b000).to_ulong(), 3u);
+    cr_assert_eq(debouncer.sample(0b001).to_ulong(), 3u);
+    cr_assert_eq(debouncer.sample(0b000).to_ulong(), 1u);  // third consecutive sample of channel 1
+    cr_assert_eq(debouncer.sample(0b000).to_ulong(), 1u);
+    cr_assert_eq(debouncer.sample(0b000).to_ulong(), 0u);  // third consecutive sample of channel 0
+    cr_assert_eq(debouncer.getState().to_ulong(), 0u);
+}
+
+Test(VerticalCounterDebouncer, matches_per_channel_counters) {
+    constexpr std::size_t SAMPLES = 5;
+    cmspk::iopins::VerticalCounterDebouncer<64, SAMPLES> debouncer;
+    std::array<std::size_t, 64> counters{};
+    std::bitset<64> expected;
+    uint64_t noise = 0x0123456789abcdefull;
+    uint64_t level = 0;
+    for (int i = 0; i < 2000; ++i) {
+        noise = noise * 6364136223846793005ull + 1442695040888963407ull;
+        if ((i % 50) == 0) {
+            level = noise;
+        }
+        std::bitset<64> raw(level ^ (noise & (noise >> 7) & (noise >> 13)));
+        for (std::size_t c = 0; c < 64; ++c) {
+            counters[c] = (raw[c] != expected[c]) ? counters[c] + 1 : 0;
+            if (counters[c] == SAMPLES) {
+                expected.flip(c);
+                counters[c] = 0;
+            }
+        }
+        cr_assert_eq(debouncer.sample(raw), expected);
+    }
+
+    // reset
+    debouncer.reset(0xff);
+    cr_assert_eq(debouncer.getState().to_ullong(), 0xffull);
+}